@@ -0,0 +1,87 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdBoxFilter.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX_ENABLE    
+    namespace Avx
+    {
+        void BoxColsInit32f(const float * src, size_t srcStride, size_t size, size_t height, size_t radius, float * cols)
+        {
+            size_t sizeF = AlignLo(size, F);
+            memset(cols, 0, size*sizeof(float));
+            for (ptrdiff_t dy = -(ptrdiff_t)radius; dy <= (ptrdiff_t)radius; ++dy)
+            {
+                const float * s = src + Base::BoxRow(dy, height)*srcStride;
+                size_t i = 0;
+                for (; i < sizeF; i += F)
+                    _mm256_storeu_ps(cols + i, _mm256_add_ps(_mm256_loadu_ps(cols + i), _mm256_loadu_ps(s + i)));
+                for (; i < size; ++i)
+                    cols[i] += s[i];
+            }
+        }
+
+        void BoxColsUpdate32f(const float * add, const float * sub, size_t size, float * cols)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+                _mm256_storeu_ps(cols + i, _mm256_add_ps(_mm256_loadu_ps(cols + i), _mm256_sub_ps(_mm256_loadu_ps(add + i), _mm256_loadu_ps(sub + i))));
+            for (; i < size; ++i)
+                cols[i] += add[i] - sub[i];
+        }
+
+        void BoxScale32f(float * dst, size_t size, float scale)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            __m256 _scale = _mm256_set1_ps(scale);
+            for (; i < sizeF; i += F)
+                _mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_loadu_ps(dst + i), _scale));
+            for (; i < size; ++i)
+                dst[i] = dst[i]*scale;
+        }
+
+        void BoxFilter32f(const float * src, size_t srcStride, size_t width, size_t height, size_t channelCount,
+            size_t radiusX, size_t radiusY, float * dst, size_t dstStride, SimdBool normalize)
+        {
+            Base::BoxBuffer<float> buffer(width, channelCount, radiusX);
+            float * cols = buffer.cols.data + buffer.border;
+            float scale = 1.0f / float((2*radiusX + 1)*(2*radiusY + 1));
+            BoxColsInit32f(src, srcStride, buffer.size, height, radiusY, cols);
+            for (size_t row = 0; row < height; ++row)
+            {
+                Base::BoxSetBorder(cols, width, channelCount, radiusX);
+                Base::BoxRowSums32f(buffer.cols.data, buffer.size, channelCount, buffer.kernel, dst);
+                if (normalize)
+                    BoxScale32f(dst, buffer.size, scale);
+                if (row < height - 1)
+                    BoxColsUpdate32f(src + Base::BoxRow(row + radiusY + 1, height)*srcStride, src + Base::BoxRow(row - radiusY, height)*srcStride, buffer.size, cols);
+                dst += dstStride;
+            }
+        }
+    }
+#endif//SIMD_AVX_ENABLE
+}
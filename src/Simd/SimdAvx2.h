@@ -126,6 +126,14 @@ namespace Simd
             uint8_t value, size_t neighborhood, uint8_t threshold, uint8_t positive, uint8_t negative,
             uint8_t * dst, size_t dstStride, SimdCompareType compareType);
 
+        void BoxFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            size_t channelCount, size_t radiusX, size_t radiusY, uint8_t * dst, size_t dstStride);
+
+        void BoxSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            size_t channelCount, size_t radiusX, size_t radiusY, uint8_t * sum, size_t sumStride);
+
+        void Canny(const uint8_t * src, size_t srcStride, size_t width, size_t height, int16_t lowThreshold, int16_t highThreshold, uint8_t * dst, size_t dstStride);
+
         void ConditionalCount8u(const uint8_t * src, size_t stride, size_t width, size_t height,
             uint8_t value, SimdCompareType compareType, uint32_t * count);
 
@@ -168,6 +176,9 @@ namespace Simd
         void DetectionLbpDetect16ii(const void * hid, const uint8_t * mask, size_t maskStride,
             ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
 
+        void DistanceTransform(const uint8_t * mask, size_t maskStride, size_t width, size_t height, uint8_t index, SimdDistanceType type,
+            uint8_t * dst, size_t dstStride, SimdPixelFormatType dstFormat);
+
         void EdgeBackgroundGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height,
             uint8_t * background, size_t backgroundStride);
 
@@ -222,6 +233,8 @@ namespace Simd
         void HistogramMasked(const uint8_t * src, size_t srcStride, size_t width, size_t height,
             const uint8_t * mask, size_t maskStride, uint8_t index, uint32_t * histogram);
 
+        void Clahe(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t tilesX, size_t tilesY, float clipLimit, uint8_t * dst, size_t dstStride);
+
         void HistogramConditional(const uint8_t * src, size_t srcStride, size_t width, size_t height,
             const uint8_t * mask, size_t maskStride, uint8_t value, SimdCompareType compareType, uint32_t * histogram);
 
@@ -281,6 +294,10 @@ namespace Simd
 
         void LbpEstimate(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
 
+        void LucasKanadeTrack(const uint8_t * prev, size_t prevStride, const uint8_t * next, size_t nextStride, size_t width, size_t height,
+            const float * prevPoints, float * nextPoints, size_t count, size_t window, size_t iterations, float epsilon, float minEigen,
+            uint8_t * status, float * errors);
+
         void MeanFilter3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
 
         void MedianFilterRhomb3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
@@ -295,6 +312,12 @@ namespace Simd
         void MedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height,
             size_t channelCount, uint8_t * dst, size_t dstStride);
 
+        void MedianFilterSquare(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            size_t channelCount, size_t radius, uint8_t * dst, size_t dstStride);
+
+        void Morphology(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount,
+            size_t radiusX, size_t radiusY, SimdMorphologyType type, uint8_t * dst, size_t dstStride);
+
         void NeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion);
 
         void NeuralProductSum(const float * a, const float * b, size_t size, float * sum);
@@ -337,6 +360,9 @@ namespace Simd
             size_t kernelX, size_t kernelY, size_t padX, size_t padY, size_t strideX, size_t strideY, size_t dilationX, size_t dilationY,
             void * buffer, size_t * size, float * dst, size_t dstWidth, size_t dstHeight, size_t dstDepth, int add);
 
+        size_t NonMaxSuppression32f(const float * boxes, float * scores, size_t count, SimdNonMaxSuppressionType type,
+            float iouThreshold, float sigma, float scoreThreshold, size_t * indices);
+
         void OperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
             size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type);
 
@@ -360,6 +386,16 @@ namespace Simd
         void ReduceGray5x5(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
             uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, int compensation);
 
+        void RemapBilinear(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t channelCount, const int16_t * map, size_t mapStride,
+            size_t width, size_t height, SimdWarpBorderType border, const uint8_t * value, uint8_t * dst, size_t dstStride);
+
+        void RemapBilinearYuv420p(const uint8_t * srcY, size_t srcYStride, const uint8_t * srcU, size_t srcUStride, const uint8_t * srcV, size_t srcVStride,
+            size_t srcWidth, size_t srcHeight, const int16_t * map, size_t mapStride, size_t width, size_t height, SimdWarpBorderType border, const uint8_t * value,
+            uint8_t * dstY, size_t dstYStride, uint8_t * dstU, size_t dstUStride, uint8_t * dstV, size_t dstVStride);
+
+        void RemapConvertMap(const float * mapX, size_t mapXStride, const float * mapY, size_t mapYStride, size_t width, size_t height,
+            size_t srcWidth, size_t srcHeight, int16_t * map, size_t mapStride);
+
         void Reorder16bit(const uint8_t * src, size_t size, uint8_t * dst);
 
         void Reorder32bit(const uint8_t * src, size_t size, uint8_t * dst);
@@ -377,6 +413,9 @@ namespace Simd
 
         void SegmentationFillSingleHoles(uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index);
 
+        size_t SegmentationLabelComponents(const uint8_t * mask, size_t maskStride, size_t width, size_t height, uint8_t index, SimdConnectivityType connectivity,
+            uint32_t * labels, size_t labelsStride, SimdConnectedComponent * components, size_t capacity);
+
         void SegmentationPropagate2x2(const uint8_t * parent, size_t parentStride, size_t width, size_t height,
             uint8_t * child, size_t childStride, const uint8_t * difference, size_t differenceStride,
             uint8_t currentIndex, uint8_t invalidIndex, uint8_t emptyIndex, uint8_t differenceThreshold);
@@ -478,6 +517,9 @@ namespace Simd
 
         void SynetUnaryOperation32fLayerForward(const float* src, size_t size, SimdSynetUnaryOperation32fType type, float* dst);
 
+        void TemplateMatch(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const uint8_t * tmpl, size_t tmplStride,
+            size_t tmplWidth, size_t tmplHeight, SimdTemplateMatchType type, float * dst, size_t dstStride);
+
         void TextureBoostedSaturatedGradient(const uint8_t * src, size_t srcStride, size_t width, size_t height,
             uint8_t saturation, uint8_t boost, uint8_t * dx, size_t dxStride, uint8_t * dy, size_t dyStride);
 
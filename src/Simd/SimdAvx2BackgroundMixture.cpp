@@ -0,0 +1,145 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdBackgroundMixture.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        template<size_t C> SIMD_INLINE void BackgroundMixtureRow16(const BackgroundMixtureParam & p, const uint8_t * src, int16_t * model, uint8_t * mask)
+        {
+            const size_t K = p.gaussians, W = p.alignedW, S = (2 + C) * W;
+            const __m256i alpha = _mm256_set1_epi16(p.alpha), threshold = _mm256_set1_epi16(p.threshold), ratio = _mm256_set1_epi16(p.ratio);
+            const __m256i weightMax = _mm256_set1_epi16(BACKGROUND_MIXTURE_WEIGHT_MAX), distMax = _mm256_set1_epi16(BACKGROUND_MIXTURE_DIST_MAX);
+            const __m256i varMin = _mm256_set1_epi16(BACKGROUND_MIXTURE_VAR_MIN), varMax = _mm256_set1_epi16(BACKGROUND_MIXTURE_VAR_MAX);
+            const __m256i varInit = _mm256_set1_epi16(BACKGROUND_MIXTURE_VAR_INIT), third = _mm256_set1_epi16(21846);
+
+            __m256i value[C];
+            for (size_t c = 0; c < C; ++c)
+                value[c] = _mm256_slli_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(src + c * W))), BACKGROUND_MIXTURE_MEAN_SHIFT);
+
+            __m256i weight[BACKGROUND_MIXTURE_GAUSSIANS_MAX], dist[BACKGROUND_MIXTURE_GAUSSIANS_MAX], match[BACKGROUND_MIXTURE_GAUSSIANS_MAX];
+            __m256i best = _mm256_set1_epi16(-1), lightest = weightMax, total = _mm256_setzero_si256(), heavier = _mm256_setzero_si256();
+            for (size_t k = 0; k < K; ++k)
+            {
+                const int16_t * g = model + k * S;
+                __m256i d = _mm256_setzero_si256();
+                for (size_t c = 0; c < C; ++c)
+                {
+                    __m256i diff = _mm256_slli_epi16(_mm256_abs_epi16(_mm256_sub_epi16(value[c], _mm256_load_si256((__m256i*)(g + (2 + c) * W)))), 1);
+                    d = _mm256_adds_epu16(d, _mm256_mulhi_epu16(diff, diff));
+                }
+                __m256i t = _mm256_mulhi_epu16(_mm256_load_si256((__m256i*)(g + W)), threshold);
+                weight[k] = _mm256_load_si256((__m256i*)g);
+                dist[k] = d;
+                match[k] = _mm256_andnot_si256(_mm256_cmpeq_epi16(_mm256_max_epu16(d, t), d), K_INV_ZERO);
+                best = _mm256_max_epi16(best, _mm256_blendv_epi8(_mm256_set1_epi16(-1), weight[k], match[k]));
+                lightest = _mm256_min_epi16(lightest, weight[k]);
+                total = _mm256_adds_epu16(total, weight[k]);
+            }
+
+            __m256i chosen[BACKGROUND_MIXTURE_GAUSSIANS_MAX], replaced[BACKGROUND_MIXTURE_GAUSSIANS_MAX];
+            __m256i found = _mm256_setzero_si256(), replace = _mm256_setzero_si256();
+            for (size_t k = 0; k < K; ++k)
+            {
+                chosen[k] = _mm256_andnot_si256(found, _mm256_and_si256(match[k], _mm256_cmpeq_epi16(weight[k], best)));
+                found = _mm256_or_si256(found, chosen[k]);
+                heavier = _mm256_adds_epu16(heavier, _mm256_and_si256(_mm256_cmpgt_epi16(weight[k], best), weight[k]));
+            }
+            for (size_t k = 0; k < K; ++k)
+            {
+                replaced[k] = _mm256_andnot_si256(_mm256_or_si256(found, replace), _mm256_cmpeq_epi16(weight[k], lightest));
+                replace = _mm256_or_si256(replace, replaced[k]);
+            }
+            __m256i limit = _mm256_mulhi_epu16(total, ratio);
+            __m256i background = _mm256_andnot_si256(_mm256_cmpeq_epi16(_mm256_max_epu16(heavier, limit), heavier), found);
+
+            for (size_t k = 0; k < K; ++k)
+            {
+                int16_t * g = model + k * S;
+                __m256i w = _mm256_add_epi16(weight[k], _mm256_mulhrs_epi16(_mm256_sub_epi16(_mm256_and_si256(chosen[k], weightMax), weight[k]), alpha));
+                _mm256_store_si256((__m256i*)g, _mm256_blendv_epi8(w, alpha, replaced[k]));
+
+                __m256i d = C == 1 ? dist[k] : _mm256_mulhi_epu16(dist[k], third);
+                __m256i target = _mm256_slli_epi16(_mm256_min_epu16(d, distMax), BACKGROUND_MIXTURE_VAR_SHIFT);
+                __m256i var = _mm256_load_si256((__m256i*)(g + W));
+                __m256i updated = _mm256_add_epi16(var, _mm256_mulhrs_epi16(_mm256_sub_epi16(target, var), alpha));
+                updated = _mm256_min_epi16(_mm256_max_epi16(updated, varMin), varMax);
+                var = _mm256_blendv_epi8(var, updated, chosen[k]);
+                _mm256_store_si256((__m256i*)(g + W), _mm256_blendv_epi8(var, varInit, replaced[k]));
+
+                for (size_t c = 0; c < C; ++c)
+                {
+                    __m256i mean = _mm256_load_si256((__m256i*)(g + (2 + c) * W));
+                    __m256i moved = _mm256_add_epi16(mean, _mm256_mulhrs_epi16(_mm256_sub_epi16(value[c], mean), alpha));
+                    mean = _mm256_blendv_epi8(mean, moved, chosen[k]);
+                    _mm256_store_si256((__m256i*)(g + (2 + c) * W), _mm256_blendv_epi8(mean, value[c], replaced[k]));
+                }
+            }
+
+            __m256i foreground = _mm256_andnot_si256(background, K_INV_ZERO);
+            __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi16(foreground, foreground), 0x08);
+            _mm_storeu_si128((__m128i*)mask, _mm256_castsi256_si128(packed));
+        }
+
+        template<size_t C> void BackgroundMixtureRow(const BackgroundMixtureParam & p, const uint8_t * src, int16_t * model, uint8_t * mask)
+        {
+            for (size_t x = 0; x < p.alignedW; x += HA)
+                BackgroundMixtureRow16<C>(p, src + x, model + x, mask + x);
+        }
+
+        void BackgroundMixtureRow(const BackgroundMixtureParam & p, const uint8_t * src, int16_t * model, uint8_t * mask)
+        {
+            if (p.channels == 1)
+                BackgroundMixtureRow<1>(p, src, model, mask);
+            else
+                BackgroundMixtureRow<3>(p, src, model, mask);
+        }
+
+        //---------------------------------------------------------------------
+
+        BackgroundMixtureCommon::BackgroundMixtureCommon(const BackgroundMixtureParam & param)
+            : Base::BackgroundMixtureCommon(param)
+        {
+            _row = Avx2::BackgroundMixtureRow;
+        }
+
+        //---------------------------------------------------------------------
+
+        void * BackgroundMixtureInit(size_t width, size_t height, size_t channels, size_t gaussians, size_t scale,
+            float learningRate, float varianceThreshold, float backgroundRatio)
+        {
+            BackgroundMixtureParam param(width, height, channels, gaussians, scale, learningRate, varianceThreshold, backgroundRatio, sizeof(__m256i));
+            if (!param.Valid())
+                return NULL;
+            return new BackgroundMixtureCommon(param);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
@@ -0,0 +1,198 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdBoxFilter.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE void BoxColsAdd(const uint8_t * src, uint32_t * cols)
+        {
+            __m256i _src = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)src));
+            __m256i lo = _mm256_cvtepu16_epi32(_mm256_castsi256_si128(_src));
+            __m256i hi = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(_src, 1));
+            _mm256_storeu_si256((__m256i*)cols + 0, _mm256_add_epi32(_mm256_loadu_si256((__m256i*)cols + 0), lo));
+            _mm256_storeu_si256((__m256i*)cols + 1, _mm256_add_epi32(_mm256_loadu_si256((__m256i*)cols + 1), hi));
+        }
+
+        void BoxColsInit(const uint8_t * src, size_t srcStride, size_t size, size_t height, size_t radius, uint32_t * cols)
+        {
+            size_t sizeHA = AlignLo(size, HA);
+            memset(cols, 0, size*sizeof(uint32_t));
+            for (ptrdiff_t dy = -(ptrdiff_t)radius; dy <= (ptrdiff_t)radius; ++dy)
+            {
+                const uint8_t * s = src + Base::BoxRow(dy, height)*srcStride;
+                size_t i = 0;
+                for (; i < sizeHA; i += HA)
+                    BoxColsAdd(s + i, cols + i);
+                for (; i < size; ++i)
+                    cols[i] += s[i];
+            }
+        }
+
+        SIMD_INLINE void BoxColsUpdate(const uint8_t * add, const uint8_t * sub, uint32_t * cols)
+        {
+            __m256i _add = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)add));
+            __m256i _sub = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)sub));
+            __m256i diff = _mm256_sub_epi16(_add, _sub);
+            __m256i lo = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(diff));
+            __m256i hi = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(diff, 1));
+            _mm256_storeu_si256((__m256i*)cols + 0, _mm256_add_epi32(_mm256_loadu_si256((__m256i*)cols + 0), lo));
+            _mm256_storeu_si256((__m256i*)cols + 1, _mm256_add_epi32(_mm256_loadu_si256((__m256i*)cols + 1), hi));
+        }
+
+        void BoxColsUpdate(const uint8_t * add, const uint8_t * sub, size_t size, uint32_t * cols)
+        {
+            size_t sizeA = AlignLo(size, A), i = 0;
+            for (; i < sizeA; i += A)
+            {
+                BoxColsUpdate(add + i + 0, sub + i + 0, cols + i + 0);
+                BoxColsUpdate(add + i + HA, sub + i + HA, cols + i + HA);
+            }
+            for (; i < size; ++i)
+                cols[i] += add[i] - sub[i];
+        }
+
+        template<int channelCount> SIMD_INLINE __m256i BoxPrefixSum(__m256i value);
+
+        template<> SIMD_INLINE __m256i BoxPrefixSum<1>(__m256i value)
+        {
+            value = _mm256_add_epi32(value, _mm256_slli_si256(value, 4));
+            value = _mm256_add_epi32(value, _mm256_slli_si256(value, 8));
+            return _mm256_add_epi32(value, _mm256_permute2x128_si256(_mm256_shuffle_epi32(value, 0xFF), value, 0x08));
+        }
+
+        template<> SIMD_INLINE __m256i BoxPrefixSum<2>(__m256i value)
+        {
+            value = _mm256_add_epi32(value, _mm256_slli_si256(value, 8));
+            return _mm256_add_epi32(value, _mm256_permute2x128_si256(_mm256_shuffle_epi32(value, 0xEE), value, 0x08));
+        }
+
+        template<> SIMD_INLINE __m256i BoxPrefixSum<4>(__m256i value)
+        {
+            return _mm256_add_epi32(value, _mm256_permute2x128_si256(value, value, 0x08));
+        }
+
+        const __m256i K32_BOX_CARRY_1 = SIMD_MM256_SETR_EPI32(7, 7, 7, 7, 7, 7, 7, 7);
+        const __m256i K32_BOX_CARRY_2 = SIMD_MM256_SETR_EPI32(6, 7, 6, 7, 6, 7, 6, 7);
+        const __m256i K32_BOX_CARRY_4 = SIMD_MM256_SETR_EPI32(4, 5, 6, 7, 4, 5, 6, 7);
+
+        template<int channelCount> void BoxPrefixSums(const uint32_t * cols, size_t size, uint32_t * sums)
+        {
+            const __m256i index = channelCount == 1 ? K32_BOX_CARRY_1 : (channelCount == 2 ? K32_BOX_CARRY_2 : K32_BOX_CARRY_4);
+            size_t sizeF = AlignLo(size, F), i = 0;
+            __m256i carry = _mm256_setzero_si256();
+            for (; i < sizeF; i += F)
+            {
+                __m256i sum = _mm256_add_epi32(BoxPrefixSum<channelCount>(_mm256_loadu_si256((__m256i*)(cols + i))), carry);
+                _mm256_storeu_si256((__m256i*)(sums + channelCount + i), sum);
+                carry = _mm256_permutevar8x32_epi32(sum, index);
+            }
+            for (; i < size; ++i)
+                sums[i + channelCount] = sums[i] + cols[i];
+        }
+
+        void BoxRowSums(const uint32_t * cols, size_t size, size_t channelCount, size_t kernel, uint32_t * sums, uint32_t * dst)
+        {
+            size_t full = size + kernel - channelCount;
+            switch (channelCount)
+            {
+            case 1: BoxPrefixSums<1>(cols, full, sums); break;
+            case 2: BoxPrefixSums<2>(cols, full, sums); break;
+            case 4: BoxPrefixSums<4>(cols, full, sums); break;
+            default:
+                for (size_t i = 0; i < full; ++i)
+                    sums[i + channelCount] = sums[i] + cols[i];
+            }
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+            {
+                __m256i lo = _mm256_loadu_si256((__m256i*)(sums + i));
+                __m256i hi = _mm256_loadu_si256((__m256i*)(sums + i + kernel));
+                _mm256_storeu_si256((__m256i*)(dst + i), _mm256_sub_epi32(hi, lo));
+            }
+            for (; i < size; ++i)
+                dst[i] = sums[i + kernel] - sums[i];
+        }
+
+        SIMD_INLINE __m256i BoxMean(const uint32_t * sum, __m256 scale)
+        {
+            return _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_loadu_si256((__m256i*)sum)), scale));
+        }
+
+        void BoxMean(const uint32_t * sum, size_t size, float scale, uint8_t * dst)
+        {
+            size_t sizeA = AlignLo(size, A), i = 0;
+            __m256 _scale = _mm256_set1_ps(scale);
+            for (; i < sizeA; i += A)
+            {
+                __m256i lo = PackI32ToI16(BoxMean(sum + i + 0 * F, _scale), BoxMean(sum + i + 1 * F, _scale));
+                __m256i hi = PackI32ToI16(BoxMean(sum + i + 2 * F, _scale), BoxMean(sum + i + 3 * F, _scale));
+                _mm256_storeu_si256((__m256i*)(dst + i), PackI16ToU8(lo, hi));
+            }
+            for (; i < size; ++i)
+                dst[i] = Round(float(sum[i])*scale);
+        }
+
+        template<bool mean> void BoxFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            size_t channelCount, size_t radiusX, size_t radiusY, uint8_t * dst, size_t dstStride)
+        {
+            Base::BoxBuffer<uint32_t> buffer(width, channelCount, radiusX);
+            uint32_t * cols = buffer.cols.data + buffer.border;
+            float scale = 1.0f / float((2*radiusX + 1)*(2*radiusY + 1));
+            BoxColsInit(src, srcStride, buffer.size, height, radiusY, cols);
+            for (size_t row = 0; row < height; ++row)
+            {
+                Base::BoxSetBorder(cols, width, channelCount, radiusX);
+                if (mean)
+                {
+                    BoxRowSums(buffer.cols.data, buffer.size, channelCount, buffer.kernel, buffer.sums.data, buffer.dst.data);
+                    BoxMean(buffer.dst.data, buffer.size, scale, dst);
+                }
+                else
+                    BoxRowSums(buffer.cols.data, buffer.size, channelCount, buffer.kernel, buffer.sums.data, (uint32_t*)dst);
+                if (row < height - 1)
+                    BoxColsUpdate(src + Base::BoxRow(row + radiusY + 1, height)*srcStride, src + Base::BoxRow(row - radiusY, height)*srcStride, buffer.size, cols);
+                dst += dstStride;
+            }
+        }
+
+        void BoxFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            size_t channelCount, size_t radiusX, size_t radiusY, uint8_t * dst, size_t dstStride)
+        {
+            BoxFilter<true>(src, srcStride, width, height, channelCount, radiusX, radiusY, dst, dstStride);
+        }
+
+        void BoxSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            size_t channelCount, size_t radiusX, size_t radiusY, uint8_t * sum, size_t sumStride)
+        {
+            BoxFilter<false>(src, srcStride, width, height, channelCount, radiusX, radiusY, sum, sumStride);
+        }
+    }
+#endif//SIMD_AVX2_ENABLE
+}
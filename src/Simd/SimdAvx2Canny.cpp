@@ -0,0 +1,118 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdCanny.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdLoad.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE __m256i AbsI16(__m256i value)
+        {
+            return _mm256_abs_epi16(value);
+        }
+
+        SIMD_INLINE void CannyMagnitude(const int16_t * dx, const int16_t * dy, int16_t * mag)
+        {
+            __m256i _dx = _mm256_loadu_si256((__m256i*)dx);
+            __m256i _dy = _mm256_loadu_si256((__m256i*)dy);
+            _mm256_storeu_si256((__m256i*)mag, _mm256_add_epi16(AbsI16(_dx), AbsI16(_dy)));
+        }
+
+        void CannyMagnitude(const int16_t * dx, const int16_t * dy, size_t width, int16_t * mag)
+        {
+            if (width < HA)
+            {
+                Base::CannyMagnitude(dx, dy, width, mag);
+                return;
+            }
+            size_t widthHA = AlignLo(width, HA);
+            for (size_t col = 0; col < widthHA; col += HA)
+                CannyMagnitude(dx + col, dy + col, mag + col);
+            if (widthHA != width)
+                CannyMagnitude(dx + width - HA, dy + width - HA, mag + width - HA);
+        }
+
+        const __m256i K16_CANNY_NUM = SIMD_MM256_SET1_EPI16(Base::CANNY_TAN_NUM);
+        const __m256i K16_CANNY_DEN = SIMD_MM256_SET1_EPI16(Base::CANNY_TAN_DEN);
+
+        SIMD_INLINE __m256i CannyNms(const int16_t * dx, const int16_t * dy, const int16_t * mag0, const int16_t * mag1, const int16_t * mag2, __m256i low, __m256i high)
+        {
+            __m256i _dx = _mm256_loadu_si256((__m256i*)dx);
+            __m256i _dy = _mm256_loadu_si256((__m256i*)dy);
+            __m256i ax = AbsI16(_dx), ay = AbsI16(_dy);
+            __m256i notHor = _mm256_cmpgt_epi16(_mm256_mullo_epi16(ay, K16_CANNY_DEN), _mm256_mullo_epi16(ax, K16_CANNY_NUM));
+            __m256i notVer = _mm256_cmpgt_epi16(_mm256_mullo_epi16(ax, K16_CANNY_DEN), _mm256_mullo_epi16(ay, K16_CANNY_NUM));
+            __m256i same = _mm256_cmpgt_epi16(_mm256_xor_si256(_dx, _dy), K_INV_ZERO);
+            __m256i n1 = _mm256_blendv_epi8(_mm256_loadu_si256((__m256i*)(mag0 + 1)), _mm256_loadu_si256((__m256i*)(mag0 - 1)), same);
+            __m256i n2 = _mm256_blendv_epi8(_mm256_loadu_si256((__m256i*)(mag2 - 1)), _mm256_loadu_si256((__m256i*)(mag2 + 1)), same);
+            n1 = _mm256_blendv_epi8(_mm256_loadu_si256((__m256i*)mag0), n1, notVer);
+            n2 = _mm256_blendv_epi8(_mm256_loadu_si256((__m256i*)mag2), n2, notVer);
+            n1 = _mm256_blendv_epi8(_mm256_loadu_si256((__m256i*)(mag1 - 1)), n1, notHor);
+            n2 = _mm256_blendv_epi8(_mm256_loadu_si256((__m256i*)(mag1 + 1)), n2, notHor);
+            __m256i m = _mm256_loadu_si256((__m256i*)mag1);
+            __m256i edge = _mm256_andnot_si256(_mm256_cmpgt_epi16(n2, m), _mm256_cmpgt_epi16(m, n1));
+            edge = _mm256_and_si256(edge, _mm256_cmpgt_epi16(m, low));
+            __m256i strong = _mm256_and_si256(edge, _mm256_cmpgt_epi16(m, high));
+            return _mm256_sub_epi16(K_ZERO, _mm256_add_epi16(edge, strong));
+        }
+
+        SIMD_INLINE void CannyNms(const int16_t * dx, const int16_t * dy, const int16_t * mag0, const int16_t * mag1, const int16_t * mag2,
+            size_t col, __m256i low, __m256i high, uint8_t * map)
+        {
+            __m256i lo = CannyNms(dx + col, dy + col, mag0 + col, mag1 + col, mag2 + col, low, high);
+            __m256i hi = CannyNms(dx + col + HA, dy + col + HA, mag0 + col + HA, mag1 + col + HA, mag2 + col + HA, low, high);
+            _mm256_storeu_si256((__m256i*)(map + col), PackI16ToU8(lo, hi));
+        }
+
+        void CannyNms(const int16_t * dx, const int16_t * dy, const int16_t * mag0, const int16_t * mag1, const int16_t * mag2,
+            size_t width, int16_t lowThreshold, int16_t highThreshold, uint8_t * map)
+        {
+            if (width < A)
+            {
+                Base::CannyNms(dx, dy, mag0, mag1, mag2, width, lowThreshold, highThreshold, map);
+                return;
+            }
+            __m256i low = _mm256_set1_epi16(lowThreshold), high = _mm256_set1_epi16(highThreshold);
+            size_t widthA = AlignLo(width, A);
+            for (size_t col = 0; col < widthA; col += A)
+                CannyNms(dx, dy, mag0, mag1, mag2, col, low, high, map);
+            if (widthA != width)
+                CannyNms(dx, dy, mag0, mag1, mag2, width - A, low, high, map);
+        }
+
+        void Canny(const uint8_t * src, size_t srcStride, size_t width, size_t height, int16_t lowThreshold, int16_t highThreshold, uint8_t * dst, size_t dstStride)
+        {
+            bool sobel = width > A;
+            Base::Canny(src, srcStride, width, height, lowThreshold, highThreshold, dst, dstStride, 
+                sobel ? SobelDx : Base::SobelDx, sobel ? SobelDy : Base::SobelDy, CannyMagnitude, CannyNms);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
@@ -0,0 +1,106 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdDistance.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        void DistanceColDown(const uint8_t * mask, uint8_t index, const int32_t * prev, int32_t * curr, size_t width)
+        {
+            const __m256i _index = _mm256_set1_epi32(index);
+            const __m256i _inf = _mm256_set1_epi32(Base::DISTANCE_INF);
+            const __m256i _1 = _mm256_set1_epi32(1);
+            size_t widthF = AlignLo(width, F), x = 0;
+            for (; x < widthF; x += F)
+            {
+                __m256i feature = _mm256_cmpeq_epi32(_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(mask + x))), _index);
+                __m256i dist = _mm256_min_epi32(_mm256_add_epi32(_mm256_loadu_si256((__m256i*)(prev + x)), _1), _inf);
+                _mm256_storeu_si256((__m256i*)(curr + x), _mm256_andnot_si256(feature, dist));
+            }
+            if (x < width)
+                Base::DistanceColDown(mask + x, index, prev + x, curr + x, width - x);
+        }
+
+        void DistanceColUp(const int32_t * next, int32_t * curr, size_t width)
+        {
+            const __m256i _1 = _mm256_set1_epi32(1);
+            size_t widthF = AlignLo(width, F), x = 0;
+            for (; x < widthF; x += F)
+            {
+                __m256i dist = _mm256_add_epi32(_mm256_loadu_si256((__m256i*)(next + x)), _1);
+                _mm256_storeu_si256((__m256i*)(curr + x), _mm256_min_epi32(_mm256_loadu_si256((__m256i*)(curr + x)), dist));
+            }
+            if (x < width)
+                Base::DistanceColUp(next + x, curr + x, width - x);
+        }
+
+        SIMD_INLINE __m256i DistanceMin(const int32_t * row, ptrdiff_t offset, __m256i weight)
+        {
+            __m256i lo = _mm256_loadu_si256((__m256i*)(row - offset));
+            __m256i hi = _mm256_loadu_si256((__m256i*)(row + offset));
+            return _mm256_add_epi32(_mm256_min_epi32(lo, hi), weight);
+        }
+
+        void DistanceChamferVert(const int32_t * row1, const int32_t * row2, int32_t * curr, size_t width, int32_t a, int32_t b, int32_t c)
+        {
+            const __m256i _a = _mm256_set1_epi32(a), _b = _mm256_set1_epi32(b), _c = _mm256_set1_epi32(c);
+            size_t widthF = AlignLo(width, F), x = 0;
+            if (row2)
+            {
+                for (; x < widthF; x += F)
+                {
+                    __m256i d = _mm256_min_epi32(_mm256_loadu_si256((__m256i*)(curr + x)), _mm256_add_epi32(_mm256_loadu_si256((__m256i*)(row1 + x)), _a));
+                    d = _mm256_min_epi32(d, DistanceMin(row1 + x, 1, _b));
+                    d = _mm256_min_epi32(d, DistanceMin(row1 + x, 2, _c));
+                    d = _mm256_min_epi32(d, DistanceMin(row2 + x, 1, _c));
+                    _mm256_storeu_si256((__m256i*)(curr + x), d);
+                }
+            }
+            else
+            {
+                for (; x < widthF; x += F)
+                {
+                    __m256i d = _mm256_min_epi32(_mm256_loadu_si256((__m256i*)(curr + x)), _mm256_add_epi32(_mm256_loadu_si256((__m256i*)(row1 + x)), _a));
+                    d = _mm256_min_epi32(d, DistanceMin(row1 + x, 1, _b));
+                    _mm256_storeu_si256((__m256i*)(curr + x), d);
+                }
+            }
+            if (x < width)
+                Base::DistanceChamferVert(row1 + x, row2 ? row2 + x : NULL, curr + x, width - x, a, b, c);
+        }
+
+        void DistanceTransform(const uint8_t * mask, size_t maskStride, size_t width, size_t height, uint8_t index, SimdDistanceType type,
+            uint8_t * dst, size_t dstStride, SimdPixelFormatType dstFormat)
+        {
+            Base::DistanceTransformRun(mask, maskStride, width, height, index, type, dst, dstStride, dstFormat, DistanceColDown, DistanceColUp, DistanceChamferVert);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
@@ -24,6 +24,7 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdStore.h"
 #include "Simd/SimdCompare.h"
+#include "Simd/SimdHistogram.h"
 
 namespace Simd
 {
@@ -184,17 +185,32 @@ namespace Simd
             SumHistograms(buffer.h[0], 8, histogram);
         }
 
-        void HistogramMasked(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        static void HistogramMaskedRows(const uint8_t * src, size_t srcStride, size_t width, size_t height,
             const uint8_t * mask, size_t maskStride, uint8_t index, uint32_t * histogram)
         {
-            assert(width >= A);
-
             if (Aligned(src) && Aligned(srcStride) && Aligned(mask) && Aligned(maskStride))
                 HistogramMasked<true>(src, srcStride, width, height, mask, maskStride, index, histogram);
             else
                 HistogramMasked<false>(src, srcStride, width, height, mask, maskStride, index, histogram);
         }
 
+        void HistogramMasked(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            const uint8_t * mask, size_t maskStride, uint8_t index, uint32_t * histogram)
+        {
+            assert(width >= A);
+
+            size_t threadNumber = Base::HistogramThreadNumber(width, height);
+            if (threadNumber > 1)
+            {
+                Base::HistogramParallel(height, threadNumber, histogram, [&](size_t begin, size_t end, uint32_t * h)
+                {
+                    HistogramMaskedRows(src + begin * srcStride, srcStride, width, end - begin, mask + begin * maskStride, maskStride, index, h);
+                });
+            }
+            else
+                HistogramMaskedRows(src, srcStride, width, height, mask, maskStride, index, histogram);
+        }
+
         template <SimdCompareType compareType, bool srcAlign, bool dstAlign>
         SIMD_INLINE void ConditionalSrc(const uint8_t * src, const uint8_t * mask, const __m256i & value, ptrdiff_t offset, uint16_t * dst)
         {
@@ -275,6 +291,45 @@ namespace Simd
                 assert(0);
             }
         }
+
+        //-----------------------------------------------------------------------------------------
+
+        SIMD_INLINE __m256i ClaheLerp(const uint8_t * lut, __m256i i0, __m256i i1, __m256i w)
+        {
+            const __m256i k = _mm256_set1_epi32(0xFF);
+            __m256i v0 = _mm256_and_si256(_mm256_i32gather_epi32((int*)lut, i0, 1), k);
+            __m256i v1 = _mm256_and_si256(_mm256_i32gather_epi32((int*)lut, i1, 1), k);
+            return _mm256_madd_epi16(_mm256_or_si256(v0, _mm256_slli_epi32(v1, 16)), w);
+        }
+
+        void ClaheRow(const uint8_t * src, size_t width, const uint8_t * lut0, const uint8_t * lut1,
+            const int32_t * ix0, const int32_t * ix1, const int32_t * wx, int32_t wy, uint8_t * dst)
+        {
+            const __m256i _wy = _mm256_set1_epi32(wy);
+            const __m256i round = _mm256_set1_epi32(Base::CLAHE_ROUND);
+            size_t width8 = AlignLo(width, 8), col = 0;
+            for (; col < width8; col += 8)
+            {
+                __m256i _src = _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(src + col)));
+                __m256i i0 = _mm256_add_epi32(_mm256_loadu_si256((__m256i*)(ix0 + col)), _src);
+                __m256i i1 = _mm256_add_epi32(_mm256_loadu_si256((__m256i*)(ix1 + col)), _src);
+                __m256i w = _mm256_loadu_si256((__m256i*)(wx + col));
+                __m256i top = ClaheLerp(lut0, i0, i1, w);
+                __m256i bottom = ClaheLerp(lut1, i0, i1, w);
+                __m256i sum = _mm256_add_epi32(_mm256_slli_epi32(top, Base::CLAHE_SHIFT), 
+                    _mm256_mullo_epi32(_mm256_sub_epi32(bottom, top), _wy));
+                __m256i res = _mm256_srli_epi32(_mm256_add_epi32(sum, round), 2 * Base::CLAHE_SHIFT);
+                res = _mm256_packus_epi16(_mm256_packs_epi32(res, K_ZERO), K_ZERO);
+                _mm_storel_epi64((__m128i*)(dst + col), _mm_unpacklo_epi32(_mm256_castsi256_si128(res), _mm256_extracti128_si256(res, 1)));
+            }
+            if (col < width)
+                Base::ClaheRow(src + col, width - col, lut0, lut1, ix0 + col, ix1 + col, wx + col, wy, dst + col);
+        }
+
+        void Clahe(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t tilesX, size_t tilesY, float clipLimit, uint8_t * dst, size_t dstStride)
+        {
+            Base::ClaheRun(src, srcStride, width, height, tilesX, tilesY, clipLimit, dst, dstStride, ClaheRow);
+        }
     }
 #endif// SIMD_AVX2_ENABLE
 }
@@ -0,0 +1,133 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdLucasKanade.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE __m256 LoadF8(const uint8_t * src)
+        {
+            return _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)src)));
+        }
+
+        void LucasKanadeSample(const uint8_t * src, size_t stride, size_t width, size_t height, const float * weights, float * dst)
+        {
+            size_t width8 = AlignLo(width, 8);
+            __m256 w0 = _mm256_set1_ps(weights[0]), w1 = _mm256_set1_ps(weights[1]);
+            __m256 w2 = _mm256_set1_ps(weights[2]), w3 = _mm256_set1_ps(weights[3]);
+            for (size_t y = 0; y < height; ++y)
+            {
+                const uint8_t * s0 = src + y * stride, * s1 = s0 + stride;
+                size_t x = 0;
+                for (; x < width8; x += 8)
+                {
+                    __m256 top = _mm256_add_ps(_mm256_mul_ps(LoadF8(s0 + x), w0), _mm256_mul_ps(LoadF8(s0 + x + 1), w1));
+                    __m256 bottom = _mm256_add_ps(_mm256_mul_ps(LoadF8(s1 + x), w2), _mm256_mul_ps(LoadF8(s1 + x + 1), w3));
+                    _mm256_storeu_ps(dst + x, _mm256_add_ps(top, bottom));
+                }
+                for (; x < width; ++x)
+                    dst[x] = weights[0] * s0[x] + weights[1] * s0[x + 1] + weights[2] * s1[x] + weights[3] * s1[x + 1];
+                dst += width;
+            }
+        }
+
+        void LucasKanadeGradient(const float * patch, size_t size, float * dx, float * dy, float * hessian)
+        {
+            const size_t stride = size + 2, size8 = AlignLo(size, 8);
+            const __m256 _half = _mm256_set1_ps(0.5f);
+            __m256 _xx = _mm256_setzero_ps(), _xy = _mm256_setzero_ps(), _yy = _mm256_setzero_ps();
+            float xx = 0, xy = 0, yy = 0;
+            for (size_t y = 0; y < size; ++y)
+            {
+                const float * p0 = patch + y * stride, * p1 = p0 + stride, * p2 = p1 + stride;
+                size_t x = 0;
+                for (; x < size8; x += 8)
+                {
+                    __m256 gx = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(p1 + x + 2), _mm256_loadu_ps(p1 + x)), _half);
+                    __m256 gy = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(p2 + x + 1), _mm256_loadu_ps(p0 + x + 1)), _half);
+                    _xx = _mm256_add_ps(_xx, _mm256_mul_ps(gx, gx));
+                    _xy = _mm256_add_ps(_xy, _mm256_mul_ps(gx, gy));
+                    _yy = _mm256_add_ps(_yy, _mm256_mul_ps(gy, gy));
+                    _mm256_storeu_ps(dx + x, gx);
+                    _mm256_storeu_ps(dy + x, gy);
+                }
+                for (; x < size; ++x)
+                {
+                    float gx = (p1[x + 2] - p1[x]) * 0.5f;
+                    float gy = (p2[x + 1] - p0[x + 1]) * 0.5f;
+                    xx += gx * gx;
+                    xy += gx * gy;
+                    yy += gy * gy;
+                    dx[x] = gx;
+                    dy[x] = gy;
+                }
+                dx += size;
+                dy += size;
+            }
+            hessian[0] = xx + Avx::ExtractSum(_xx);
+            hessian[1] = xy + Avx::ExtractSum(_xy);
+            hessian[2] = yy + Avx::ExtractSum(_yy);
+        }
+
+        void LucasKanadeMismatch(const float * prev, const float * next, const float * dx, const float * dy, size_t count, float * sums)
+        {
+            size_t count8 = AlignLo(count, 8), i = 0;
+            const __m256 sign = _mm256_set1_ps(-0.0f);
+            __m256 _bx = _mm256_setzero_ps(), _by = _mm256_setzero_ps(), _err = _mm256_setzero_ps();
+            for (; i < count8; i += 8)
+            {
+                __m256 diff = _mm256_sub_ps(_mm256_loadu_ps(next + i), _mm256_loadu_ps(prev + i));
+                _bx = _mm256_add_ps(_bx, _mm256_mul_ps(diff, _mm256_loadu_ps(dx + i)));
+                _by = _mm256_add_ps(_by, _mm256_mul_ps(diff, _mm256_loadu_ps(dy + i)));
+                _err = _mm256_add_ps(_err, _mm256_andnot_ps(sign, diff));
+            }
+            float bx = Avx::ExtractSum(_bx), by = Avx::ExtractSum(_by), err = Avx::ExtractSum(_err);
+            for (; i < count; ++i)
+            {
+                float diff = next[i] - prev[i];
+                bx += diff * dx[i];
+                by += diff * dy[i];
+                err += ::fabs(diff);
+            }
+            sums[0] = bx;
+            sums[1] = by;
+            sums[2] = err;
+        }
+
+        void LucasKanadeTrack(const uint8_t * prev, size_t prevStride, const uint8_t * next, size_t nextStride, size_t width, size_t height,
+            const float * prevPoints, float * nextPoints, size_t count, size_t window, size_t iterations, float epsilon, float minEigen,
+            uint8_t * status, float * errors)
+        {
+            Base::LucasKanadeTrackRun(prev, prevStride, next, nextStride, width, height, prevPoints, nextPoints, count, window, iterations,
+                epsilon, minEigen, status, errors, LucasKanadeSample, LucasKanadeGradient, LucasKanadeMismatch);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
@@ -23,6 +23,7 @@
 */
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdStore.h"
+#include "Simd/SimdMedianFilter.h"
 
 namespace Simd
 {
@@ -506,6 +507,30 @@ namespace Simd
             else
                 MedianFilterSquare5x5<false>(src, srcStride, width, height, channelCount, dst, dstStride);
         }
+
+        struct MedianKernel
+        {
+            static SIMD_INLINE void Add(const uint16_t * col, uint16_t * kernel)
+            {
+                for (size_t i = 0; i < Base::MEDIAN_HIST_SIZE; i += HA)
+                    _mm256_store_si256((__m256i*)(kernel + i), _mm256_add_epi16(_mm256_load_si256((__m256i*)(kernel + i)), _mm256_load_si256((__m256i*)(col + i))));
+            }
+
+            static SIMD_INLINE void Update(const uint16_t * add, const uint16_t * sub, uint16_t * kernel)
+            {
+                for (size_t i = 0; i < Base::MEDIAN_HIST_SIZE; i += HA)
+                {
+                    __m256i delta = _mm256_sub_epi16(_mm256_load_si256((__m256i*)(add + i)), _mm256_load_si256((__m256i*)(sub + i)));
+                    _mm256_store_si256((__m256i*)(kernel + i), _mm256_add_epi16(_mm256_load_si256((__m256i*)(kernel + i)), delta));
+                }
+            }
+        };
+
+        void MedianFilterSquare(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            size_t channelCount, size_t radius, uint8_t * dst, size_t dstStride)
+        {
+            Base::MedianFilterSquareHistogram<MedianKernel>(src, srcStride, width, height, channelCount, radius, dst, dstStride);
+        }
     }
 #endif// SIMD_AVX2_ENABLE
 }
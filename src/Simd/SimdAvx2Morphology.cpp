@@ -0,0 +1,61 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMorphology.h"
+#include "Simd/SimdMemory.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        template<bool max> SIMD_INLINE void MorphologyRow(const uint8_t * a, const uint8_t * b, uint8_t * dst)
+        {
+            __m256i _a = _mm256_loadu_si256((__m256i*)a);
+            __m256i _b = _mm256_loadu_si256((__m256i*)b);
+            _mm256_storeu_si256((__m256i*)dst, max ? _mm256_max_epu8(_a, _b) : _mm256_min_epu8(_a, _b));
+        }
+
+        template<bool max> void MorphologyRow(const uint8_t * a, const uint8_t * b, size_t size, uint8_t * dst)
+        {
+            if (size < A)
+            {
+                for (size_t i = 0; i < size; ++i)
+                    dst[i] = max ? Simd::Max(a[i], b[i]) : Simd::Min(a[i], b[i]);
+                return;
+            }
+            size_t sizeA = AlignLo(size, A);
+            for (size_t i = 0; i < sizeA; i += A)
+                MorphologyRow<max>(a + i, b + i, dst + i);
+            if (sizeA != size)
+                MorphologyRow<max>(a + size - A, b + size - A, dst + size - A);
+        }
+
+        void Morphology(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount,
+            size_t radiusX, size_t radiusY, SimdMorphologyType type, uint8_t * dst, size_t dstStride)
+        {
+            Base::Morphology(src, srcStride, width, height, channelCount, radiusX, radiusY, type, dst, dstStride, MorphologyRow<false>, MorphologyRow<true>);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
@@ -0,0 +1,61 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdNonMaxSuppression.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        void NonMaxSuppressionIou(const float * x1, const float * y1, const float * x2, const float * y2, const float * area,
+            size_t count, const float * box, float * iou)
+        {
+            size_t count8 = AlignLo(count, 8);
+            __m256 bx1 = _mm256_set1_ps(box[0]), by1 = _mm256_set1_ps(box[1]);
+            __m256 bx2 = _mm256_set1_ps(box[2]), by2 = _mm256_set1_ps(box[3]);
+            __m256 barea = _mm256_set1_ps(box[4]), zero = _mm256_setzero_ps();
+            size_t i = 0;
+            for (; i < count8; i += 8)
+            {
+                __m256 w = _mm256_max_ps(_mm256_sub_ps(_mm256_min_ps(bx2, _mm256_loadu_ps(x2 + i)), _mm256_max_ps(bx1, _mm256_loadu_ps(x1 + i))), zero);
+                __m256 h = _mm256_max_ps(_mm256_sub_ps(_mm256_min_ps(by2, _mm256_loadu_ps(y2 + i)), _mm256_max_ps(by1, _mm256_loadu_ps(y1 + i))), zero);
+                __m256 inter = _mm256_mul_ps(w, h);
+                __m256 union_ = _mm256_sub_ps(_mm256_add_ps(barea, _mm256_loadu_ps(area + i)), inter);
+                __m256 valid = _mm256_cmp_ps(union_, zero, _CMP_GT_OQ);
+                _mm256_storeu_ps(iou + i, _mm256_and_ps(_mm256_div_ps(inter, union_), valid));
+            }
+            for (; i < count; ++i)
+                iou[i] = Base::NonMaxSuppressionIou(x1[i], y1[i], x2[i], y2[i], area[i], box);
+        }
+
+        size_t NonMaxSuppression32f(const float * boxes, float * scores, size_t count, SimdNonMaxSuppressionType type,
+            float iouThreshold, float sigma, float scoreThreshold, size_t * indices)
+        {
+            return Base::NonMaxSuppressionRun(boxes, scores, count, type, iouThreshold, sigma, scoreThreshold, indices, NonMaxSuppressionIou);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
@@ -24,6 +24,7 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdStore.h"
 #include "Simd/SimdCompare.h"
+#include "Simd/SimdSegmentation.h"
 
 namespace Simd
 {
@@ -277,6 +278,49 @@ namespace Simd
                 }
             }
         }
+
+        //-----------------------------------------------------------------------------------------
+
+        size_t LabelRowRuns(const uint8_t * mask, size_t width, uint8_t index, int32_t * runs)
+        {
+            const __m256i _index = _mm256_set1_epi8(index);
+            size_t widthA = AlignLo(width, A), count = 0, col = 0;
+            uint32_t inside = 0;
+            for (; col < widthA; col += A)
+            {
+                uint32_t bits = _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i*)(mask + col)), _index));
+                uint32_t edges = bits ^ ((bits << 1) | inside);
+                inside = bits >> 31;
+                while (edges)
+                {
+                    runs[count] = int32_t(col + _tzcnt_u32(edges));
+                    count++;
+                    edges &= edges - 1;
+                }
+            }
+            for (; col < width; ++col)
+            {
+                uint32_t bit = mask[col] == index ? 1 : 0;
+                if (bit != inside)
+                {
+                    runs[count] = int32_t(col);
+                    count++;
+                    inside = bit;
+                }
+            }
+            if (inside)
+            {
+                runs[count] = int32_t(width);
+                count++;
+            }
+            return count / 2;
+        }
+
+        size_t SegmentationLabelComponents(const uint8_t * mask, size_t maskStride, size_t width, size_t height, uint8_t index, SimdConnectivityType connectivity,
+            uint32_t * labels, size_t labelsStride, SimdConnectedComponent * components, size_t capacity)
+        {
+            return Base::LabelComponentsRun(mask, maskStride, width, height, index, connectivity, labels, labelsStride, components, capacity, LabelRowRuns);
+        }
     }
 #endif//SIMD_AVX2_ENABLE
 }
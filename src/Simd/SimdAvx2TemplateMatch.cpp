@@ -0,0 +1,74 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdTemplateMatch.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE void TemplateMatchDot16(const uint8_t * src, __m256i weight, bool single, __m256i & lo, __m256i & hi)
+        {
+            __m256i s0 = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)src));
+            __m256i s1 = single ? s0 : _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(src + 1)));
+            lo = _mm256_add_epi32(lo, _mm256_madd_epi16(_mm256_unpacklo_epi16(s0, s1), weight));
+            hi = _mm256_add_epi32(hi, _mm256_madd_epi16(_mm256_unpackhi_epi16(s0, s1), weight));
+        }
+
+        void TemplateMatchDot(const uint8_t * src, size_t srcStride, const uint8_t * tmpl, size_t tmplStride,
+            size_t tmplWidth, size_t tmplHeight, size_t width, int32_t * dot)
+        {
+            size_t width16 = AlignLo(width, 16), tmplWidth2 = AlignLo(tmplWidth, 2), x = 0;
+            for (; x < width16; x += 16)
+            {
+                __m256i lo = _mm256_setzero_si256(), hi = _mm256_setzero_si256();
+                for (size_t ty = 0; ty < tmplHeight; ++ty)
+                {
+                    const uint8_t * s = src + ty * srcStride + x;
+                    const uint8_t * t = tmpl + ty * tmplStride;
+                    size_t tx = 0;
+                    for (; tx < tmplWidth2; tx += 2)
+                        TemplateMatchDot16(s + tx, _mm256_set1_epi32(t[tx] | (t[tx + 1] << 16)), false, lo, hi);
+                    if (tx < tmplWidth)
+                        TemplateMatchDot16(s + tx, _mm256_set1_epi32(t[tx]), true, lo, hi);
+                }
+                _mm256_storeu_si256((__m256i*)(dot + x + 0), _mm256_permute2x128_si256(lo, hi, 0x20));
+                _mm256_storeu_si256((__m256i*)(dot + x + 8), _mm256_permute2x128_si256(lo, hi, 0x31));
+            }
+            if (x < width)
+                Base::TemplateMatchDot(src + x, srcStride, tmpl, tmplStride, tmplWidth, tmplHeight, width - x, dot + x);
+        }
+
+        void TemplateMatch(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const uint8_t * tmpl, size_t tmplStride,
+            size_t tmplWidth, size_t tmplHeight, SimdTemplateMatchType type, float * dst, size_t dstStride)
+        {
+            Base::TemplateMatchRun(src, srcStride, srcWidth, srcHeight, tmpl, tmplStride, tmplWidth, tmplHeight, type, dst, dstStride, TemplateMatchDot);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
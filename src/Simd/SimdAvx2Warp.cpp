@@ -0,0 +1,345 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdWarp.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE __m256i WarpFixed(__m256 value, __m256 max)
+        {
+            value = _mm256_min_ps(_mm256_max_ps(value, _mm256_set1_ps(-2.0f)), max);
+            __m256 fixed = _mm256_add_ps(_mm256_mul_ps(value, _mm256_set1_ps(float(WARP_RANGE))), _mm256_set1_ps(WARP_OFFSET));
+            return _mm256_sub_epi32(_mm256_cvttps_epi32(fixed), _mm256_set1_epi32((int32_t)WARP_OFFSET));
+        }
+
+        template<bool perspective> SIMD_INLINE void WarpCoords(const float * mx, const float * my, const float * mw,
+            __m256 rx, __m256 ry, __m256 rw, __m256 maxX, __m256 maxY, size_t x, int32_t * sx, int32_t * sy)
+        {
+            __m256 _x = _mm256_add_ps(_mm256_loadu_ps(mx + x), rx);
+            __m256 _y = _mm256_add_ps(_mm256_loadu_ps(my + x), ry);
+            if (perspective)
+            {
+                __m256 _w = _mm256_add_ps(_mm256_loadu_ps(mw + x), rw);
+                _x = _mm256_div_ps(_x, _w);
+                _y = _mm256_div_ps(_y, _w);
+            }
+            _mm256_storeu_si256((__m256i*)(sx + x), WarpFixed(_x, maxX));
+            _mm256_storeu_si256((__m256i*)(sy + x), WarpFixed(_y, maxY));
+        }
+
+        template<bool perspective> void WarpCoords(const float * mx, const float * my, const float * mw, float rx, float ry, float rw,
+            float maxX, float maxY, size_t width, int32_t * sx, int32_t * sy)
+        {
+            if (width < F)
+            {
+                if (perspective)
+                    Sse2::WarpCoordsPerspective(mx, my, mw, rx, ry, rw, maxX, maxY, width, sx, sy);
+                else
+                    Sse2::WarpCoordsAffine(mx, my, mw, rx, ry, rw, maxX, maxY, width, sx, sy);
+                return;
+            }
+            __m256 _rx = _mm256_set1_ps(rx), _ry = _mm256_set1_ps(ry), _rw = _mm256_set1_ps(rw);
+            __m256 _maxX = _mm256_set1_ps(maxX), _maxY = _mm256_set1_ps(maxY);
+            size_t widthF = AlignLo(width, F);
+            for (size_t x = 0; x < widthF; x += F)
+                WarpCoords<perspective>(mx, my, mw, _rx, _ry, _rw, _maxX, _maxY, x, sx, sy);
+            if (widthF != width)
+                WarpCoords<perspective>(mx, my, mw, _rx, _ry, _rw, _maxX, _maxY, width - F, sx, sy);
+        }
+
+        void WarpCoordsAffine(const float * mx, const float * my, const float * mw, float rx, float ry, float rw,
+            float maxX, float maxY, size_t width, int32_t * sx, int32_t * sy)
+        {
+            WarpCoords<false>(mx, my, mw, rx, ry, rw, maxX, maxY, width, sx, sy);
+        }
+
+        void WarpCoordsPerspective(const float * mx, const float * my, const float * mw, float rx, float ry, float rw,
+            float maxX, float maxY, size_t width, int32_t * sx, int32_t * sy)
+        {
+            WarpCoords<true>(mx, my, mw, rx, ry, rw, maxX, maxY, width, sx, sy);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE bool WarpInside(__m256i ix, __m256i iy, __m256i maxX, __m256i maxY)
+        {
+            __m256i outside = _mm256_or_si256(_mm256_or_si256(_mm256_cmpgt_epi32(K_ZERO, ix), _mm256_cmpgt_epi32(ix, maxX)),
+                _mm256_or_si256(_mm256_cmpgt_epi32(K_ZERO, iy), _mm256_cmpgt_epi32(iy, maxY)));
+            return _mm256_testz_si256(outside, outside) != 0;
+        }
+
+        template<size_t N> SIMD_INLINE __m256i WarpPair(__m256i p0, __m256i p1, size_t c)
+        {
+            const __m256i K32_00FF = _mm256_set1_epi32(0xFF);
+            __m256i lo = _mm256_and_si256(_mm256_srl_epi32(p0, _mm_cvtsi32_si128(int(8 * c))), K32_00FF);
+            __m256i hi = N <= 2 ? _mm256_srl_epi32(p0, _mm_cvtsi32_si128(int(8 * (c + N)))) : _mm256_srl_epi32(p1, _mm_cvtsi32_si128(int(8 * c)));
+            return _mm256_or_si256(lo, _mm256_slli_epi32(_mm256_and_si256(hi, K32_00FF), 16));
+        }
+
+        template<size_t N> SIMD_INLINE void WarpStore(__m256i value, uint8_t * dst)
+        {
+            if (N == 1)
+            {
+                __m256i u8 = _mm256_packus_epi16(_mm256_packus_epi32(value, K_ZERO), K_ZERO);
+                *(int32_t*)(dst + 0) = _mm_cvtsi128_si32(_mm256_castsi256_si128(u8));
+                *(int32_t*)(dst + 4) = _mm_cvtsi128_si32(_mm256_extracti128_si256(u8, 1));
+            }
+            else if (N == 2)
+            {
+                __m256i u16 = _mm256_packus_epi32(value, K_ZERO);
+                _mm_storel_epi64((__m128i*)(dst + 0), _mm256_castsi256_si128(u16));
+                _mm_storel_epi64((__m128i*)(dst + 8), _mm256_extracti128_si256(u16, 1));
+            }
+            else if (N == 3)
+            {
+                SIMD_ALIGNED(32) uint32_t buf[8];
+                _mm256_store_si256((__m256i*)buf, value);
+                for (size_t i = 0; i < 8; ++i, dst += 3)
+                {
+                    dst[0] = uint8_t(buf[i]);
+                    dst[1] = uint8_t(buf[i] >> 8);
+                    dst[2] = uint8_t(buf[i] >> 16);
+                }
+            }
+            else
+                _mm256_storeu_si256((__m256i*)dst, value);
+        }
+
+        template<size_t N> void WarpKernelBilinearByte(const WarpParam & p, const uint8_t * src, size_t srcStride, const int32_t * sx, const int32_t * sy, uint8_t * dst)
+        {
+            const ptrdiff_t size = N <= 2 ? 4 : N + 4, width = p.srcW * N;
+            ptrdiff_t maxX = width < size ? -1 : Simd::Min<ptrdiff_t>(p.srcW - 2, (width - size) / N), maxY = p.srcH - 2;
+            size_t dstW8 = maxX >= 0 && maxY >= 0 ? AlignLo(p.dstW, 8) : 0, x = 0;
+            __m256i _maxX = _mm256_set1_epi32((int32_t)maxX), _maxY = _mm256_set1_epi32((int32_t)maxY);
+            __m256i _stride = _mm256_set1_epi32((int32_t)srcStride), _channels = _mm256_set1_epi32((int32_t)N);
+            __m256i _range = _mm256_set1_epi32(WARP_RANGE), _mask = _mm256_set1_epi32(WARP_MASK), _round = _mm256_set1_epi32(WARP_ROUND);
+            for (; x < dstW8; x += 8)
+            {
+                __m256i _sx = _mm256_loadu_si256((__m256i*)(sx + x));
+                __m256i _sy = _mm256_loadu_si256((__m256i*)(sy + x));
+                __m256i ix = _mm256_srai_epi32(_sx, WARP_BITS);
+                __m256i iy = _mm256_srai_epi32(_sy, WARP_BITS);
+                if (!WarpInside(ix, iy, _maxX, _maxY))
+                {
+                    for (size_t i = x, n = x + 8; i < n; ++i)
+                        Base::WarpBilinearPixel<uint8_t, N>(p, src, srcStride, sx[i], sy[i], dst + i * N);
+                    continue;
+                }
+                __m256i offs = _mm256_add_epi32(_mm256_mullo_epi32(iy, _stride), _mm256_mullo_epi32(ix, _channels));
+                __m256i fx = _mm256_and_si256(_sx, _mask);
+                __m256i fy = _mm256_and_si256(_sy, _mask);
+                __m256i wx = _mm256_or_si256(_mm256_sub_epi32(_range, fx), _mm256_slli_epi32(fx, 16));
+                __m256i wy = _mm256_sub_epi32(_range, fy);
+                __m256i p00 = _mm256_i32gather_epi32((int*)src, offs, 1);
+                __m256i p10 = _mm256_i32gather_epi32((int*)(src + srcStride), offs, 1);
+                __m256i p01 = N <= 2 ? p00 : _mm256_i32gather_epi32((int*)(src + N), offs, 1);
+                __m256i p11 = N <= 2 ? p10 : _mm256_i32gather_epi32((int*)(src + srcStride + N), offs, 1);
+                __m256i value = K_ZERO;
+                for (size_t c = 0; c < N; ++c)
+                {
+                    __m256i r0 = _mm256_madd_epi16(WarpPair<N>(p00, p01, c), wx);
+                    __m256i r1 = _mm256_madd_epi16(WarpPair<N>(p10, p11, c), wx);
+                    __m256i r = _mm256_add_epi32(_mm256_add_epi32(_mm256_mullo_epi32(r0, wy), _mm256_mullo_epi32(r1, fy)), _round);
+                    value = _mm256_or_si256(value, _mm256_sll_epi32(_mm256_srli_epi32(r, 2 * WARP_BITS), _mm_cvtsi32_si128(int(8 * c))));
+                }
+                WarpStore<N>(value, dst + x * N);
+            }
+            for (; x < p.dstW; ++x)
+                Base::WarpBilinearPixel<uint8_t, N>(p, src, srcStride, sx[x], sy[x], dst + x * N);
+        }
+
+        // Border and tail pixels use the same fused operations as the vector kernel below, so results are bit-exact.
+        struct WarpBilinearInterp
+        {
+            static SIMD_INLINE float Run(float p00, float p01, float p10, float p11, float fx, float fy)
+            {
+                __m128 _fx = _mm_set_ss(fx), _fy = _mm_set_ss(fy), _1 = _mm_set_ss(1.0f);
+                __m128 gx = _mm_sub_ss(_1, _fx), gy = _mm_sub_ss(_1, _fy);
+                __m128 r0 = _mm_fmadd_ss(_mm_set_ss(p01), _fx, _mm_mul_ss(_mm_set_ss(p00), gx));
+                __m128 r1 = _mm_fmadd_ss(_mm_set_ss(p11), _fx, _mm_mul_ss(_mm_set_ss(p10), gx));
+                return _mm_cvtss_f32(_mm_fmadd_ss(r1, _fy, _mm_mul_ss(r0, gy)));
+            }
+        };
+
+        template<size_t N> void WarpKernelBilinearFloat(const WarpParam & p, const uint8_t * src8, size_t srcStride, const int32_t * sx, const int32_t * sy, uint8_t * dst8)
+        {
+            const float * src = (const float*)src8;
+            float * dst = (float*)dst8;
+            srcStride /= sizeof(float);
+            ptrdiff_t maxX = p.srcW - 2, maxY = p.srcH - 2;
+            size_t dstW8 = maxX >= 0 && maxY >= 0 ? AlignLo(p.dstW, 8) : 0, x = 0;
+            __m256i _maxX = _mm256_set1_epi32((int32_t)maxX), _maxY = _mm256_set1_epi32((int32_t)maxY);
+            __m256i _stride = _mm256_set1_epi32((int32_t)srcStride), _channels = _mm256_set1_epi32((int32_t)N), _mask = _mm256_set1_epi32(WARP_MASK);
+            __m256 _1 = _mm256_set1_ps(1.0f), _scale = _mm256_set1_ps(1.0f / WARP_RANGE);
+            for (; x < dstW8; x += 8)
+            {
+                __m256i _sx = _mm256_loadu_si256((__m256i*)(sx + x));
+                __m256i _sy = _mm256_loadu_si256((__m256i*)(sy + x));
+                __m256i ix = _mm256_srai_epi32(_sx, WARP_BITS);
+                __m256i iy = _mm256_srai_epi32(_sy, WARP_BITS);
+                if (!WarpInside(ix, iy, _maxX, _maxY))
+                {
+                    for (size_t i = x, n = x + 8; i < n; ++i)
+                        Base::WarpBilinearPixel<float, N, WarpBilinearInterp>(p, src, srcStride, sx[i], sy[i], dst + i * N);
+                    continue;
+                }
+                __m256i offs = _mm256_add_epi32(_mm256_mullo_epi32(iy, _stride), _mm256_mullo_epi32(ix, _channels));
+                __m256 fx = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_and_si256(_sx, _mask)), _scale);
+                __m256 fy = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_and_si256(_sy, _mask)), _scale);
+                __m256 gx = _mm256_sub_ps(_1, fx), gy = _mm256_sub_ps(_1, fy);
+                SIMD_ALIGNED(32) float buf[N][8];
+                for (size_t c = 0; c < N; ++c)
+                {
+                    __m256 p00 = _mm256_i32gather_ps(src + c, offs, 4);
+                    __m256 p01 = _mm256_i32gather_ps(src + c + N, offs, 4);
+                    __m256 p10 = _mm256_i32gather_ps(src + c + srcStride, offs, 4);
+                    __m256 p11 = _mm256_i32gather_ps(src + c + srcStride + N, offs, 4);
+                    __m256 r0 = _mm256_fmadd_ps(p01, fx, _mm256_mul_ps(p00, gx));
+                    __m256 r1 = _mm256_fmadd_ps(p11, fx, _mm256_mul_ps(p10, gx));
+                    __m256 r = _mm256_fmadd_ps(r1, fy, _mm256_mul_ps(r0, gy));
+                    if (N == 1)
+                        _mm256_storeu_ps(dst + x, r);
+                    else
+                        _mm256_store_ps(buf[c], r);
+                }
+                if (N != 1)
+                {
+                    for (size_t i = 0; i < 8; ++i)
+                        for (size_t c = 0; c < N; ++c)
+                            dst[(x + i) * N + c] = buf[c][i];
+                }
+            }
+            for (; x < p.dstW; ++x)
+                Base::WarpBilinearPixel<float, N, WarpBilinearInterp>(p, src, srcStride, sx[x], sy[x], dst + x * N);
+        }
+
+        template<class T> Base::WarpKernelPtr GetWarpKernelBilinear(size_t channels)
+        {
+            switch (channels)
+            {
+            case 1: return sizeof(T) == 1 ? WarpKernelBilinearByte<1> : WarpKernelBilinearFloat<1>;
+            case 2: return sizeof(T) == 1 ? WarpKernelBilinearByte<2> : WarpKernelBilinearFloat<2>;
+            case 3: return sizeof(T) == 1 ? WarpKernelBilinearByte<3> : WarpKernelBilinearFloat<3>;
+            case 4: return sizeof(T) == 1 ? WarpKernelBilinearByte<4> : WarpKernelBilinearFloat<4>;
+            }
+            return NULL;
+        }
+
+        Base::WarpKernelPtr GetWarpKernel(const WarpParam & p)
+        {
+            if (p.interp == SimdWarpInterpBilinear)
+                return p.type == SimdResizeChannelFloat ? GetWarpKernelBilinear<float>(p.channels) : GetWarpKernelBilinear<uint8_t>(p.channels);
+            return Base::GetWarpKernel(p);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void RemapPackMap(const int32_t * sx, const int32_t * sy, size_t x, size_t width, int16_t * map)
+        {
+            __m256i _mask = _mm256_set1_epi32(WARP_MASK);
+            __m256i sx0 = _mm256_loadu_si256((__m256i*)(sx + x + 0));
+            __m256i sx1 = _mm256_loadu_si256((__m256i*)(sx + x + F));
+            __m256i sy0 = _mm256_loadu_si256((__m256i*)(sy + x + 0));
+            __m256i sy1 = _mm256_loadu_si256((__m256i*)(sy + x + F));
+            _mm256_storeu_si256((__m256i*)(map + x), PackI32ToI16(_mm256_srai_epi32(sx0, WARP_BITS), _mm256_srai_epi32(sx1, WARP_BITS)));
+            _mm256_storeu_si256((__m256i*)(map + width + x), PackI32ToI16(_mm256_srai_epi32(sy0, WARP_BITS), _mm256_srai_epi32(sy1, WARP_BITS)));
+            __m256i fx = PackI32ToI16(_mm256_and_si256(sx0, _mask), _mm256_and_si256(sx1, _mask));
+            __m256i fy = PackI32ToI16(_mm256_and_si256(sy0, _mask), _mm256_and_si256(sy1, _mask));
+            _mm256_storeu_si256((__m256i*)(map + 2 * width + x), _mm256_or_si256(fx, _mm256_slli_epi16(fy, WARP_BITS)));
+        }
+
+        void RemapPackMap(const int32_t * sx, const int32_t * sy, size_t width, int16_t * map)
+        {
+            if (width < DF)
+            {
+                Base::RemapPackMap(sx, sy, width, map);
+                return;
+            }
+            size_t widthDF = AlignLo(width, DF);
+            for (size_t x = 0; x < widthDF; x += DF)
+                RemapPackMap(sx, sy, x, width, map);
+            if (widthDF != width)
+                RemapPackMap(sx, sy, width - DF, width, map);
+        }
+
+        void RemapConvertMap(const float * mapX, size_t mapXStride, const float * mapY, size_t mapYStride, size_t width, size_t height,
+            size_t srcWidth, size_t srcHeight, int16_t * map, size_t mapStride)
+        {
+            assert(srcWidth < INT16_MAX && srcHeight < INT16_MAX);
+            float maxX = float(srcWidth + 1), maxY = float(srcHeight + 1);
+            Array32i sx(width), sy(width);
+            for (size_t y = 0; y < height; ++y)
+            {
+                WarpCoordsAffine(mapX, mapY, NULL, 0.0f, 0.0f, 0.0f, maxX, maxY, width, sx.data, sy.data);
+                RemapPackMap(sx.data, sy.data, width, (int16_t*)((uint8_t*)map + y * mapStride));
+                mapX = (const float*)((const uint8_t*)mapX + mapXStride);
+                mapY = (const float*)((const uint8_t*)mapY + mapYStride);
+            }
+        }
+
+        void RemapBilinear(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t channelCount, const int16_t * map, size_t mapStride,
+            size_t width, size_t height, SimdWarpBorderType border, const uint8_t * value, uint8_t * dst, size_t dstStride)
+        {
+            WarpParam param(srcWidth, srcHeight, width, height, channelCount, SimdResizeChannelByte, SimdWarpInterpBilinear, border, value);
+            assert(param.Valid());
+            Base::Remap(param, src, srcStride, map, mapStride, dst, dstStride, GetWarpKernel(param));
+        }
+
+        void RemapBilinearYuv420p(const uint8_t * srcY, size_t srcYStride, const uint8_t * srcU, size_t srcUStride, const uint8_t * srcV, size_t srcVStride,
+            size_t srcWidth, size_t srcHeight, const int16_t * map, size_t mapStride, size_t width, size_t height, SimdWarpBorderType border, const uint8_t * value,
+            uint8_t * dstY, size_t dstYStride, uint8_t * dstU, size_t dstUStride, uint8_t * dstV, size_t dstVStride)
+        {
+            assert((srcWidth % 2 == 0) && (srcHeight % 2 == 0) && (width % 2 == 0) && (height % 2 == 0) && srcWidth && srcHeight && width && height);
+            Base::WarpKernelPtr kernel = GetWarpKernel(WarpParam(srcWidth, srcHeight, width, height, 1, SimdResizeChannelByte, SimdWarpInterpBilinear, border, value));
+            Base::RemapYuv420p(srcY, srcYStride, srcU, srcUStride, srcV, srcVStride, srcWidth, srcHeight, map, mapStride, width, height, border, value,
+                dstY, dstYStride, dstU, dstUStride, dstV, dstVStride, kernel, kernel);
+        }
+
+        //---------------------------------------------------------------------
+
+        WarperCommon::WarperCommon(const WarpParam & param)
+            : Sse2::WarperCommon(param)
+        {
+            _coords = _param.transform == SimdWarpTransformPerspective ? WarpCoordsPerspective : WarpCoordsAffine;
+            _kernel = GetWarpKernel(_param);
+        }
+
+        //---------------------------------------------------------------------
+
+        void * WarpInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type,
+            const float * mat, SimdWarpTransformType transform, SimdWarpInterpType interp, SimdWarpBorderType border, const uint8_t * value)
+        {
+            WarpParam param(srcW, srcH, dstW, dstH, channels, type, mat, transform, interp, border, value);
+            if (!param.Valid())
+                return NULL;
+            return new WarperCommon(param);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
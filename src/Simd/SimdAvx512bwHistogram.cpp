@@ -24,6 +24,7 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdStore.h"
 #include "Simd/SimdCompare.h"
+#include "Simd/SimdHistogram.h"
 #include "Simd/SimdBase.h"
 
 namespace Simd
@@ -205,7 +206,7 @@ namespace Simd
             SumHistograms(buffer.h[0], F, histogram);
         }
 
-        void HistogramMasked(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        static void HistogramMaskedRows(const uint8_t * src, size_t srcStride, size_t width, size_t height,
             const uint8_t * mask, size_t maskStride, uint8_t index, uint32_t * histogram)
         {
             if (Aligned(src) && Aligned(srcStride) && Aligned(mask) && Aligned(maskStride))
@@ -214,6 +215,21 @@ namespace Simd
                 HistogramMasked<false>(src, srcStride, width, height, mask, maskStride, index, histogram);
         }
 
+        void HistogramMasked(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            const uint8_t * mask, size_t maskStride, uint8_t index, uint32_t * histogram)
+        {
+            size_t threadNumber = Base::HistogramThreadNumber(width, height);
+            if (threadNumber > 1)
+            {
+                Base::HistogramParallel(height, threadNumber, histogram, [&](size_t begin, size_t end, uint32_t * h)
+                {
+                    HistogramMaskedRows(src + begin * srcStride, srcStride, width, end - begin, mask + begin * maskStride, maskStride, index, h);
+                });
+            }
+            else
+                HistogramMaskedRows(src, srcStride, width, height, mask, maskStride, index, histogram);
+        }
+
         template <SimdCompareType compareType, bool srcAlign, bool dstAlign, bool masked>
         SIMD_INLINE void ConditionalSrc(const uint8_t * src, const uint8_t * mask, const __m512i & value, ptrdiff_t offset, uint16_t * dst, __mmask64 tail = -1)
         {
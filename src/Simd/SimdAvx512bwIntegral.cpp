@@ -78,6 +78,13 @@ namespace Simd
             if (tilted)
                 assert(tiltedStride % sizeof(uint32_t) == 0);
 
+            size_t threadNumber = Base::IntegralThreadNumber(width, height);
+            if (threadNumber > 1 && tilted == NULL)
+            {
+                Base::IntegralParallel(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, sumFormat, sqsumFormat, threadNumber);
+                return;
+            }
+
             if (sqsum)
             {
                 if (tilted)
@@ -88,6 +95,10 @@ namespace Simd
                         IntegralSumSqsumTilted<uint32_t, uint32_t>(src, srcStride, width, height,
                             (uint32_t*)sum, sumStride / sizeof(uint32_t), (uint32_t*)sqsum, sqsumStride / sizeof(uint32_t), (uint32_t*)tilted, tiltedStride / sizeof(uint32_t));
                         break;
+                    case SimdPixelFormatInt64:
+                        IntegralSumSqsumTilted<uint32_t, uint64_t>(src, srcStride, width, height,
+                            (uint32_t*)sum, sumStride / sizeof(uint32_t), (uint64_t*)sqsum, sqsumStride / sizeof(uint64_t), (uint32_t*)tilted, tiltedStride / sizeof(uint32_t));
+                        break;
                     case SimdPixelFormatDouble:
                         IntegralSumSqsumTilted<uint32_t, double>(src, srcStride, width, height,
                             (uint32_t*)sum, sumStride / sizeof(uint32_t), (double*)sqsum, sqsumStride / sizeof(double), (uint32_t*)tilted, tiltedStride / sizeof(uint32_t));
@@ -104,6 +115,10 @@ namespace Simd
                         IntegralSumSqsum<uint32_t, uint32_t>(src, srcStride, width, height,
                             (uint32_t*)sum, sumStride / sizeof(uint32_t), (uint32_t*)sqsum, sqsumStride / sizeof(uint32_t));
                         break;
+                    case SimdPixelFormatInt64:
+                        IntegralSumSqsum<uint32_t, uint64_t>(src, srcStride, width, height,
+                            (uint32_t*)sum, sumStride / sizeof(uint32_t), (uint64_t*)sqsum, sqsumStride / sizeof(uint64_t));
+                        break;
                     case SimdPixelFormatDouble:
                         IntegralSumSqsum<uint32_t, double>(src, srcStride, width, height,
                             (uint32_t*)sum, sumStride / sizeof(uint32_t), (double*)sqsum, sqsumStride / sizeof(double));
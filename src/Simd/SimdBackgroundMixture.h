@@ -0,0 +1,159 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdBackgroundMixture_h__
+#define __SimdBackgroundMixture_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    const size_t BACKGROUND_MIXTURE_GAUSSIANS_MAX = 5;
+    const size_t BACKGROUND_MIXTURE_SCALE_MAX = 8;
+    const size_t BACKGROUND_MIXTURE_BAND_MIN = 8;
+    const size_t BACKGROUND_MIXTURE_ALIGN = 16;
+    const int BACKGROUND_MIXTURE_MEAN_SHIFT = 7;
+    const int BACKGROUND_MIXTURE_VAR_SHIFT = 4;
+    const int BACKGROUND_MIXTURE_WEIGHT_MAX = 0x7FFF;
+    const int BACKGROUND_MIXTURE_DIST_MAX = 0x07FF;
+    const int BACKGROUND_MIXTURE_VAR_INIT = 15 * 15 << BACKGROUND_MIXTURE_VAR_SHIFT;
+    const int BACKGROUND_MIXTURE_VAR_MIN = 4 << BACKGROUND_MIXTURE_VAR_SHIFT;
+    const int BACKGROUND_MIXTURE_VAR_MAX = BACKGROUND_MIXTURE_DIST_MAX << BACKGROUND_MIXTURE_VAR_SHIFT;
+
+    struct BackgroundMixtureParam
+    {
+        size_t width, height, channels, gaussians, scale, align;
+        float learningRate, varianceThreshold, backgroundRatio;
+
+        // Fixed point parameters of the model (see BackgroundMixtureRow): 
+        size_t modelW, modelH, alignedW;
+        int16_t alpha;
+        uint16_t threshold, ratio;
+
+        BackgroundMixtureParam(size_t width, size_t height, size_t channels, size_t gaussians, size_t scale,
+            float learningRate, float varianceThreshold, float backgroundRatio, size_t align)
+        {
+            this->width = width;
+            this->height = height;
+            this->channels = channels;
+            this->gaussians = gaussians;
+            this->scale = scale;
+            this->align = align;
+            this->learningRate = learningRate;
+            this->varianceThreshold = varianceThreshold;
+            this->backgroundRatio = backgroundRatio;
+            this->modelW = scale ? width / scale : 0;
+            this->modelH = scale ? height / scale : 0;
+            this->alignedW = AlignHi(modelW, BACKGROUND_MIXTURE_ALIGN);
+            this->alpha = (int16_t)RestrictRange(Round(learningRate * 32768.0f), 1, BACKGROUND_MIXTURE_WEIGHT_MAX);
+            this->threshold = (uint16_t)RestrictRange(Round(varianceThreshold * 4096.0f), 1, 0xFFFF);
+            this->ratio = (uint16_t)RestrictRange(Round(backgroundRatio * 65536.0f), 1, 0xFFFF);
+        }
+
+        SIMD_INLINE bool Valid() const
+        {
+            return modelW > 0 && modelH > 0 && (channels == 1 || channels == 3) && gaussians >= 1 && gaussians <= BACKGROUND_MIXTURE_GAUSSIANS_MAX &&
+                scale >= 1 && scale <= BACKGROUND_MIXTURE_SCALE_MAX && learningRate > 0.0f && learningRate <= 1.0f &&
+                varianceThreshold > 0.0f && varianceThreshold < 16.0f && backgroundRatio > 0.0f && backgroundRatio <= 1.0f;
+        }
+
+        SIMD_INLINE size_t ModelRowSize() const
+        {
+            return gaussians * (2 + channels) * alignedW;
+        }
+    };
+
+    class BackgroundMixture : Deletable
+    {
+    public:
+        BackgroundMixture(const BackgroundMixtureParam & param)
+            : _param(param)
+        {
+        }
+
+        virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * mask, size_t maskStride) = 0;
+
+    protected:
+        BackgroundMixtureParam _param;
+    };
+
+    namespace Base
+    {
+        SIMD_INLINE int16_t BackgroundMixtureMulHrs(int a, int b)
+        {
+            return (int16_t)((a * b + 0x4000) >> 15);
+        }
+
+        SIMD_INLINE uint16_t BackgroundMixtureMulHi(int a, int b)
+        {
+            return (uint16_t)((uint32_t(uint16_t(a)) * uint32_t(uint16_t(b))) >> 16);
+        }
+
+        SIMD_INLINE uint16_t BackgroundMixtureAdds(int a, int b)
+        {
+            return (uint16_t)Simd::Min(int(uint16_t(a)) + int(uint16_t(b)), 0xFFFF);
+        }
+
+        typedef void(*BackgroundMixtureRowPtr)(const BackgroundMixtureParam & p, const uint8_t * src, int16_t * model, uint8_t * mask);
+
+        void BackgroundMixtureRow(const BackgroundMixtureParam & p, const uint8_t * src, int16_t * model, uint8_t * mask);
+
+        class BackgroundMixtureCommon : public BackgroundMixture
+        {
+        public:
+            BackgroundMixtureCommon(const BackgroundMixtureParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * mask, size_t maskStride);
+
+        protected:
+            void SetRow(const uint8_t * src, size_t srcStride, size_t y, uint8_t * dst);
+            void InitRow(const uint8_t * src, int16_t * model, uint8_t * mask);
+
+            Array16i _model;
+            bool _empty;
+            BackgroundMixtureRowPtr _row;
+        };
+
+        void * BackgroundMixtureInit(size_t width, size_t height, size_t channels, size_t gaussians, size_t scale,
+            float learningRate, float varianceThreshold, float backgroundRatio);
+    }
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        void BackgroundMixtureRow(const BackgroundMixtureParam & p, const uint8_t * src, int16_t * model, uint8_t * mask);
+
+        class BackgroundMixtureCommon : public Base::BackgroundMixtureCommon
+        {
+        public:
+            BackgroundMixtureCommon(const BackgroundMixtureParam & param);
+        };
+
+        void * BackgroundMixtureInit(size_t width, size_t height, size_t channels, size_t gaussians, size_t scale,
+            float learningRate, float varianceThreshold, float backgroundRatio);
+    }
+#endif //SIMD_AVX2_ENABLE 
+}
+
+#endif//__SimdBackgroundMixture_h__
@@ -0,0 +1,220 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdBackgroundMixture.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        template<size_t C> void BackgroundMixtureRow(const BackgroundMixtureParam & p, const uint8_t * src, int16_t * model, uint8_t * mask)
+        {
+            const size_t K = p.gaussians, W = p.alignedW, S = (2 + C) * W;
+            for (size_t x = 0; x < W; ++x)
+            {
+                int value[C], best = -1, lightest = BACKGROUND_MIXTURE_WEIGHT_MAX;
+                for (size_t c = 0; c < C; ++c)
+                    value[c] = src[c * W + x] << BACKGROUND_MIXTURE_MEAN_SHIFT;
+
+                uint16_t dist[BACKGROUND_MIXTURE_GAUSSIANS_MAX], total = 0, heavier = 0;
+                bool match[BACKGROUND_MIXTURE_GAUSSIANS_MAX], chosen[BACKGROUND_MIXTURE_GAUSSIANS_MAX], replaced[BACKGROUND_MIXTURE_GAUSSIANS_MAX];
+                for (size_t k = 0; k < K; ++k)
+                {
+                    const int16_t * g = model + k * S + x;
+                    uint16_t d = 0;
+                    for (size_t c = 0; c < C; ++c)
+                    {
+                        int diff = Abs(value[c] - g[(2 + c) * W]) << 1;
+                        d = BackgroundMixtureAdds(d, BackgroundMixtureMulHi(diff, diff));
+                    }
+                    dist[k] = d;
+                    match[k] = d < BackgroundMixtureMulHi(g[W], p.threshold);
+                    if (match[k])
+                        best = Simd::Max(best, (int)g[0]);
+                    lightest = Simd::Min(lightest, (int)g[0]);
+                    total = BackgroundMixtureAdds(total, g[0]);
+                }
+
+                bool found = false, replace = false;
+                for (size_t k = 0; k < K; ++k)
+                {
+                    int weight = model[k * S + x];
+                    chosen[k] = match[k] && weight == best && !found;
+                    found = found || chosen[k];
+                    if (weight > best)
+                        heavier = BackgroundMixtureAdds(heavier, weight);
+                }
+                for (size_t k = 0; k < K; ++k)
+                {
+                    replaced[k] = !found && model[k * S + x] == lightest && !replace;
+                    replace = replace || replaced[k];
+                }
+                bool background = found && heavier < BackgroundMixtureMulHi(total, p.ratio);
+
+                for (size_t k = 0; k < K; ++k)
+                {
+                    int16_t * g = model + k * S + x;
+                    g[0] += BackgroundMixtureMulHrs((chosen[k] ? BACKGROUND_MIXTURE_WEIGHT_MAX : 0) - g[0], p.alpha);
+                    if (chosen[k])
+                    {
+                        for (size_t c = 0; c < C; ++c)
+                            g[(2 + c) * W] += BackgroundMixtureMulHrs(value[c] - g[(2 + c) * W], p.alpha);
+                        int d = C == 1 ? dist[k] : BackgroundMixtureMulHi(dist[k], 21846);
+                        int target = Simd::Min(d, BACKGROUND_MIXTURE_DIST_MAX) << BACKGROUND_MIXTURE_VAR_SHIFT;
+                        int var = g[W] + BackgroundMixtureMulHrs(target - g[W], p.alpha);
+                        g[W] = (int16_t)RestrictRange(var, BACKGROUND_MIXTURE_VAR_MIN, BACKGROUND_MIXTURE_VAR_MAX);
+                    }
+                    if (replaced[k])
+                    {
+                        g[0] = p.alpha;
+                        g[W] = BACKGROUND_MIXTURE_VAR_INIT;
+                        for (size_t c = 0; c < C; ++c)
+                            g[(2 + c) * W] = (int16_t)value[c];
+                    }
+                }
+                mask[x] = background ? 0 : 0xFF;
+            }
+        }
+
+        void BackgroundMixtureRow(const BackgroundMixtureParam & p, const uint8_t * src, int16_t * model, uint8_t * mask)
+        {
+            if (p.channels == 1)
+                BackgroundMixtureRow<1>(p, src, model, mask);
+            else
+                BackgroundMixtureRow<3>(p, src, model, mask);
+        }
+
+        //---------------------------------------------------------------------
+
+        BackgroundMixtureCommon::BackgroundMixtureCommon(const BackgroundMixtureParam & param)
+            : BackgroundMixture(param)
+            , _empty(true)
+            , _row(Base::BackgroundMixtureRow)
+        {
+            _model.Resize(param.modelH * param.ModelRowSize(), true, param.align);
+        }
+
+        void BackgroundMixtureCommon::SetRow(const uint8_t * src, size_t srcStride, size_t y, uint8_t * dst)
+        {
+            const BackgroundMixtureParam & p = _param;
+            const size_t C = p.channels, W = p.alignedW, scale = p.scale, area = scale * scale;
+            src += y * scale * srcStride;
+            if (scale == 1)
+            {
+                if (C == 1)
+                    memcpy(dst, src, p.modelW);
+                else
+                {
+                    for (size_t x = 0; x < p.modelW; ++x, src += 3)
+                    {
+                        dst[0 * W + x] = src[0];
+                        dst[1 * W + x] = src[1];
+                        dst[2 * W + x] = src[2];
+                    }
+                }
+            }
+            else
+            {
+                for (size_t x = 0; x < p.modelW; ++x)
+                {
+                    for (size_t c = 0; c < C; ++c)
+                    {
+                        const uint8_t * s = src + x * scale * C + c;
+                        size_t sum = 0;
+                        for (size_t dy = 0; dy < scale; ++dy, s += srcStride)
+                            for (size_t dx = 0; dx < scale; ++dx)
+                                sum += s[dx * C];
+                        dst[c * W + x] = uint8_t((sum + area / 2) / area);
+                    }
+                }
+            }
+        }
+
+        void BackgroundMixtureCommon::InitRow(const uint8_t * src, int16_t * model, uint8_t * mask)
+        {
+            const BackgroundMixtureParam & p = _param;
+            const size_t C = p.channels, W = p.alignedW, S = (2 + C) * W;
+            for (size_t k = 0; k < p.gaussians; ++k, model += S)
+            {
+                for (size_t x = 0; x < W; ++x)
+                {
+                    model[x] = k ? 0 : BACKGROUND_MIXTURE_WEIGHT_MAX;
+                    model[W + x] = BACKGROUND_MIXTURE_VAR_INIT;
+                    for (size_t c = 0; c < C; ++c)
+                        model[(2 + c) * W + x] = k ? 0 : src[c * W + x] << BACKGROUND_MIXTURE_MEAN_SHIFT;
+                }
+            }
+            memset(mask, 0, W);
+        }
+
+        void BackgroundMixtureCommon::Run(const uint8_t * src, size_t srcStride, uint8_t * mask, size_t maskStride)
+        {
+            const BackgroundMixtureParam & p = _param;
+            const size_t W = p.alignedW, scale = p.scale;
+            bool init = _empty;
+            _empty = false;
+            size_t threadNumber = Simd::Min(GetThreadNumber(), DivHi(p.modelH, BACKGROUND_MIXTURE_BAND_MIN));
+            Simd::Parallel(0, p.modelH, [&](size_t thread, size_t begin, size_t end)
+            {
+                end = Simd::Min(end, p.modelH);
+                Array8u buffer(W * (p.channels + 1), true);
+                uint8_t * row = buffer.data, * dst = buffer.data + W * p.channels;
+                for (size_t y = begin; y < end; ++y)
+                {
+                    SetRow(src, srcStride, y, row);
+                    int16_t * model = _model.data + y * p.ModelRowSize();
+                    if (init)
+                        InitRow(row, model, dst);
+                    else
+                        _row(p, row, model, dst);
+                    size_t yBeg = y * scale, yEnd = y == p.modelH - 1 ? p.height : yBeg + scale;
+                    for (size_t yy = yBeg; yy < yEnd; ++yy)
+                    {
+                        uint8_t * m = mask + yy * maskStride;
+                        if (scale == 1)
+                            memcpy(m, dst, p.width);
+                        else
+                        {
+                            for (size_t x = 0; x < p.width; ++x)
+                                m[x] = dst[Simd::Min(x / scale, p.modelW - 1)];
+                        }
+                    }
+                }
+            }, threadNumber, BACKGROUND_MIXTURE_BAND_MIN);
+        }
+
+        //---------------------------------------------------------------------
+
+        void * BackgroundMixtureInit(size_t width, size_t height, size_t channels, size_t gaussians, size_t scale,
+            float learningRate, float varianceThreshold, float backgroundRatio)
+        {
+            BackgroundMixtureParam param(width, height, channels, gaussians, scale, learningRate, varianceThreshold, backgroundRatio, sizeof(void*));
+            if (!param.Valid())
+                return NULL;
+            return new BackgroundMixtureCommon(param);
+        }
+    }
+}
@@ -0,0 +1,149 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdBoxFilter.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        void BoxColsInit(const uint8_t * src, size_t srcStride, size_t size, size_t height, size_t radius, uint32_t * cols)
+        {
+            for (size_t i = 0; i < size; ++i)
+                cols[i] = 0;
+            for (ptrdiff_t dy = -(ptrdiff_t)radius; dy <= (ptrdiff_t)radius; ++dy)
+            {
+                const uint8_t * s = src + BoxRow(dy, height)*srcStride;
+                for (size_t i = 0; i < size; ++i)
+                    cols[i] += s[i];
+            }
+        }
+
+        void BoxColsUpdate(const uint8_t * add, const uint8_t * sub, size_t size, uint32_t * cols)
+        {
+            for (size_t i = 0; i < size; ++i)
+                cols[i] += add[i] - sub[i];
+        }
+
+        void BoxRowSums(const uint32_t * cols, size_t size, size_t channelCount, size_t kernel, uint32_t * sums, uint32_t * dst)
+        {
+            size_t full = size + kernel - channelCount;
+            for (size_t i = 0; i < full; ++i)
+                sums[i + channelCount] = sums[i] + cols[i];
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = sums[i + kernel] - sums[i];
+        }
+
+        template<bool mean> void BoxFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, 
+            size_t channelCount, size_t radiusX, size_t radiusY, uint8_t * dst, size_t dstStride)
+        {
+            BoxBuffer<uint32_t> buffer(width, channelCount, radiusX);
+            uint32_t * cols = buffer.cols.data + buffer.border;
+            float scale = 1.0f / float((2*radiusX + 1)*(2*radiusY + 1));
+            BoxColsInit(src, srcStride, buffer.size, height, radiusY, cols);
+            for (size_t row = 0; row < height; ++row)
+            {
+                BoxSetBorder(cols, width, channelCount, radiusX);
+                if (mean)
+                {
+                    BoxRowSums(buffer.cols.data, buffer.size, channelCount, buffer.kernel, buffer.sums.data, buffer.dst.data);
+                    for (size_t i = 0; i < buffer.size; ++i)
+                        dst[i] = Round(float(buffer.dst[i])*scale);
+                }
+                else
+                    BoxRowSums(buffer.cols.data, buffer.size, channelCount, buffer.kernel, buffer.sums.data, (uint32_t*)dst);
+                if (row < height - 1)
+                    BoxColsUpdate(src + BoxRow(row + radiusY + 1, height)*srcStride, src + BoxRow(row - radiusY, height)*srcStride, buffer.size, cols);
+                dst += dstStride;
+            }
+        }
+
+        void BoxFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, 
+            size_t channelCount, size_t radiusX, size_t radiusY, uint8_t * dst, size_t dstStride)
+        {
+            BoxFilter<true>(src, srcStride, width, height, channelCount, radiusX, radiusY, dst, dstStride);
+        }
+
+        void BoxSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            size_t channelCount, size_t radiusX, size_t radiusY, uint8_t * sum, size_t sumStride)
+        {
+            BoxFilter<false>(src, srcStride, width, height, channelCount, radiusX, radiusY, sum, sumStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        void BoxColsInit32f(const float * src, size_t srcStride, size_t size, size_t height, size_t radius, float * cols)
+        {
+            for (size_t i = 0; i < size; ++i)
+                cols[i] = 0;
+            for (ptrdiff_t dy = -(ptrdiff_t)radius; dy <= (ptrdiff_t)radius; ++dy)
+            {
+                const float * s = src + BoxRow(dy, height)*srcStride;
+                for (size_t i = 0; i < size; ++i)
+                    cols[i] += s[i];
+            }
+        }
+
+        void BoxColsUpdate32f(const float * add, const float * sub, size_t size, float * cols)
+        {
+            for (size_t i = 0; i < size; ++i)
+                cols[i] += add[i] - sub[i];
+        }
+
+        void BoxRowSums32f(const float * cols, size_t size, size_t channelCount, size_t kernel, float * dst)
+        {
+            for (size_t c = 0; c < channelCount; ++c)
+            {
+                float sum = 0;
+                for (size_t k = c; k < kernel; k += channelCount)
+                    sum += cols[k];
+                dst[c] = sum;
+            }
+            for (size_t i = channelCount; i < size; ++i)
+                dst[i] = dst[i - channelCount] + (cols[i + kernel - channelCount] - cols[i - channelCount]);
+        }
+
+        void BoxFilter32f(const float * src, size_t srcStride, size_t width, size_t height, size_t channelCount,
+            size_t radiusX, size_t radiusY, float * dst, size_t dstStride, SimdBool normalize)
+        {
+            BoxBuffer<float> buffer(width, channelCount, radiusX);
+            float * cols = buffer.cols.data + buffer.border;
+            float scale = 1.0f / float((2*radiusX + 1)*(2*radiusY + 1));
+            BoxColsInit32f(src, srcStride, buffer.size, height, radiusY, cols);
+            for (size_t row = 0; row < height; ++row)
+            {
+                BoxSetBorder(cols, width, channelCount, radiusX);
+                BoxRowSums32f(buffer.cols.data, buffer.size, channelCount, buffer.kernel, dst);
+                if (normalize)
+                {
+                    for (size_t i = 0; i < buffer.size; ++i)
+                        dst[i] = dst[i]*scale;
+                }
+                if (row < height - 1)
+                    BoxColsUpdate32f(src + BoxRow(row + radiusY + 1, height)*srcStride, src + BoxRow(row - radiusY, height)*srcStride, buffer.size, cols);
+                dst += dstStride;
+            }
+        }
+    }
+}
@@ -0,0 +1,161 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdCanny.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        void CannyMagnitude(const int16_t * dx, const int16_t * dy, size_t width, int16_t * mag)
+        {
+            for (size_t col = 0; col < width; ++col)
+                mag[col] = Simd::Abs(dx[col]) + Simd::Abs(dy[col]);
+        }
+
+        void CannyNms(const int16_t * dx, const int16_t * dy, const int16_t * mag0, const int16_t * mag1, const int16_t * mag2,
+            size_t width, int16_t lowThreshold, int16_t highThreshold, uint8_t * map)
+        {
+            for (size_t col = 0; col < width; ++col)
+            {
+                int m = mag1[col];
+                if (m <= lowThreshold)
+                {
+                    map[col] = CANNY_NONE;
+                    continue;
+                }
+                int ax = Simd::Abs(dx[col]), ay = Simd::Abs(dy[col]), n1, n2;
+                if (ay*CANNY_TAN_DEN <= ax*CANNY_TAN_NUM)
+                    n1 = mag1[col - 1], n2 = mag1[col + 1];
+                else if (ax*CANNY_TAN_DEN <= ay*CANNY_TAN_NUM)
+                    n1 = mag0[col], n2 = mag2[col];
+                else if ((dx[col] ^ dy[col]) >= 0)
+                    n1 = mag0[col - 1], n2 = mag2[col + 1];
+                else
+                    n1 = mag0[col + 1], n2 = mag2[col - 1];
+                if (m > n1 && m >= n2)
+                    map[col] = m > highThreshold ? CANNY_STRONG : CANNY_WEAK;
+                else
+                    map[col] = CANNY_NONE;
+            }
+        }
+
+        typedef std::vector<uint8_t*> CannyStack;
+
+        static void CannyHysteresis(uint8_t * begin, uint8_t * end, ptrdiff_t stride, CannyStack & stack)
+        {
+            const ptrdiff_t offsets[8] = { -stride - 1, -stride, -stride + 1, -1, 1, stride - 1, stride, stride + 1 };
+            while (stack.size())
+            {
+                uint8_t * p = stack.back();
+                stack.pop_back();
+                for (size_t i = 0; i < 8; ++i)
+                {
+                    uint8_t * n = p + offsets[i];
+                    if (n >= begin && n < end && *n == CANNY_WEAK)
+                    {
+                        *n = CANNY_STRONG;
+                        stack.push_back(n);
+                    }
+                }
+            }
+        }
+
+        static void CannyPushStrong(uint8_t * begin, uint8_t * end, CannyStack & stack)
+        {
+            for (uint8_t * p = begin; p < end; ++p)
+                if (*p == CANNY_STRONG)
+                    stack.push_back(p);
+        }
+
+        void Canny(const uint8_t * src, size_t srcStride, size_t width, size_t height, int16_t lowThreshold, int16_t highThreshold,
+            uint8_t * dst, size_t dstStride, CannySobelPtr sobelDx, CannySobelPtr sobelDy, CannyMagnitudePtr magnitude, CannyNmsPtr nms)
+        {
+            assert(width > 1 && height > 1 && lowThreshold <= highThreshold);
+
+            size_t mapStride = width + 2;
+            Array8u map(mapStride*(height + 2), true);
+            size_t threadNumber = Simd::Min(GetThreadNumber(), DivHi(height, CANNY_CHUNK));
+            std::vector<std::pair<size_t, size_t>> bands(threadNumber, std::pair<size_t, size_t>(0, 0));
+
+            Simd::Parallel(0, height, [&](size_t thread, size_t begin, size_t end)
+            {
+                end = Simd::Min(end, height);
+                bands[thread] = std::pair<size_t, size_t>(begin, end);
+                size_t magStride = width + 2;
+                Array16i dx((CANNY_CHUNK + 4)*width), dy((CANNY_CHUNK + 4)*width), mag((CANNY_CHUNK + 2)*magStride, true);
+                for (size_t y0 = begin; y0 < end; y0 += CANNY_CHUNK)
+                {
+                    size_t y1 = Simd::Min(y0 + CANNY_CHUNK, end);
+                    size_t yb = y0 > 2 ? y0 - 2 : 0, ye = Simd::Min(y1 + 2, height);
+                    sobelDx(src + yb*srcStride, srcStride, width, ye - yb, (uint8_t*)dx.data, width * sizeof(int16_t));
+                    sobelDy(src + yb*srcStride, srcStride, width, ye - yb, (uint8_t*)dy.data, width * sizeof(int16_t));
+                    for (ptrdiff_t y = (ptrdiff_t)y0 - 1; y <= (ptrdiff_t)y1; ++y)
+                    {
+                        int16_t * m = mag.data + (y + 1 - y0)*magStride + 1;
+                        if (y < 0 || y >= (ptrdiff_t)height)
+                            memset(m, 0, width * sizeof(int16_t));
+                        else
+                            magnitude(dx.data + (y - yb)*width, dy.data + (y - yb)*width, width, m);
+                    }
+                    for (size_t y = y0; y < y1; ++y)
+                    {
+                        const int16_t * m = mag.data + (y - y0)*magStride + 1;
+                        nms(dx.data + (y - yb)*width, dy.data + (y - yb)*width, m, m + magStride, m + 2 * magStride, 
+                            width, lowThreshold, highThreshold, map.data + (y + 1)*mapStride + 1);
+                    }
+                }
+                CannyStack stack;
+                uint8_t * bandBegin = map.data + (begin + 1)*mapStride, * bandEnd = map.data + (end + 1)*mapStride;
+                CannyPushStrong(bandBegin, bandEnd, stack);
+                CannyHysteresis(bandBegin, bandEnd, mapStride, stack);
+            }, threadNumber, CANNY_CHUNK);
+
+            CannyStack stack;
+            for (size_t i = 0; i < bands.size(); ++i)
+            {
+                size_t begin = bands[i].first;
+                if (begin == 0 || begin >= bands[i].second)
+                    continue;
+                CannyPushStrong(map.data + begin*mapStride, map.data + (begin + 2)*mapStride, stack);
+                CannyHysteresis(map.data, map.data + map.size, mapStride, stack);
+            }
+
+            for (size_t row = 0; row < height; ++row, dst += dstStride)
+            {
+                const uint8_t * m = map.data + (row + 1)*mapStride + 1;
+                for (size_t col = 0; col < width; ++col)
+                    dst[col] = m[col] == CANNY_STRONG ? 0xFF : 0;
+            }
+        }
+
+        void Canny(const uint8_t * src, size_t srcStride, size_t width, size_t height, int16_t lowThreshold, int16_t highThreshold, uint8_t * dst, size_t dstStride)
+        {
+            Canny(src, srcStride, width, height, lowThreshold, highThreshold, dst, dstStride, SobelDx, SobelDy, CannyMagnitude, CannyNms);
+        }
+    }
+}
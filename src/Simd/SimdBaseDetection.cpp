@@ -30,6 +30,7 @@
 #include <stdexcept>
 #include <iostream>
 #include <sstream>
+#include <fstream>
 
 #define SIMD_EX(message) \
 { \
@@ -319,8 +320,156 @@ namespace Simd
             return data;
         }
 
+        namespace Binary
+        {
+            const char MAGIC[8] = { 'S', 'i', 'm', 'd', 'C', 'a', 's', 'c' };
+            const uint32_t VERSION = 1;
+            const size_t ALIGN = 8;
+
+            enum Arrays
+            {
+                Stages,
+                Classifiers,
+                Nodes,
+                Leaves,
+                Subsets,
+                HaarFeatures,
+                LbpFeatures,
+                ArraysSize
+            };
+
+            struct Header
+            {
+                char magic[8];
+                uint32_t version;
+                uint32_t featureType;
+                int32_t stageType;
+                int32_t ncategories;
+                int32_t width;
+                int32_t height;
+                uint8_t isStumpBased;
+                uint8_t hasTilted;
+                uint8_t canInt16;
+                uint8_t reserved;
+                uint32_t itemSizes[ArraysSize];
+                uint64_t itemCounts[ArraysSize];
+            };
+
+            const uint32_t ITEM_SIZES[ArraysSize] = { sizeof(Data::Stage), sizeof(Data::DTree), sizeof(Data::DTreeNode),
+                sizeof(float), sizeof(int), sizeof(Data::HaarFeature), sizeof(Data::LbpFeature) };
+
+            template<class T> void Write(std::ofstream & file, const Data::Array<T> & array)
+            {
+                static const char zero[ALIGN] = { 0 };
+                size_t size = array.size() * sizeof(T);
+                file.write((const char*)array.data(), size);
+                file.write(zero, AlignHi(size, ALIGN) - size);
+            }
+
+            template<class T> bool Map(const uint8_t * & ptr, const uint8_t * end, uint64_t count, Data::Array<T> & array)
+            {
+                if (count > uint64_t(end - ptr) / sizeof(T))
+                    return false;
+                size_t size = size_t(count) * sizeof(T);
+                array.Assign((const T*)ptr, size_t(count));
+                ptr += std::min<size_t>(AlignHi(size, ALIGN), end - ptr);
+                return true;
+            }
+
+            bool IsBinary(const char * path)
+            {
+                char magic[sizeof(MAGIC)];
+                std::ifstream file(path, std::ios::binary);
+                return file.read(magic, sizeof(magic)) && memcmp(magic, MAGIC, sizeof(MAGIC)) == 0;
+            }
+
+            void * Load(const char * path)
+            {
+                Data * data = new Data();
+                if (!data->file.Open(path) || data->file.Size() < sizeof(Header))
+                {
+                    delete data;
+                    return NULL;
+                }
+                const Header & header = *(const Header*)data->file.Data();
+                const uint8_t * ptr = data->file.Data() + AlignHi(sizeof(Header), ALIGN);
+                const uint8_t * end = data->file.Data() + data->file.Size();
+                bool valid = memcmp(header.magic, MAGIC, sizeof(MAGIC)) == 0 && header.version == VERSION &&
+                    memcmp(header.itemSizes, ITEM_SIZES, sizeof(ITEM_SIZES)) == 0 && ptr <= end;
+                if (valid)
+                {
+                    data->featureType = (SimdDetectionInfoFlags)header.featureType;
+                    data->stageType = header.stageType;
+                    data->ncategories = header.ncategories;
+                    data->origWinSize = Size(header.width, header.height);
+                    data->isStumpBased = header.isStumpBased != 0;
+                    data->hasTilted = header.hasTilted != 0;
+                    data->canInt16 = header.canInt16 != 0;
+                    valid = valid && Map(ptr, end, header.itemCounts[Stages], data->stages);
+                    valid = valid && Map(ptr, end, header.itemCounts[Classifiers], data->classifiers);
+                    valid = valid && Map(ptr, end, header.itemCounts[Nodes], data->nodes);
+                    valid = valid && Map(ptr, end, header.itemCounts[Leaves], data->leaves);
+                    valid = valid && Map(ptr, end, header.itemCounts[Subsets], data->subsets);
+                    valid = valid && Map(ptr, end, header.itemCounts[HaarFeatures], data->haarFeatures);
+                    valid = valid && Map(ptr, end, header.itemCounts[LbpFeatures], data->lbpFeatures);
+                }
+                if (!valid)
+                {
+                    delete data;
+                    data = NULL;
+                }
+                return data;
+            }
+        }
+
+        SimdBool DetectionSave(const void * _data, const char * path)
+        {
+            const Data * data = (const Data*)_data;
+            if (data == NULL)
+                return SimdFalse;
+
+            Binary::Header header;
+            memset(&header, 0, sizeof(header));
+            memcpy(header.magic, Binary::MAGIC, sizeof(Binary::MAGIC));
+            header.version = Binary::VERSION;
+            header.featureType = data->featureType;
+            header.stageType = data->stageType;
+            header.ncategories = data->ncategories;
+            header.width = (int32_t)data->origWinSize.x;
+            header.height = (int32_t)data->origWinSize.y;
+            header.isStumpBased = data->isStumpBased ? 1 : 0;
+            header.hasTilted = data->hasTilted ? 1 : 0;
+            header.canInt16 = data->canInt16 ? 1 : 0;
+            memcpy(header.itemSizes, Binary::ITEM_SIZES, sizeof(Binary::ITEM_SIZES));
+            header.itemCounts[Binary::Stages] = data->stages.size();
+            header.itemCounts[Binary::Classifiers] = data->classifiers.size();
+            header.itemCounts[Binary::Nodes] = data->nodes.size();
+            header.itemCounts[Binary::Leaves] = data->leaves.size();
+            header.itemCounts[Binary::Subsets] = data->subsets.size();
+            header.itemCounts[Binary::HaarFeatures] = data->haarFeatures.size();
+            header.itemCounts[Binary::LbpFeatures] = data->lbpFeatures.size();
+
+            std::ofstream file(path, std::ios::binary);
+            if (!file.is_open())
+                return SimdFalse;
+            static const char zero[Binary::ALIGN] = { 0 };
+            file.write((const char*)&header, sizeof(header));
+            file.write(zero, AlignHi(sizeof(header), Binary::ALIGN) - sizeof(header));
+            Binary::Write(file, data->stages);
+            Binary::Write(file, data->classifiers);
+            Binary::Write(file, data->nodes);
+            Binary::Write(file, data->leaves);
+            Binary::Write(file, data->subsets);
+            Binary::Write(file, data->haarFeatures);
+            Binary::Write(file, data->lbpFeatures);
+            return file.good() ? SimdTrue : SimdFalse;
+        }
+
         void * DetectionLoadA(const char * path)
         {
+            if (Binary::IsBinary(path))
+                return Binary::Load(path);
+
             Xml::File file;
             if (!file.Open(path))
                 SIMD_EX("Can't load XML file '" << path << "'!");
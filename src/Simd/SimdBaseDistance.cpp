@@ -0,0 +1,223 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdDistance.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        void DistanceColDown(const uint8_t * mask, uint8_t index, const int32_t * prev, int32_t * curr, size_t width)
+        {
+            for (size_t x = 0; x < width; ++x)
+                curr[x] = mask[x] == index ? 0 : Simd::Min(prev[x] + 1, DISTANCE_INF);
+        }
+
+        void DistanceColUp(const int32_t * next, int32_t * curr, size_t width)
+        {
+            for (size_t x = 0; x < width; ++x)
+                curr[x] = Simd::Min(curr[x], next[x] + 1);
+        }
+
+        void DistanceChamferVert(const int32_t * row1, const int32_t * row2, int32_t * curr, size_t width, int32_t a, int32_t b, int32_t c)
+        {
+            for (size_t x = 0; x < width; ++x)
+            {
+                int32_t d = Simd::Min(curr[x], row1[x] + a);
+                d = Simd::Min(d, Simd::Min(row1[x - 1], row1[x + 1]) + b);
+                if (row2)
+                {
+                    d = Simd::Min(d, Simd::Min(row1[x - 2], row1[x + 2]) + c);
+                    d = Simd::Min(d, Simd::Min(row2[x - 1], row2[x + 1]) + c);
+                }
+                curr[x] = d;
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        static void DistanceChamferStore(const int32_t * src, size_t width, int32_t a, uint8_t * dst, SimdPixelFormatType dstFormat)
+        {
+            if (dstFormat == SimdPixelFormatFloat)
+            {
+                float * _dst = (float*)dst, scale = 1.0f / float(a);
+                for (size_t x = 0; x < width; ++x)
+                    _dst[x] = src[x] < DISTANCE_INF ? float(src[x]) * scale : FLT_MAX;
+            }
+            else
+            {
+                uint16_t * _dst = (uint16_t*)dst;
+                for (size_t x = 0; x < width; ++x)
+                    _dst[x] = (uint16_t)Simd::Min((src[x] + a / 2) / a, 0xFFFF);
+            }
+        }
+
+        static void DistanceChamfer(const uint8_t * mask, size_t maskStride, size_t width, size_t height, uint8_t index, bool big,
+            uint8_t * dst, size_t dstStride, SimdPixelFormatType dstFormat, DistanceChamferVertPtr chamferVert)
+        {
+            const int32_t a = big ? 5 : 3, b = big ? 7 : 4, c = big ? 11 : 0;
+            const size_t stride = width + 4;
+            Array32i buffer((height + 1) * stride);
+            int32_t * inf = buffer.data + height * stride + 2;
+            for (size_t x = 0; x < stride; ++x)
+                inf[x - 2] = DISTANCE_INF;
+            for (size_t y = 0; y < height; ++y)
+            {
+                int32_t * curr = buffer.data + y * stride + 2;
+                curr[-2] = curr[-1] = curr[width] = curr[width + 1] = DISTANCE_INF;
+            }
+
+            for (size_t y = 0; y < height; ++y)
+            {
+                const uint8_t * m = mask + y * maskStride;
+                int32_t * curr = buffer.data + y * stride + 2;
+                for (size_t x = 0; x < width; ++x)
+                    curr[x] = m[x] == index ? 0 : DISTANCE_INF;
+                const int32_t * row1 = y > 0 ? curr - stride : inf;
+                const int32_t * row2 = big ? (y > 1 ? curr - 2 * stride : inf) : NULL;
+                chamferVert(row1, row2, curr, width, a, b, c);
+                for (size_t x = 1; x < width; ++x)
+                    curr[x] = Simd::Min(curr[x], curr[x - 1] + a);
+            }
+
+            for (size_t y = height - 1; y < height; --y)
+            {
+                int32_t * curr = buffer.data + y * stride + 2;
+                const int32_t * row1 = y + 1 < height ? curr + stride : inf;
+                const int32_t * row2 = big ? (y + 2 < height ? curr + 2 * stride : inf) : NULL;
+                chamferVert(row1, row2, curr, width, a, b, c);
+                for (size_t x = width - 2; x < width; --x)
+                    curr[x] = Simd::Min(curr[x], curr[x + 1] + a);
+                DistanceChamferStore(curr, width, a, dst + y * dstStride, dstFormat);
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        SIMD_INLINE double DistanceIntersection(const double * f, ptrdiff_t q, ptrdiff_t p)
+        {
+            return ((f[q] + double(q * q)) - (f[p] + double(p * p))) / double(2 * (q - p));
+        }
+
+        static void DistanceEuclideanRow(const int32_t * g, size_t width, double * f, int32_t * v, double * z, uint8_t * dst, SimdPixelFormatType dstFormat)
+        {
+            const double inf = 1e20;
+            for (size_t q = 0; q < width; ++q)
+                f[q] = g[q] < DISTANCE_INF ? double(g[q]) * double(g[q]) : inf;
+
+            ptrdiff_t k = 0;
+            v[0] = 0;
+            z[0] = -inf;
+            z[1] = inf;
+            for (ptrdiff_t q = 1; q < (ptrdiff_t)width; ++q)
+            {
+                double s = DistanceIntersection(f, q, v[k]);
+                while (s <= z[k])
+                {
+                    k--;
+                    s = DistanceIntersection(f, q, v[k]);
+                }
+                k++;
+                v[k] = (int32_t)q;
+                z[k] = s;
+                z[k + 1] = inf;
+            }
+
+            k = 0;
+            for (ptrdiff_t q = 0; q < (ptrdiff_t)width; ++q)
+            {
+                while (z[k + 1] < double(q))
+                    k++;
+                ptrdiff_t p = v[k];
+                double d2 = double((q - p) * (q - p)) + f[p];
+                if (dstFormat == SimdPixelFormatFloat)
+                    ((float*)dst)[q] = d2 < inf * 0.5 ? (float)::sqrt(d2) : FLT_MAX;
+                else
+                    ((uint16_t*)dst)[q] = d2 < inf * 0.5 ? (uint16_t)Simd::Min(::sqrt(d2) + 0.5, 65535.0) : 0xFFFF;
+            }
+        }
+
+        static void DistanceEuclidean(const uint8_t * mask, size_t maskStride, size_t width, size_t height, uint8_t index,
+            uint8_t * dst, size_t dstStride, DistanceColDownPtr colDown, DistanceColUpPtr colUp, SimdPixelFormatType dstFormat)
+        {
+            Array32i g(width * height);
+            Array32i inf(width);
+            for (size_t x = 0; x < width; ++x)
+                inf[x] = DISTANCE_INF;
+
+            Simd::Parallel(0, width, [&](size_t thread, size_t begin, size_t end)
+            {
+                end = Simd::Min(end, width);
+                size_t size = end - begin;
+                for (size_t y = 0; y < height; ++y)
+                    colDown(mask + y * maskStride + begin, index, y ? g.data + (y - 1) * width + begin : inf.data + begin, g.data + y * width + begin, size);
+                for (size_t y = height - 2; y < height; --y)
+                    colUp(g.data + (y + 1) * width + begin, g.data + y * width + begin, size);
+            }, Simd::Min(GetThreadNumber(), DivHi(width, DISTANCE_STRIP)), DISTANCE_STRIP);
+
+            Simd::Parallel(0, height, [&](size_t thread, size_t begin, size_t end)
+            {
+                end = Simd::Min(end, height);
+                std::vector<double> f(width), z(width + 1);
+                std::vector<int32_t> v(width);
+                for (size_t y = begin; y < end; ++y)
+                    DistanceEuclideanRow(g.data + y * width, width, f.data(), v.data(), z.data(), dst + y * dstStride, dstFormat);
+            }, Simd::Min(GetThreadNumber(), DivHi(height, DISTANCE_BAND_MIN)));
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        void DistanceTransformRun(const uint8_t * mask, size_t maskStride, size_t width, size_t height, uint8_t index, SimdDistanceType type,
+            uint8_t * dst, size_t dstStride, SimdPixelFormatType dstFormat, DistanceColDownPtr colDown, DistanceColUpPtr colUp, DistanceChamferVertPtr chamferVert)
+        {
+            assert(dstFormat == SimdPixelFormatFloat || dstFormat == SimdPixelFormatInt16);
+
+            if (width == 0 || height == 0)
+                return;
+            switch (type)
+            {
+            case SimdDistanceEuclidean:
+                DistanceEuclidean(mask, maskStride, width, height, index, dst, dstStride, colDown, colUp, dstFormat);
+                break;
+            case SimdDistanceChamfer3x3:
+                DistanceChamfer(mask, maskStride, width, height, index, false, dst, dstStride, dstFormat, chamferVert);
+                break;
+            case SimdDistanceChamfer5x5:
+                DistanceChamfer(mask, maskStride, width, height, index, true, dst, dstStride, dstFormat, chamferVert);
+                break;
+            default:
+                assert(0);
+            }
+        }
+
+        void DistanceTransform(const uint8_t * mask, size_t maskStride, size_t width, size_t height, uint8_t index, SimdDistanceType type,
+            uint8_t * dst, size_t dstStride, SimdPixelFormatType dstFormat)
+        {
+            DistanceTransformRun(mask, maskStride, width, height, index, type, dst, dstStride, dstFormat, DistanceColDown, DistanceColUp, DistanceChamferVert);
+        }
+    }
+}
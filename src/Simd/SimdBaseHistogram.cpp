@@ -23,6 +23,9 @@
 */
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdCompare.h"
+#include "Simd/SimdHistogram.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdBase.h"
 
 namespace Simd
 {
@@ -58,7 +61,12 @@ namespace Simd
             }
         }
 
-        void Histogram(const uint8_t * src, size_t width, size_t height, size_t stride, uint32_t * histogram)
+        size_t HistogramThreadNumber(size_t width, size_t height)
+        {
+            return Simd::Min(Simd::Min(GetThreadNumber(), width * height / HISTOGRAM_AREA_MIN), height);
+        }
+
+        static void HistogramRows(const uint8_t * src, size_t width, size_t height, size_t stride, uint32_t * histogram)
         {
             uint32_t histograms[4][HISTOGRAM_SIZE];
             memset(histograms, 0, sizeof(uint32_t)*HISTOGRAM_SIZE * 4);
@@ -83,7 +91,21 @@ namespace Simd
                 histogram[i] = histograms[0][i] + histograms[1][i] + histograms[2][i] + histograms[3][i];
         }
 
-        void HistogramMasked(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        void Histogram(const uint8_t * src, size_t width, size_t height, size_t stride, uint32_t * histogram)
+        {
+            size_t threadNumber = HistogramThreadNumber(width, height);
+            if (threadNumber > 1)
+            {
+                HistogramParallel(height, threadNumber, histogram, [&](size_t begin, size_t end, uint32_t * h)
+                {
+                    HistogramRows(src + begin * stride, width, end - begin, stride, h);
+                });
+            }
+            else
+                HistogramRows(src, width, height, stride, histogram);
+        }
+
+        static void HistogramMaskedRows(const uint8_t * src, size_t srcStride, size_t width, size_t height,
             const uint8_t * mask, size_t maskStride, uint8_t index, uint32_t * histogram)
         {
             uint32_t histograms[4][HISTOGRAM_SIZE + 4];
@@ -109,6 +131,21 @@ namespace Simd
                 histogram[i] = histograms[0][4 + i] + histograms[1][4 + i] + histograms[2][4 + i] + histograms[3][4 + i];
         }
 
+        void HistogramMasked(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            const uint8_t * mask, size_t maskStride, uint8_t index, uint32_t * histogram)
+        {
+            size_t threadNumber = HistogramThreadNumber(width, height);
+            if (threadNumber > 1)
+            {
+                HistogramParallel(height, threadNumber, histogram, [&](size_t begin, size_t end, uint32_t * h)
+                {
+                    HistogramMaskedRows(src + begin * srcStride, srcStride, width, end - begin, mask + begin * maskStride, maskStride, index, h);
+                });
+            }
+            else
+                HistogramMaskedRows(src, srcStride, width, height, mask, maskStride, index, histogram);
+        }
+
         template <SimdCompareType compareType>
         void HistogramConditional(const uint8_t * src, size_t srcStride, size_t width, size_t height,
             const uint8_t * mask, size_t maskStride, uint8_t value, uint32_t * histogram)
@@ -208,5 +245,123 @@ namespace Simd
 
             ChangeColors(src, srcStride, width, height, colors, dst, dstStride);
         }
+
+        //-----------------------------------------------------------------------------------------
+
+        static void ClaheLut(uint32_t * histogram, size_t area, float clipLimit, uint8_t * lut)
+        {
+            uint32_t clip = clipLimit > 0.0f ? Simd::Max<uint32_t>(1, uint32_t(clipLimit * area / HISTOGRAM_SIZE)) : (uint32_t)area;
+            uint32_t excess = 0;
+            for (size_t i = 0; i < HISTOGRAM_SIZE; ++i)
+            {
+                if (histogram[i] > clip)
+                {
+                    excess += histogram[i] - clip;
+                    histogram[i] = clip;
+                }
+            }
+            uint32_t add = excess / HISTOGRAM_SIZE, rest = excess % HISTOGRAM_SIZE;
+            for (size_t i = 0; i < HISTOGRAM_SIZE; ++i)
+                histogram[i] += add;
+            if (rest)
+            {
+                size_t step = Simd::Max<size_t>(HISTOGRAM_SIZE / rest, 1);
+                for (size_t i = 0; i < HISTOGRAM_SIZE && rest; i += step, --rest)
+                    histogram[i]++;
+            }
+            uint64_t sum = 0;
+            for (size_t i = 0; i < HISTOGRAM_SIZE; ++i)
+            {
+                sum += histogram[i];
+                lut[i] = (uint8_t)Simd::Min<uint64_t>((sum * 255 + area / 2) / area, 255);
+            }
+        }
+
+        SIMD_INLINE size_t ClaheCenter2(size_t k, size_t size, size_t tiles)
+        {
+            return k * size / tiles + (k + 1) * size / tiles - 1;
+        }
+
+        static void ClaheCoord(size_t pos, size_t size, size_t tiles, int32_t & i0, int32_t & i1, int32_t & w)
+        {
+            size_t pos2 = 2 * pos, k = Simd::Min(pos * tiles / size, tiles - 1);
+            while (k + 1 < tiles && ClaheCenter2(k + 1, size, tiles) <= pos2)
+                k++;
+            while (k > 0 && ClaheCenter2(k, size, tiles) > pos2)
+                k--;
+            size_t c0 = ClaheCenter2(k, size, tiles);
+            if (c0 > pos2 || k + 1 == tiles)
+            {
+                i0 = i1 = (int32_t)k, w = 0;
+                return;
+            }
+            size_t c1 = ClaheCenter2(k + 1, size, tiles);
+            i0 = (int32_t)k, i1 = (int32_t)k + 1;
+            w = (int32_t)(((pos2 - c0) * CLAHE_RANGE + (c1 - c0) / 2) / (c1 - c0));
+        }
+
+        void ClaheRow(const uint8_t * src, size_t width, const uint8_t * lut0, const uint8_t * lut1,
+            const int32_t * ix0, const int32_t * ix1, const int32_t * wx, int32_t wy, uint8_t * dst)
+        {
+            for (size_t col = 0; col < width; ++col)
+            {
+                int32_t i0 = ix0[col] + src[col], i1 = ix1[col] + src[col];
+                int32_t w0 = wx[col] & 0xFFFF, w1 = wx[col] >> 16;
+                int32_t top = lut0[i0] * w0 + lut0[i1] * w1;
+                int32_t bottom = lut1[i0] * w0 + lut1[i1] * w1;
+                dst[col] = (uint8_t)((top * CLAHE_RANGE + (bottom - top) * wy + CLAHE_ROUND) >> (2 * CLAHE_SHIFT));
+            }
+        }
+
+        void ClaheRun(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t tilesX, size_t tilesY,
+            float clipLimit, uint8_t * dst, size_t dstStride, ClaheRowPtr claheRow)
+        {
+            assert(tilesX > 0 && tilesY > 0 && tilesX <= width && tilesY <= height);
+
+            Array8u luts(tilesX * tilesY * HISTOGRAM_SIZE + SIMD_ALIGN);
+            Simd::Parallel(0, tilesY, [&](size_t thread, size_t begin, size_t end)
+            {
+                end = Simd::Min(end, tilesY);
+                uint32_t histogram[HISTOGRAM_SIZE];
+                for (size_t ty = begin; ty < end; ++ty)
+                {
+                    size_t y0 = ty * height / tilesY, y1 = (ty + 1) * height / tilesY;
+                    for (size_t tx = 0; tx < tilesX; ++tx)
+                    {
+                        size_t x0 = tx * width / tilesX, x1 = (tx + 1) * width / tilesX;
+                        HistogramRows(src + y0 * srcStride + x0, x1 - x0, y1 - y0, srcStride, histogram);
+                        ClaheLut(histogram, (x1 - x0) * (y1 - y0), clipLimit, luts.data + (ty * tilesX + tx) * HISTOGRAM_SIZE);
+                    }
+                }
+            }, Simd::Min(GetThreadNumber(), tilesY));
+
+            Array32i cols(width * 3);
+            int32_t * ix0 = cols.data, * ix1 = ix0 + width, * wx = ix1 + width;
+            for (size_t x = 0; x < width; ++x)
+            {
+                int32_t i0, i1, w;
+                ClaheCoord(x, width, tilesX, i0, i1, w);
+                ix0[x] = i0 * (int32_t)HISTOGRAM_SIZE;
+                ix1[x] = i1 * (int32_t)HISTOGRAM_SIZE;
+                wx[x] = (CLAHE_RANGE - w) | (w << 16);
+            }
+
+            Simd::Parallel(0, height, [&](size_t thread, size_t begin, size_t end)
+            {
+                end = Simd::Min(end, height);
+                for (size_t y = begin; y < end; ++y)
+                {
+                    int32_t j0, j1, wy;
+                    ClaheCoord(y, height, tilesY, j0, j1, wy);
+                    claheRow(src + y * srcStride, width, luts.data + j0 * tilesX * HISTOGRAM_SIZE, luts.data + j1 * tilesX * HISTOGRAM_SIZE,
+                        ix0, ix1, wx, wy, dst + y * dstStride);
+                }
+            }, HistogramThreadNumber(width, height));
+        }
+
+        void Clahe(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t tilesX, size_t tilesY, float clipLimit, uint8_t * dst, size_t dstStride)
+        {
+            ClaheRun(src, srcStride, width, height, tilesX, tilesY, clipLimit, dst, dstStride, ClaheRow);
+        }
     }
 }
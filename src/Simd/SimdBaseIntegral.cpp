@@ -22,11 +22,81 @@
 * SOFTWARE.
 */
 #include "Simd/SimdIntegral.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
     namespace Base
     {
+        template <class TSrc, class TSum, class TSqsum> void IntegralTwoPass(const TSrc * src, size_t srcStride, size_t width, size_t height,
+            TSum * sum, size_t sumStride, TSqsum * sqsum, size_t sqsumStride, size_t threadNumber)
+        {
+            memset(sum, 0, (width + 1) * sizeof(TSum));
+            if (sqsum)
+                memset(sqsum, 0, (width + 1) * sizeof(TSqsum));
+
+            Simd::Parallel(0, height, [&](size_t thread, size_t begin, size_t end)
+            {
+                end = Simd::Min(end, height);
+                for (size_t row = begin; row < end; ++row)
+                {
+                    if (sqsum)
+                        IntegralRowSumSqsum(src + row * srcStride, width, sum + (row + 1) * sumStride + 1, sqsum + (row + 1) * sqsumStride + 1);
+                    else
+                        IntegralRowSum(src + row * srcStride, width, sum + (row + 1) * sumStride + 1);
+                }
+            }, threadNumber);
+
+            Simd::Parallel(0, width, [&](size_t thread, size_t begin, size_t end)
+            {
+                end = Simd::Min(end, width);
+                for (size_t col = begin; col < end; col += INTEGRAL_STRIP)
+                {
+                    size_t size = Simd::Min(end - col, INTEGRAL_STRIP);
+                    IntegralColSum(sum + sumStride + 1 + col, sumStride, size, height);
+                    if (sqsum)
+                        IntegralColSum(sqsum + sqsumStride + 1 + col, sqsumStride, size, height);
+                }
+            }, threadNumber, INTEGRAL_STRIP);
+        }
+
+        size_t IntegralThreadNumber(size_t width, size_t height)
+        {
+            return Simd::Min(GetThreadNumber(), height / INTEGRAL_BAND_MIN);
+        }
+
+        void IntegralParallel(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * sum, size_t sumStride,
+            uint8_t * sqsum, size_t sqsumStride, SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat, size_t threadNumber)
+        {
+            assert(sumFormat == SimdPixelFormatInt32 && sumStride % sizeof(uint32_t) == 0);
+
+            if (sqsum)
+            {
+                switch (sqsumFormat)
+                {
+                case SimdPixelFormatInt32:
+                    IntegralTwoPass(src, srcStride, width, height, (uint32_t*)sum, sumStride / sizeof(uint32_t), 
+                        (uint32_t*)sqsum, sqsumStride / sizeof(uint32_t), threadNumber);
+                    break;
+                case SimdPixelFormatInt64:
+                    IntegralTwoPass(src, srcStride, width, height, (uint32_t*)sum, sumStride / sizeof(uint32_t), 
+                        (uint64_t*)sqsum, sqsumStride / sizeof(uint64_t), threadNumber);
+                    break;
+                case SimdPixelFormatDouble:
+                    IntegralTwoPass(src, srcStride, width, height, (uint32_t*)sum, sumStride / sizeof(uint32_t), 
+                        (double*)sqsum, sqsumStride / sizeof(double), threadNumber);
+                    break;
+                default:
+                    assert(0);
+                }
+            }
+            else
+                IntegralTwoPass(src, srcStride, width, height, (uint32_t*)sum, sumStride / sizeof(uint32_t), (uint32_t*)NULL, 0, threadNumber);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
         void Integral(const uint8_t * src, size_t srcStride, size_t width, size_t height,
             uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride,
             SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat)
@@ -35,6 +105,13 @@ namespace Simd
             if (tilted)
                 assert(tiltedStride % sizeof(uint32_t) == 0);
 
+            size_t threadNumber = IntegralThreadNumber(width, height);
+            if (threadNumber > 1 && tilted == NULL)
+            {
+                IntegralParallel(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, sumFormat, sqsumFormat, threadNumber);
+                return;
+            }
+
             if (sqsum)
             {
                 if (tilted)
@@ -45,6 +122,10 @@ namespace Simd
                         IntegralSumSqsumTilted<uint32_t, uint32_t>(src, srcStride, width, height,
                             (uint32_t*)sum, sumStride / sizeof(uint32_t), (uint32_t*)sqsum, sqsumStride / sizeof(uint32_t), (uint32_t*)tilted, tiltedStride / sizeof(uint32_t));
                         break;
+                    case SimdPixelFormatInt64:
+                        IntegralSumSqsumTilted<uint32_t, uint64_t>(src, srcStride, width, height,
+                            (uint32_t*)sum, sumStride / sizeof(uint32_t), (uint64_t*)sqsum, sqsumStride / sizeof(uint64_t), (uint32_t*)tilted, tiltedStride / sizeof(uint32_t));
+                        break;
                     case SimdPixelFormatDouble:
                         IntegralSumSqsumTilted<uint32_t, double>(src, srcStride, width, height,
                             (uint32_t*)sum, sumStride / sizeof(uint32_t), (double*)sqsum, sqsumStride / sizeof(double), (uint32_t*)tilted, tiltedStride / sizeof(uint32_t));
@@ -61,6 +142,10 @@ namespace Simd
                         IntegralSumSqsum<uint32_t, uint32_t>(src, srcStride, width, height,
                             (uint32_t*)sum, sumStride / sizeof(uint32_t), (uint32_t*)sqsum, sqsumStride / sizeof(uint32_t));
                         break;
+                    case SimdPixelFormatInt64:
+                        IntegralSumSqsum<uint32_t, uint64_t>(src, srcStride, width, height,
+                            (uint32_t*)sum, sumStride / sizeof(uint32_t), (uint64_t*)sqsum, sqsumStride / sizeof(uint64_t));
+                        break;
                     case SimdPixelFormatDouble:
                         IntegralSumSqsum<uint32_t, double>(src, srcStride, width, height,
                             (uint32_t*)sum, sumStride / sizeof(uint32_t), (double*)sqsum, sqsumStride / sizeof(double));
@@ -83,5 +168,18 @@ namespace Simd
                 }
             }
         }
+
+        //-----------------------------------------------------------------------------------------
+
+        void Integral32f(const float * src, size_t srcStride, size_t width, size_t height, double * sum, size_t sumStride, double * sqsum, size_t sqsumStride)
+        {
+            size_t threadNumber = IntegralThreadNumber(width, height);
+            if (threadNumber > 1)
+                IntegralTwoPass(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, threadNumber);
+            else if (sqsum)
+                IntegralSumSqsum<double, double>(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride);
+            else
+                IntegralSum<double>(src, srcStride, width, height, sum, sumStride);
+        }
     }
 }
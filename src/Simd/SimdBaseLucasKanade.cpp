@@ -0,0 +1,196 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdLucasKanade.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+#include <vector>
+
+namespace Simd
+{
+    namespace Base
+    {
+        void LucasKanadeSample(const uint8_t * src, size_t stride, size_t width, size_t height, const float * weights, float * dst)
+        {
+            for (size_t y = 0; y < height; ++y)
+            {
+                const uint8_t * s0 = src + y * stride, * s1 = s0 + stride;
+                for (size_t x = 0; x < width; ++x)
+                    dst[x] = weights[0] * s0[x] + weights[1] * s0[x + 1] + weights[2] * s1[x] + weights[3] * s1[x + 1];
+                dst += width;
+            }
+        }
+
+        void LucasKanadeGradient(const float * patch, size_t size, float * dx, float * dy, float * hessian)
+        {
+            const size_t stride = size + 2;
+            float xx = 0, xy = 0, yy = 0;
+            for (size_t y = 0; y < size; ++y)
+            {
+                const float * p0 = patch + y * stride, * p1 = p0 + stride, * p2 = p1 + stride;
+                for (size_t x = 0; x < size; ++x)
+                {
+                    float gx = (p1[x + 2] - p1[x]) * 0.5f;
+                    float gy = (p2[x + 1] - p0[x + 1]) * 0.5f;
+                    xx += gx * gx;
+                    xy += gx * gy;
+                    yy += gy * gy;
+                    dx[x] = gx;
+                    dy[x] = gy;
+                }
+                dx += size;
+                dy += size;
+            }
+            hessian[0] = xx;
+            hessian[1] = xy;
+            hessian[2] = yy;
+        }
+
+        void LucasKanadeMismatch(const float * prev, const float * next, const float * dx, const float * dy, size_t count, float * sums)
+        {
+            float bx = 0, by = 0, err = 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                float diff = next[i] - prev[i];
+                bx += diff * dx[i];
+                by += diff * dy[i];
+                err += ::fabs(diff);
+            }
+            sums[0] = bx;
+            sums[1] = by;
+            sums[2] = err;
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        SIMD_INLINE void LucasKanadeSampleBorder(const uint8_t * src, size_t stride, ptrdiff_t width, ptrdiff_t height,
+            ptrdiff_t ix, ptrdiff_t iy, size_t sizeX, size_t sizeY, const float * weights, float * dst)
+        {
+            for (size_t y = 0; y < sizeY; ++y)
+            {
+                const uint8_t * s0 = src + Simd::RestrictRange<ptrdiff_t>(iy + y, 0, height - 1) * stride;
+                const uint8_t * s1 = src + Simd::RestrictRange<ptrdiff_t>(iy + y + 1, 0, height - 1) * stride;
+                for (size_t x = 0; x < sizeX; ++x)
+                {
+                    ptrdiff_t x0 = Simd::RestrictRange<ptrdiff_t>(ix + x, 0, width - 1);
+                    ptrdiff_t x1 = Simd::RestrictRange<ptrdiff_t>(ix + x + 1, 0, width - 1);
+                    dst[x] = weights[0] * s0[x0] + weights[1] * s0[x1] + weights[2] * s1[x0] + weights[3] * s1[x1];
+                }
+                dst += sizeX;
+            }
+        }
+
+        SIMD_INLINE void LucasKanadeSamplePatch(const uint8_t * src, size_t stride, size_t width, size_t height,
+            float x, float y, size_t size, LucasKanadeSamplePtr sample, float * dst)
+        {
+            float fx = ::floor(x), fy = ::floor(y);
+            ptrdiff_t ix = ptrdiff_t(fx), iy = ptrdiff_t(fy);
+            float wx = x - fx, wy = y - fy;
+            float weights[4] = { (1.0f - wx) * (1.0f - wy), wx * (1.0f - wy), (1.0f - wx) * wy, wx * wy };
+            if (ix >= 0 && iy >= 0 && ix + ptrdiff_t(size) < ptrdiff_t(width) && iy + ptrdiff_t(size) < ptrdiff_t(height))
+                sample(src + iy * stride + ix, stride, size, size, weights, dst);
+            else
+                LucasKanadeSampleBorder(src, stride, width, height, ix, iy, size, size, weights, dst);
+        }
+
+        void LucasKanadeTrackRun(const uint8_t * prev, size_t prevStride, const uint8_t * next, size_t nextStride, size_t width, size_t height,
+            const float * prevPoints, float * nextPoints, size_t count, size_t window, size_t iterations, float epsilon, float minEigen,
+            uint8_t * status, float * errors, LucasKanadeSamplePtr sample, LucasKanadeGradientPtr gradient, LucasKanadeMismatchPtr mismatch)
+        {
+            assert(window >= 3 && window <= LUCAS_KANADE_WINDOW_MAX && (window & 1) == 1 && iterations > 0);
+
+            const size_t area = window * window, patch = (window + 2) * (window + 2);
+            const float half = float(window / 2), epsilon2 = epsilon * epsilon;
+            const float minX = -half, minY = -half, maxX = float(width - 1) + half, maxY = float(height - 1) + half;
+
+            Simd::Parallel(0, count, [&](size_t thread, size_t begin, size_t end)
+            {
+                std::vector<float> buffer(patch + area * 4);
+                float * prevPatch = buffer.data(), * prevWindow = prevPatch + patch;
+                float * nextWindow = prevWindow + area, * dx = nextWindow + area, * dy = dx + area;
+                for (size_t i = begin; i < end; ++i)
+                {
+                    if (status[i] == 0)
+                        continue;
+                    float px = prevPoints[2 * i + 0], py = prevPoints[2 * i + 1];
+                    float nx = nextPoints[2 * i + 0], ny = nextPoints[2 * i + 1];
+                    if (px < minX || py < minY || px > maxX || py > maxY)
+                    {
+                        status[i] = 0;
+                        continue;
+                    }
+
+                    LucasKanadeSamplePatch(prev, prevStride, width, height, px - half - 1.0f, py - half - 1.0f, window + 2, sample, prevPatch);
+                    float hessian[3];
+                    gradient(prevPatch, window, dx, dy, hessian);
+                    for (size_t y = 0; y < window; ++y)
+                        memcpy(prevWindow + y * window, prevPatch + (y + 1) * (window + 2) + 1, window * sizeof(float));
+
+                    float a = hessian[0], b = hessian[1], c = hessian[2];
+                    float eigen = (a + c - ::sqrt((a - c) * (a - c) + 4.0f * b * b)) * 0.5f / float(area);
+                    float det = a * c - b * b;
+                    if (eigen < minEigen || det < FLT_EPSILON)
+                    {
+                        status[i] = 0;
+                        continue;
+                    }
+                    det = 1.0f / det;
+
+                    float sums[3] = { 0, 0, 0 };
+                    for (size_t iteration = 0; iteration < iterations; ++iteration)
+                    {
+                        if (nx < minX || ny < minY || nx > maxX || ny > maxY)
+                        {
+                            status[i] = 0;
+                            break;
+                        }
+                        LucasKanadeSamplePatch(next, nextStride, width, height, nx - half, ny - half, window, sample, nextWindow);
+                        mismatch(prevWindow, nextWindow, dx, dy, area, sums);
+                        float shiftX = (b * sums[1] - c * sums[0]) * det;
+                        float shiftY = (b * sums[0] - a * sums[1]) * det;
+                        nx += shiftX;
+                        ny += shiftY;
+                        if (shiftX * shiftX + shiftY * shiftY < epsilon2)
+                            break;
+                    }
+                    if (status[i] == 0)
+                        continue;
+                    nextPoints[2 * i + 0] = nx;
+                    nextPoints[2 * i + 1] = ny;
+                    if (errors)
+                        errors[i] = sums[2] / float(area);
+                }
+            }, Simd::Min(GetThreadNumber(), DivHi(count, LUCAS_KANADE_POINTS_MIN)));
+        }
+
+        void LucasKanadeTrack(const uint8_t * prev, size_t prevStride, const uint8_t * next, size_t nextStride, size_t width, size_t height,
+            const float * prevPoints, float * nextPoints, size_t count, size_t window, size_t iterations, float epsilon, float minEigen,
+            uint8_t * status, float * errors)
+        {
+            LucasKanadeTrackRun(prev, prevStride, next, nextStride, width, height, prevPoints, nextPoints, count, window, iterations,
+                epsilon, minEigen, status, errors, LucasKanadeSample, LucasKanadeGradient, LucasKanadeMismatch);
+        }
+    }
+}
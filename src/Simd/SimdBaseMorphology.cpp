@@ -0,0 +1,180 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMorphology.h"
+#include "Simd/SimdMemory.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        void MorphologyRowMin(const uint8_t * a, const uint8_t * b, size_t size, uint8_t * dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = Simd::Min(a[i], b[i]);
+        }
+
+        void MorphologyRowMax(const uint8_t * a, const uint8_t * b, size_t size, uint8_t * dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = Simd::Max(a[i], b[i]);
+        }
+
+        SIMD_INLINE void MorphologyCopyRows(const uint8_t * src, size_t srcStride, size_t size, size_t height, uint8_t * dst, size_t dstStride)
+        {
+            for (size_t row = 0; row < height; ++row, src += srcStride, dst += dstStride)
+                memcpy(dst, src, size);
+        }
+
+        // Van Herk/Gil-Werman filter along columns: the padded column is split into blocks of kernel size, 
+        // the result is a combination of a backward prefix of one block and a forward prefix of the next one.
+        static void MorphologyVertical(const uint8_t * src, size_t srcStride, size_t size, size_t height, size_t radius, 
+            MorphologyRowPtr rowOp, uint8_t * bwd, uint8_t * fwd, uint8_t * dst, size_t dstStride)
+        {
+            ptrdiff_t kernel = 2 * radius + 1, r = radius;
+            for (ptrdiff_t block = 0; block < (ptrdiff_t)height; block += kernel)
+            {
+                memcpy(bwd + (kernel - 1)*size, src + MorphologyIndex(block + kernel - 1 - r, height)*srcStride, size);
+                for (ptrdiff_t i = kernel - 2; i >= 0; --i)
+                    rowOp(bwd + (i + 1)*size, src + MorphologyIndex(block + i - r, height)*srcStride, size, bwd + i*size);
+                memcpy(dst + block*dstStride, bwd, size);
+                for (ptrdiff_t row = block + 1, end = Simd::Min<ptrdiff_t>(block + kernel, height); row < end; ++row)
+                {
+                    const uint8_t * next = src + MorphologyIndex(row + r, height)*srcStride;
+                    if (row == block + 1)
+                        memcpy(fwd, next, size);
+                    else
+                        rowOp(fwd, next, size, fwd);
+                    rowOp(bwd + (row - block)*size, fwd, size, dst + row*dstStride);
+                }
+            }
+        }
+
+        template<bool max> SIMD_INLINE uint8_t MorphologyOp(uint8_t a, uint8_t b)
+        {
+            return max ? Simd::Max(a, b) : Simd::Min(a, b);
+        }
+
+        // The same filter along rows of the image (in-place).
+        template<bool max> void MorphologyHorizontal(uint8_t * dst, size_t dstStride, size_t width, size_t height, size_t channelCount,
+            size_t radius, MorphologyRowPtr rowOp, uint8_t * line, uint8_t * fwd, uint8_t * bwd)
+        {
+            if (width == 0)
+                return;
+            size_t size = width*channelCount, border = radius*channelCount, step = (2 * radius + 1)*channelCount;
+            size_t full = size + 2 * border;
+            for (size_t row = 0; row < height; ++row, dst += dstStride)
+            {
+                for (size_t i = 0; i < border; i += channelCount)
+                {
+                    for (size_t c = 0; c < channelCount; ++c)
+                    {
+                        line[i + c] = dst[c];
+                        line[border + size + i + c] = dst[size - channelCount + c];
+                    }
+                }
+                memcpy(line + border, dst, size);
+                for (size_t block = 0; block < full; block += step)
+                {
+                    size_t end = Simd::Min(block + step, full);
+                    for (size_t i = block, first = block + channelCount; i < end; ++i)
+                        fwd[i] = i < first ? line[i] : MorphologyOp<max>(fwd[i - channelCount], line[i]);
+                    for (size_t i = end, last = end - channelCount; i > block; --i)
+                        bwd[i - 1] = i > last ? line[i - 1] : MorphologyOp<max>(bwd[i - 1 + channelCount], line[i - 1]);
+                }
+                rowOp(bwd, fwd + step - channelCount, size, dst);
+            }
+        }
+
+        template<bool max> void Morphology(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount,
+            size_t radiusX, size_t radiusY, MorphologyRowPtr rowOp, MorphologyBuffer & buffer, uint8_t * dst, size_t dstStride)
+        {
+            size_t size = width*channelCount;
+            if (radiusY)
+            {
+                for (size_t col = 0; col < size; col += MORPHOLOGY_STRIP)
+                {
+                    size_t strip = Simd::Min(MORPHOLOGY_STRIP, size - col);
+                    if (src == dst)
+                    {
+                        MorphologyCopyRows(src + col, srcStride, strip, height, buffer.copy, strip);
+                        MorphologyVertical(buffer.copy, strip, strip, height, radiusY, rowOp, buffer.rowsBwd, buffer.rowFwd, dst + col, dstStride);
+                    }
+                    else
+                        MorphologyVertical(src + col, srcStride, strip, height, radiusY, rowOp, buffer.rowsBwd, buffer.rowFwd, dst + col, dstStride);
+                }
+            }
+            else if (src != dst)
+                MorphologyCopyRows(src, srcStride, size, height, dst, dstStride);
+            if (radiusX)
+                MorphologyHorizontal<max>(dst, dstStride, width, height, channelCount, radiusX, rowOp, buffer.lineSrc, buffer.lineFwd, buffer.lineBwd);
+        }
+
+        void Morphology(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount,
+            size_t radiusX, size_t radiusY, SimdMorphologyType type, uint8_t * dst, size_t dstStride, 
+            MorphologyRowPtr rowMin, MorphologyRowPtr rowMax)
+        {
+            MorphologyBuffer buffer(width, height, channelCount, radiusX, radiusY, src == dst || type != SimdMorphologyErode && type != SimdMorphologyDilate);
+            switch (type)
+            {
+            case SimdMorphologyErode:
+                Morphology<false>(src, srcStride, width, height, channelCount, radiusX, radiusY, rowMin, buffer, dst, dstStride);
+                break;
+            case SimdMorphologyDilate:
+                Morphology<true>(src, srcStride, width, height, channelCount, radiusX, radiusY, rowMax, buffer, dst, dstStride);
+                break;
+            case SimdMorphologyOpen:
+                Morphology<false>(src, srcStride, width, height, channelCount, radiusX, radiusY, rowMin, buffer, dst, dstStride);
+                Morphology<true>(dst, dstStride, width, height, channelCount, radiusX, radiusY, rowMax, buffer, dst, dstStride);
+                break;
+            case SimdMorphologyClose:
+                Morphology<true>(src, srcStride, width, height, channelCount, radiusX, radiusY, rowMax, buffer, dst, dstStride);
+                Morphology<false>(dst, dstStride, width, height, channelCount, radiusX, radiusY, rowMin, buffer, dst, dstStride);
+                break;
+            case SimdMorphologyGradient:
+            {
+                size_t size = width*channelCount;
+                Array8u eroded(size*height);
+                Morphology<false>(src, srcStride, width, height, channelCount, radiusX, radiusY, rowMin, buffer, eroded.data, size);
+                Morphology<true>(src, srcStride, width, height, channelCount, radiusX, radiusY, rowMax, buffer, dst, dstStride);
+                for (size_t row = 0; row < height; ++row)
+                {
+                    const uint8_t * e = eroded.data + row*size;
+                    uint8_t * d = dst + row*dstStride;
+                    for (size_t i = 0; i < size; ++i)
+                        d[i] = d[i] - e[i];
+                }
+                break;
+            }
+            default:
+                assert(0);
+            }
+        }
+
+        void Morphology(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount,
+            size_t radiusX, size_t radiusY, SimdMorphologyType type, uint8_t * dst, size_t dstStride)
+        {
+            Morphology(src, srcStride, width, height, channelCount, radiusX, radiusY, type, dst, dstStride, MorphologyRowMin, MorphologyRowMax);
+        }
+    }
+}
@@ -0,0 +1,141 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdNonMaxSuppression.h"
+#include "Simd/SimdBase.h"
+
+#include <vector>
+#include <algorithm>
+
+namespace Simd
+{
+    namespace Base
+    {
+        void NonMaxSuppressionIou(const float * x1, const float * y1, const float * x2, const float * y2, const float * area,
+            size_t count, const float * box, float * iou)
+        {
+            for (size_t i = 0; i < count; ++i)
+                iou[i] = NonMaxSuppressionIou(x1[i], y1[i], x2[i], y2[i], area[i], box);
+        }
+
+        struct ScoreGreater
+        {
+            ScoreGreater(const float * scores) : _scores(scores) {}
+
+            SIMD_INLINE bool operator() (size_t a, size_t b) const
+            {
+                return _scores[a] > _scores[b];
+            }
+
+        private:
+            const float * _scores;
+        };
+
+        size_t NonMaxSuppressionRun(const float * boxes, float * scores, size_t count, SimdNonMaxSuppressionType type,
+            float iouThreshold, float sigma, float scoreThreshold, size_t * indices, NonMaxSuppressionIouPtr iou)
+        {
+            std::vector<size_t> index;
+            index.reserve(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (scores[i] >= scoreThreshold)
+                    index.push_back(i);
+                else
+                    scores[i] = 0.0f;
+            }
+            std::stable_sort(index.begin(), index.end(), ScoreGreater(scores));
+
+            size_t size = index.size();
+            std::vector<float> buffer(size * 7);
+            float * x1 = buffer.data(), * y1 = x1 + size, * x2 = y1 + size, * y2 = x2 + size;
+            float * area = y2 + size, * score = area + size, * overlap = score + size;
+            for (size_t i = 0; i < size; ++i)
+            {
+                const float * b = boxes + index[i] * 4;
+                x1[i] = b[0], y1[i] = b[1], x2[i] = b[2], y2[i] = b[3];
+                area[i] = std::max(b[2] - b[0], 0.0f) * std::max(b[3] - b[1], 0.0f);
+                score[i] = scores[index[i]];
+            }
+
+            size_t kept = 0;
+            while (size)
+            {
+                size_t best = 0;
+                if (type != SimdNonMaxSuppressionHard)
+                {
+                    for (size_t i = 1; i < size; ++i)
+                        if (score[i] > score[best])
+                            best = i;
+                }
+                indices[kept++] = index[best];
+                scores[index[best]] = score[best];
+
+                const float box[5] = { x1[best], y1[best], x2[best], y2[best], area[best] };
+                iou(x1, y1, x2, y2, area, size, box, overlap);
+
+                size_t rest = 0;
+                for (size_t i = 0; i < size; ++i)
+                {
+                    if (i == best)
+                        continue;
+                    float value = score[i], o = overlap[i];
+                    bool suppressed;
+                    switch (type)
+                    {
+                    case SimdNonMaxSuppressionHard:
+                        suppressed = o > iouThreshold;
+                        break;
+                    case SimdNonMaxSuppressionLinear:
+                        if (o > iouThreshold)
+                            value *= 1.0f - o;
+                        suppressed = value < scoreThreshold;
+                        break;
+                    case SimdNonMaxSuppressionGaussian:
+                        value *= ::expf(-o * o / sigma);
+                        suppressed = value < scoreThreshold;
+                        break;
+                    default:
+                        assert(0);
+                        suppressed = true;
+                    }
+                    if (suppressed)
+                    {
+                        scores[index[i]] = 0.0f;
+                        continue;
+                    }
+                    x1[rest] = x1[i], y1[rest] = y1[i], x2[rest] = x2[i], y2[rest] = y2[i];
+                    area[rest] = area[i], score[rest] = value, index[rest] = index[i];
+                    rest++;
+                }
+                size = rest;
+            }
+            return kept;
+        }
+
+        size_t NonMaxSuppression32f(const float * boxes, float * scores, size_t count, SimdNonMaxSuppressionType type,
+            float iouThreshold, float sigma, float scoreThreshold, size_t * indices)
+        {
+            return NonMaxSuppressionRun(boxes, scores, count, type, iouThreshold, sigma, scoreThreshold, indices, NonMaxSuppressionIou);
+        }
+    }
+}
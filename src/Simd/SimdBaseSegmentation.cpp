@@ -22,6 +22,9 @@
 * SOFTWARE.
 */
 #include "Simd/SimdDefs.h"
+#include "Simd/SimdSegmentation.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
 
 namespace Simd
 {
@@ -191,5 +194,286 @@ namespace Simd
                 }
             }
         }
+
+        //-----------------------------------------------------------------------------------------
+
+        size_t LabelRowRuns(const uint8_t * mask, size_t width, uint8_t index, int32_t * runs)
+        {
+            size_t count = 0, col = 0;
+            while (col < width)
+            {
+                while (col < width && mask[col] != index)
+                    col++;
+                if (col == width)
+                    break;
+                runs[2 * count + 0] = (int32_t)col;
+                while (col < width && mask[col] == index)
+                    col++;
+                runs[2 * count + 1] = (int32_t)col;
+                count++;
+            }
+            return count;
+        }
+
+        namespace
+        {
+            struct LabelRun
+            {
+                int32_t begin, end;
+                uint32_t label;
+            };
+
+            struct LabelStat
+            {
+                uint64_t area, sumX, sumY;
+                int32_t left, top, right, bottom;
+
+                SIMD_INLINE void Init(const LabelRun & run, int32_t row)
+                {
+                    area = 0, sumX = 0, sumY = 0;
+                    left = run.begin, top = row, right = run.end, bottom = row + 1;
+                }
+
+                SIMD_INLINE void Add(const LabelRun & run, int32_t row)
+                {
+                    uint64_t size = run.end - run.begin;
+                    area += size;
+                    sumX += (uint64_t(run.begin) + run.end - 1) * size / 2;
+                    sumY += uint64_t(row) * size;
+                    left = Simd::Min(left, run.begin);
+                    right = Simd::Max(right, run.end);
+                    bottom = row + 1;
+                }
+
+                SIMD_INLINE void Add(const LabelStat & stat)
+                {
+                    area += stat.area;
+                    sumX += stat.sumX;
+                    sumY += stat.sumY;
+                    left = Simd::Min(left, stat.left);
+                    top = Simd::Min(top, stat.top);
+                    right = Simd::Max(right, stat.right);
+                    bottom = Simd::Max(bottom, stat.bottom);
+                }
+            };
+
+            struct LabelBand
+            {
+                size_t begin, end;
+                std::vector<LabelRun> runs;
+                std::vector<size_t> rows;
+                std::vector<uint32_t> parent;
+                std::vector<LabelStat> stats;
+                uint32_t offset;
+            };
+
+            SIMD_INLINE uint32_t LabelFind(uint32_t * parent, uint32_t label)
+            {
+                uint32_t root = label;
+                while (parent[root] != root)
+                    root = parent[root];
+                while (parent[label] != root)
+                {
+                    uint32_t next = parent[label];
+                    parent[label] = root;
+                    label = next;
+                }
+                return root;
+            }
+
+            SIMD_INLINE uint32_t LabelUnion(uint32_t * parent, uint32_t a, uint32_t b)
+            {
+                a = LabelFind(parent, a);
+                b = LabelFind(parent, b);
+                if (a < b)
+                    return parent[b] = a;
+                else
+                    return parent[a] = b;
+            }
+
+            template<class Connect> void LabelJoinRows(LabelRun * prev, size_t prevSize, LabelRun * curr, size_t currSize, uint32_t * parent, Connect connect)
+            {
+                const int32_t gap = connect.gap;
+                for (size_t p = 0, c = 0; p < prevSize && c < currSize;)
+                {
+                    if (prev[p].end + gap > curr[c].begin && curr[c].end + gap > prev[p].begin)
+                        connect(prev[p], curr[c], parent);
+                    if (prev[p].end < curr[c].end)
+                        p++;
+                    else
+                        c++;
+                }
+            }
+
+            struct LabelConnectNew
+            {
+                int32_t gap;
+                SIMD_INLINE void operator()(const LabelRun & prev, LabelRun & curr, uint32_t * parent) const
+                {
+                    if (curr.label == UINT32_MAX)
+                        curr.label = LabelFind(parent, prev.label);
+                    else
+                        LabelUnion(parent, prev.label, curr.label);
+                }
+            };
+
+            struct LabelConnectAny
+            {
+                int32_t gap;
+                SIMD_INLINE void operator()(const LabelRun & prev, LabelRun & curr, uint32_t * parent) const
+                {
+                    LabelUnion(parent, prev.label, curr.label);
+                }
+            };
+
+            void LabelBandRuns(const uint8_t * mask, size_t maskStride, size_t width, uint8_t index, int32_t gap,
+                LabelRowRunsPtr labelRowRuns, int32_t * buffer, LabelBand & band)
+            {
+                band.rows.resize(band.end - band.begin + 1);
+                band.rows[0] = 0;
+                for (size_t row = band.begin; row < band.end; ++row)
+                {
+                    size_t count = labelRowRuns(mask + row * maskStride, width, index, buffer);
+                    size_t curr = band.runs.size();
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        LabelRun run = { buffer[2 * i + 0], buffer[2 * i + 1], UINT32_MAX };
+                        band.runs.push_back(run);
+                    }
+                    band.rows[row - band.begin + 1] = band.runs.size();
+                    if (row > band.begin)
+                    {
+                        size_t prev = band.rows[row - band.begin - 1];
+                        LabelConnectNew connect = { gap };
+                        LabelJoinRows(band.runs.data() + prev, curr - prev, band.runs.data() + curr, count, band.parent.data(), connect);
+                    }
+                    for (size_t i = curr; i < band.runs.size(); ++i)
+                    {
+                        LabelRun & run = band.runs[i];
+                        if (run.label == UINT32_MAX)
+                        {
+                            run.label = (uint32_t)band.parent.size();
+                            band.parent.push_back(run.label);
+                            band.stats.push_back(LabelStat());
+                            band.stats.back().Init(run, (int32_t)row);
+                        }
+                        band.stats[run.label].Add(run, (int32_t)row);
+                    }
+                }
+            }
+        }
+
+        size_t LabelComponentsRun(const uint8_t * mask, size_t maskStride, size_t width, size_t height, uint8_t index, SimdConnectivityType connectivity,
+            uint32_t * labels, size_t labelsStride, SimdConnectedComponent * components, size_t capacity, LabelRowRunsPtr labelRowRuns)
+        {
+            assert(connectivity == SimdConnectivity4 || connectivity == SimdConnectivity8);
+
+            int32_t gap = connectivity == SimdConnectivity8 ? 1 : 0;
+            size_t threadNumber = Simd::Min(GetThreadNumber(), height / LABEL_BAND_MIN);
+            size_t bandNumber = Simd::Max<size_t>(threadNumber, 1);
+            std::vector<LabelBand> bands(bandNumber);
+            for (size_t b = 0; b < bandNumber; ++b)
+            {
+                bands[b].begin = b * height / bandNumber;
+                bands[b].end = (b + 1) * height / bandNumber;
+            }
+
+            Simd::Parallel(0, bandNumber, [&](size_t thread, size_t begin, size_t end)
+            {
+                std::vector<int32_t> buffer(width + 2);
+                for (size_t b = begin; b < end && b < bandNumber; ++b)
+                    LabelBandRuns(mask, maskStride, width, index, gap, labelRowRuns, buffer.data(), bands[b]);
+            }, threadNumber);
+
+            size_t total = 0;
+            for (size_t b = 0; b < bandNumber; ++b)
+            {
+                bands[b].offset = (uint32_t)total;
+                total += bands[b].parent.size();
+            }
+            std::vector<uint32_t> parent(total);
+            std::vector<LabelStat> stats(total);
+            for (size_t b = 0; b < bandNumber; ++b)
+            {
+                LabelBand & band = bands[b];
+                for (size_t i = 0; i < band.parent.size(); ++i)
+                {
+                    parent[band.offset + i] = LabelFind(band.parent.data(), (uint32_t)i) + band.offset;
+                    stats[band.offset + i] = band.stats[i];
+                }
+                for (size_t i = 0; i < band.runs.size(); ++i)
+                    band.runs[i].label = LabelFind(band.parent.data(), band.runs[i].label) + band.offset;
+                if (b)
+                {
+                    LabelBand & prev = bands[b - 1];
+                    size_t prevRows = prev.end - prev.begin;
+                    LabelConnectAny connect = { gap };
+                    LabelJoinRows(prev.runs.data() + prev.rows[prevRows - 1], prev.rows[prevRows] - prev.rows[prevRows - 1], 
+                        band.runs.data(), band.rows[1], parent.data(), connect);
+                }
+            }
+
+            std::vector<uint32_t> relabel(total);
+            size_t count = 0;
+            for (size_t i = 0; i < total; ++i)
+            {
+                uint32_t root = LabelFind(parent.data(), (uint32_t)i);
+                if (root == i)
+                    relabel[i] = (uint32_t)++count;
+                else
+                {
+                    relabel[i] = relabel[root];
+                    stats[root].Add(stats[i]);
+                }
+            }
+
+            for (size_t i = 0; i < total; ++i)
+            {
+                size_t component = relabel[i] - 1;
+                if (parent[i] == i && component < capacity)
+                {
+                    const LabelStat & stat = stats[i];
+                    SimdConnectedComponent & dst = components[component];
+                    dst.area = (size_t)stat.area;
+                    dst.left = stat.left;
+                    dst.top = stat.top;
+                    dst.right = stat.right;
+                    dst.bottom = stat.bottom;
+                    dst.x = double(stat.sumX) / double(stat.area);
+                    dst.y = double(stat.sumY) / double(stat.area);
+                }
+            }
+
+            if (labels)
+            {
+                Simd::Parallel(0, bandNumber, [&](size_t thread, size_t begin, size_t end)
+                {
+                    for (size_t b = begin; b < end && b < bandNumber; ++b)
+                    {
+                        const LabelBand & band = bands[b];
+                        for (size_t row = band.begin; row < band.end; ++row)
+                        {
+                            uint32_t * dst = labels + row * labelsStride;
+                            memset(dst, 0, width * sizeof(uint32_t));
+                            for (size_t i = band.rows[row - band.begin], n = band.rows[row - band.begin + 1]; i < n; ++i)
+                            {
+                                const LabelRun & run = band.runs[i];
+                                uint32_t label = relabel[run.label];
+                                for (int32_t col = run.begin; col < run.end; ++col)
+                                    dst[col] = label;
+                            }
+                        }
+                    }
+                }, threadNumber);
+            }
+
+            return count;
+        }
+
+        size_t SegmentationLabelComponents(const uint8_t * mask, size_t maskStride, size_t width, size_t height, uint8_t index, SimdConnectivityType connectivity,
+            uint32_t * labels, size_t labelsStride, SimdConnectedComponent * components, size_t capacity)
+        {
+            return LabelComponentsRun(mask, maskStride, width, height, index, connectivity, labels, labelsStride, components, capacity, LabelRowRuns);
+        }
     }
 }
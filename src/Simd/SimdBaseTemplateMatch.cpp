@@ -0,0 +1,193 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdTemplateMatch.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+#include <vector>
+#include <algorithm>
+
+namespace Simd
+{
+    namespace Base
+    {
+        void TemplateMatchDot(const uint8_t * src, size_t srcStride, const uint8_t * tmpl, size_t tmplStride,
+            size_t tmplWidth, size_t tmplHeight, size_t width, int32_t * dot)
+        {
+            for (size_t x = 0; x < width; ++x)
+            {
+                int32_t sum = 0;
+                for (size_t ty = 0; ty < tmplHeight; ++ty)
+                {
+                    const uint8_t * s = src + ty * srcStride + x;
+                    const uint8_t * t = tmpl + ty * tmplStride;
+                    for (size_t tx = 0; tx < tmplWidth; ++tx)
+                        sum += s[tx] * t[tx];
+                }
+                dot[x] = sum;
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        static void TemplateMatchIntegral(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint32_t * sum, uint64_t * sqsum)
+        {
+            size_t stride = width + 1;
+            memset(sum, 0, stride * sizeof(uint32_t));
+            memset(sqsum, 0, stride * sizeof(uint64_t));
+            for (size_t y = 0; y < height; ++y)
+            {
+                uint32_t * s0 = sum + y * stride, * s1 = s0 + stride;
+                uint64_t * q0 = sqsum + y * stride, * q1 = q0 + stride;
+                uint32_t rowSum = 0;
+                uint64_t rowSqsum = 0;
+                s1[0] = 0;
+                q1[0] = 0;
+                for (size_t x = 0; x < width; ++x)
+                {
+                    uint32_t value = src[x];
+                    rowSum += value;
+                    rowSqsum += value * value;
+                    s1[x + 1] = s0[x + 1] + rowSum;
+                    q1[x + 1] = q0[x + 1] + rowSqsum;
+                }
+                src += srcStride;
+            }
+        }
+
+        void TemplateMatchRun(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const uint8_t * tmpl, size_t tmplStride,
+            size_t tmplWidth, size_t tmplHeight, SimdTemplateMatchType type, float * dst, size_t dstStride, TemplateMatchDotPtr templateMatchDot)
+        {
+            assert(tmplWidth > 0 && tmplHeight > 0 && tmplWidth <= srcWidth && tmplHeight <= srcHeight);
+            assert(tmplWidth * tmplHeight <= TEMPLATE_MATCH_AREA_MAX);
+            assert(type == SimdTemplateMatchSsd || type == SimdTemplateMatchNcc);
+
+            const size_t width = srcWidth - tmplWidth + 1, height = srcHeight - tmplHeight + 1;
+            const double area = double(tmplWidth * tmplHeight);
+
+            int64_t tmplSum = 0, tmplSqsum = 0;
+            for (size_t ty = 0; ty < tmplHeight; ++ty)
+            {
+                for (size_t tx = 0; tx < tmplWidth; ++tx)
+                {
+                    int64_t value = tmpl[ty * tmplStride + tx];
+                    tmplSum += value;
+                    tmplSqsum += value * value;
+                }
+            }
+            const double tmplDev = double(tmplSqsum) - double(tmplSum) * double(tmplSum) / area;
+
+            const size_t stride = srcWidth + 1;
+            std::vector<uint32_t> sum(stride * (srcHeight + 1));
+            std::vector<uint64_t> sqsum(stride * (srcHeight + 1));
+            TemplateMatchIntegral(src, srcStride, srcWidth, srcHeight, sum.data(), sqsum.data());
+
+            Simd::Parallel(0, height, [&](size_t thread, size_t begin, size_t end)
+            {
+                end = Simd::Min(end, height);
+                std::vector<int32_t> dot(width);
+                for (size_t y = begin; y < end; ++y)
+                {
+                    templateMatchDot(src + y * srcStride, srcStride, tmpl, tmplStride, tmplWidth, tmplHeight, width, dot.data());
+                    const uint32_t * s0 = sum.data() + y * stride, * s1 = s0 + tmplHeight * stride;
+                    const uint64_t * q0 = sqsum.data() + y * stride, * q1 = q0 + tmplHeight * stride;
+                    float * d = dst + y * dstStride;
+                    for (size_t x = 0, r = tmplWidth; x < width; ++x, ++r)
+                    {
+                        uint32_t srcSum = s1[r] - s1[x] - s0[r] + s0[x];
+                        uint64_t srcSqsum = q1[r] - q1[x] - q0[r] + q0[x];
+                        if (type == SimdTemplateMatchSsd)
+                            d[x] = float(int64_t(srcSqsum) - 2 * int64_t(dot[x]) + tmplSqsum);
+                        else
+                        {
+                            double srcDev = double(srcSqsum) - double(srcSum) * double(srcSum) / area;
+                            double numerator = double(dot[x]) - double(srcSum) * double(tmplSum) / area;
+                            double denominator = ::sqrt(Simd::Max(srcDev, 0.0) * Simd::Max(tmplDev, 0.0));
+                            d[x] = denominator > 0.5 ? float(Simd::RestrictRange(numerator / denominator, -1.0, 1.0)) : 0.0f;
+                        }
+                    }
+                }
+            }, Simd::Min(GetThreadNumber(), height / TEMPLATE_MATCH_BAND_MIN));
+        }
+
+        void TemplateMatch(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const uint8_t * tmpl, size_t tmplStride,
+            size_t tmplWidth, size_t tmplHeight, SimdTemplateMatchType type, float * dst, size_t dstStride)
+        {
+            TemplateMatchRun(src, srcStride, srcWidth, srcHeight, tmpl, tmplStride, tmplWidth, tmplHeight, type, dst, dstStride, TemplateMatchDot);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        size_t TemplateMatchPeaks(const float * map, size_t mapStride, size_t width, size_t height, SimdTemplateMatchType type,
+            size_t radius, SimdTemplateMatchPeak * peaks, size_t count)
+        {
+            const float sign = type == SimdTemplateMatchSsd ? -1.0f : 1.0f;
+            std::vector<SimdTemplateMatchPeak> candidates;
+            for (size_t y = 0; y < height; ++y)
+            {
+                const float * m = map + y * mapStride;
+                for (size_t x = 0; x < width; ++x)
+                {
+                    float value = m[x] * sign;
+                    bool extremum = true;
+                    for (size_t dy = y ? y - 1 : 0, ey = Simd::Min(y + 2, height); dy < ey && extremum; ++dy)
+                    {
+                        const float * n = map + dy * mapStride;
+                        for (size_t dx = x ? x - 1 : 0, ex = Simd::Min(x + 2, width); dx < ex; ++dx)
+                        {
+                            float other = n[dx] * sign;
+                            if (other > value || (other == value && dy * width + dx < y * width + x))
+                            {
+                                extremum = false;
+                                break;
+                            }
+                        }
+                    }
+                    if (extremum)
+                    {
+                        SimdTemplateMatchPeak peak = { (ptrdiff_t)x, (ptrdiff_t)y, m[x] };
+                        candidates.push_back(peak);
+                    }
+                }
+            }
+            std::stable_sort(candidates.begin(), candidates.end(), [sign](const SimdTemplateMatchPeak & a, const SimdTemplateMatchPeak & b)
+            {
+                return a.value * sign > b.value * sign;
+            });
+
+            size_t found = 0;
+            for (size_t i = 0; i < candidates.size() && found < count; ++i)
+            {
+                const SimdTemplateMatchPeak & candidate = candidates[i];
+                bool suppressed = false;
+                for (size_t j = 0; j < found && !suppressed; ++j)
+                    suppressed = Simd::Abs(peaks[j].x - candidate.x) <= (ptrdiff_t)radius && Simd::Abs(peaks[j].y - candidate.y) <= (ptrdiff_t)radius;
+                if (!suppressed)
+                    peaks[found++] = candidate;
+            }
+            return found;
+        }
+    }
+}
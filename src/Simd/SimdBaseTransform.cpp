@@ -21,7 +21,10 @@
 * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 * SOFTWARE.
 */
-#include "Simd/SimdDefs.h"
+#include "Simd/SimdTransform.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -148,24 +151,77 @@ namespace Simd
             }
         }
 
-        template<size_t N> void TransformImage(const uint8_t * src, size_t srcStride, size_t width, size_t height, SimdTransformType transform, uint8_t * dst, size_t dstStride)
+        template<size_t N> TransformImagePtr GetTransformImage(SimdTransformType transform)
         {
-            typedef void(*TransformImagePtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
             static const TransformImagePtr transformImage[8] = { TransformImageRotate0<N>, TransformImageRotate90<N>, TransformImageRotate180<N>, TransformImageRotate270<N>,
                 TransformImageTransposeRotate0<N>, TransformImageTransposeRotate90<N>, TransformImageTransposeRotate180<N>, TransformImageTransposeRotate270<N> };
-            transformImage[(int)transform](src, srcStride, width, height, dst, dstStride);
+            return transformImage[(int)transform];
         };
 
         void TransformImage(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, SimdTransformType transform, uint8_t * dst, size_t dstStride)
         {
+            TransformImagePtr transformImage = NULL;
             switch (pixelSize)
             {
-            case 1: TransformImage<1>(src, srcStride, width, height, transform, dst, dstStride); break;
-            case 2: TransformImage<2>(src, srcStride, width, height, transform, dst, dstStride); break;
-            case 3: TransformImage<3>(src, srcStride, width, height, transform, dst, dstStride); break;
-            case 4: TransformImage<4>(src, srcStride, width, height, transform, dst, dstStride); break;
+            case 1: transformImage = GetTransformImage<1>(transform); break;
+            case 2: transformImage = GetTransformImage<2>(transform); break;
+            case 3: transformImage = GetTransformImage<3>(transform); break;
+            case 4: transformImage = GetTransformImage<4>(transform); break;
+            default: assert(0); return;
+            }
+            TransformImageTiled(src, srcStride, width, height, pixelSize, transform, dst, dstStride, transformImage);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        SIMD_INLINE bool TransformSwapsAxes(SimdTransformType transform)
+        {
+            return transform == SimdTransformRotate90 || transform == SimdTransformRotate270 || 
+                transform == SimdTransformTransposeRotate0 || transform == SimdTransformTransposeRotate180;
+        }
+
+        static void TransformImageBlock(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, SimdTransformType transform,
+            size_t x, size_t y, size_t w, size_t h, uint8_t * dst, size_t dstStride, TransformImagePtr transformImage)
+        {
+            size_t dx = 0, dy = 0;
+            switch (transform)
+            {
+            case SimdTransformRotate0: dx = x, dy = y; break;
+            case SimdTransformRotate90: dx = y, dy = width - x - w; break;
+            case SimdTransformRotate180: dx = width - x - w, dy = height - y - h; break;
+            case SimdTransformRotate270: dx = height - y - h, dy = x; break;
+            case SimdTransformTransposeRotate0: dx = y, dy = x; break;
+            case SimdTransformTransposeRotate90: dx = width - x - w, dy = y; break;
+            case SimdTransformTransposeRotate180: dx = height - y - h, dy = width - x - w; break;
+            case SimdTransformTransposeRotate270: dx = x, dy = height - y - h; break;
             default: assert(0);
             }
+            transformImage(src + y * srcStride + x * pixelSize, srcStride, w, h, dst + dy * dstStride + dx * pixelSize, dstStride);
+        }
+
+        void TransformImageTiled(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, SimdTransformType transform,
+            uint8_t * dst, size_t dstStride, TransformImagePtr transformImage)
+        {
+            size_t threadNumber = width * height * pixelSize < TRANSFORM_PARALLEL_MIN ? 1 : Simd::Min(GetThreadNumber(), DivHi(height, TRANSFORM_BAND_MIN));
+            bool tiled = TransformSwapsAxes(transform) && width > TRANSFORM_TILE && height > TRANSFORM_TILE;
+            Simd::Parallel(0, height, [&](size_t thread, size_t begin, size_t end)
+            {
+                end = Simd::Min(end, height);
+                if (tiled)
+                {
+                    for (size_t y = begin; y < end; y += TRANSFORM_TILE)
+                    {
+                        size_t h = Simd::Min(TRANSFORM_TILE, end - y);
+                        for (size_t x = 0, w; x < width; x += w)
+                        {
+                            w = width - x < 2 * TRANSFORM_TILE ? width - x : TRANSFORM_TILE;
+                            TransformImageBlock(src, srcStride, width, height, pixelSize, transform, x, y, w, h, dst, dstStride, transformImage);
+                        }
+                    }
+                }
+                else
+                    TransformImageBlock(src, srcStride, width, height, pixelSize, transform, 0, begin, width, end - begin, dst, dstStride, transformImage);
+            }, threadNumber, TRANSFORM_TILE);
         }
     }
 }
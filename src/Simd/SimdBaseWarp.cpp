@@ -0,0 +1,234 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdWarp.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        void WarpCoordsAffine(const float * mx, const float * my, const float * mw, float rx, float ry, float rw,
+            float maxX, float maxY, size_t width, int32_t * sx, int32_t * sy)
+        {
+            for (size_t x = 0; x < width; ++x)
+            {
+                sx[x] = WarpFixed(mx[x] + rx, maxX);
+                sy[x] = WarpFixed(my[x] + ry, maxY);
+            }
+        }
+
+        void WarpCoordsPerspective(const float * mx, const float * my, const float * mw, float rx, float ry, float rw,
+            float maxX, float maxY, size_t width, int32_t * sx, int32_t * sy)
+        {
+            for (size_t x = 0; x < width; ++x)
+            {
+                float w = mw[x] + rw;
+                sx[x] = WarpFixed((mx[x] + rx) / w, maxX);
+                sy[x] = WarpFixed((my[x] + ry) / w, maxY);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        template<class T, size_t N> void WarpKernelNearest(const WarpParam & p, const uint8_t * src, size_t srcStride, const int32_t * sx, const int32_t * sy, uint8_t * dst)
+        {
+            for (size_t x = 0; x < p.dstW; ++x)
+                WarpNearestPixel<T, N>(p, (const T*)src, srcStride / sizeof(T), sx[x], sy[x], (T*)dst + x * N);
+        }
+
+        template<class T, size_t N> void WarpKernelBilinear(const WarpParam & p, const uint8_t * src, size_t srcStride, const int32_t * sx, const int32_t * sy, uint8_t * dst)
+        {
+            for (size_t x = 0; x < p.dstW; ++x)
+                WarpBilinearPixel<T, N>(p, (const T*)src, srcStride / sizeof(T), sx[x], sy[x], (T*)dst + x * N);
+        }
+
+        template<class T> WarpKernelPtr GetWarpKernel(const WarpParam & p)
+        {
+            if (p.interp == SimdWarpInterpNearest)
+            {
+                switch (p.channels)
+                {
+                case 1: return WarpKernelNearest<T, 1>;
+                case 2: return WarpKernelNearest<T, 2>;
+                case 3: return WarpKernelNearest<T, 3>;
+                case 4: return WarpKernelNearest<T, 4>;
+                }
+            }
+            else
+            {
+                switch (p.channels)
+                {
+                case 1: return WarpKernelBilinear<T, 1>;
+                case 2: return WarpKernelBilinear<T, 2>;
+                case 3: return WarpKernelBilinear<T, 3>;
+                case 4: return WarpKernelBilinear<T, 4>;
+                }
+            }
+            return NULL;
+        }
+
+        WarpKernelPtr GetWarpKernel(const WarpParam & p)
+        {
+            return p.type == SimdResizeChannelFloat ? GetWarpKernel<float>(p) : GetWarpKernel<uint8_t>(p);
+        }
+
+        //---------------------------------------------------------------------
+
+        WarperCommon::WarperCommon(const WarpParam & param)
+            : Warper(param)
+        {
+            const double * m = _param.mat;
+            _mx.Resize(_param.dstW);
+            _my.Resize(_param.dstW);
+            _mw.Resize(_param.dstW);
+            for (size_t x = 0; x < _param.dstW; ++x)
+            {
+                _mx[x] = float(m[0] * x);
+                _my[x] = float(m[3] * x);
+                _mw[x] = float(m[6] * x);
+            }
+            _coords = _param.transform == SimdWarpTransformPerspective ? WarpCoordsPerspective : WarpCoordsAffine;
+            _kernel = GetWarpKernel(_param);
+        }
+
+        void WarperCommon::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            const WarpParam & p = _param;
+            const double * m = p.mat;
+            float maxX = float(p.srcW + 1), maxY = float(p.srcH + 1);
+            size_t threadNumber = Simd::Min(GetThreadNumber(), DivHi(p.dstH, WARP_BAND_MIN));
+            Simd::Parallel(0, p.dstH, [&](size_t thread, size_t begin, size_t end)
+            {
+                end = Simd::Min(end, p.dstH);
+                Array32i sx(p.dstW), sy(p.dstW);
+                for (size_t y = begin; y < end; ++y)
+                {
+                    float rx = float(m[1] * y + m[2]), ry = float(m[4] * y + m[5]), rw = float(m[7] * y + m[8]);
+                    _coords(_mx.data, _my.data, _mw.data, rx, ry, rw, maxX, maxY, p.dstW, sx.data, sy.data);
+                    _kernel(p, src, srcStride, sx.data, sy.data, dst + y * dstStride);
+                }
+            }, threadNumber, WARP_BAND_MIN);
+        }
+
+        //---------------------------------------------------------------------
+
+        void RemapConvertMap(const float * mapX, size_t mapXStride, const float * mapY, size_t mapYStride, size_t width, size_t height,
+            size_t srcWidth, size_t srcHeight, int16_t * map, size_t mapStride)
+        {
+            assert(srcWidth < INT16_MAX && srcHeight < INT16_MAX);
+            float maxX = float(srcWidth + 1), maxY = float(srcHeight + 1);
+            Array32i sx(width), sy(width);
+            for (size_t y = 0; y < height; ++y)
+            {
+                WarpCoordsAffine(mapX, mapY, NULL, 0.0f, 0.0f, 0.0f, maxX, maxY, width, sx.data, sy.data);
+                RemapPackMap(sx.data, sy.data, width, (int16_t*)((uint8_t*)map + y * mapStride));
+                mapX = (const float*)((const uint8_t*)mapX + mapXStride);
+                mapY = (const float*)((const uint8_t*)mapY + mapYStride);
+            }
+        }
+
+        void Remap(const WarpParam & p, const uint8_t * src, size_t srcStride, const int16_t * map, size_t mapStride,
+            uint8_t * dst, size_t dstStride, WarpKernelPtr kernel)
+        {
+            size_t threadNumber = Simd::Min(GetThreadNumber(), DivHi(p.dstH, WARP_BAND_MIN));
+            Simd::Parallel(0, p.dstH, [&](size_t thread, size_t begin, size_t end)
+            {
+                end = Simd::Min(end, p.dstH);
+                Array32i sx(p.dstW), sy(p.dstW);
+                for (size_t y = begin; y < end; ++y)
+                {
+                    RemapUnpackMap((const int16_t*)((const uint8_t*)map + y * mapStride), p.dstW, sx.data, sy.data);
+                    kernel(p, src, srcStride, sx.data, sy.data, dst + y * dstStride);
+                }
+            }, threadNumber, WARP_BAND_MIN);
+        }
+
+        void RemapBilinear(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t channelCount, const int16_t * map, size_t mapStride,
+            size_t width, size_t height, SimdWarpBorderType border, const uint8_t * value, uint8_t * dst, size_t dstStride)
+        {
+            WarpParam param(srcWidth, srcHeight, width, height, channelCount, SimdResizeChannelByte, SimdWarpInterpBilinear, border, value);
+            assert(param.Valid());
+            Remap(param, src, srcStride, map, mapStride, dst, dstStride, GetWarpKernel(param));
+        }
+
+        SIMD_INLINE void RemapChroma(const int32_t * x0, const int32_t * y0, const int32_t * x1, const int32_t * y1, size_t width, int32_t * sx, int32_t * sy)
+        {
+            for (size_t c = 0, l = 0; l < width; c += 1, l += 2)
+            {
+                sx[c] = (((x0[l] + x0[l + 1] + x1[l] + x1[l + 1]) >> 2) - WARP_HALF) >> 1;
+                sy[c] = (((y0[l] + y0[l + 1] + y1[l] + y1[l + 1]) >> 2) - WARP_HALF) >> 1;
+            }
+        }
+
+        void RemapYuv420p(const uint8_t * srcY, size_t srcYStride, const uint8_t * srcU, size_t srcUStride, const uint8_t * srcV, size_t srcVStride,
+            size_t srcWidth, size_t srcHeight, const int16_t * map, size_t mapStride, size_t width, size_t height, SimdWarpBorderType border, const uint8_t * value,
+            uint8_t * dstY, size_t dstYStride, uint8_t * dstU, size_t dstUStride, uint8_t * dstV, size_t dstVStride, WarpKernelPtr kernelY, WarpKernelPtr kernelUV)
+        {
+            uint8_t yuv[3] = { 0, 0, 0 };
+            if (value)
+                yuv[0] = value[0], yuv[1] = value[1], yuv[2] = value[2];
+            WarpParam paramY(srcWidth, srcHeight, width, height, 1, SimdResizeChannelByte, SimdWarpInterpBilinear, border, yuv + 0);
+            Remap(paramY, srcY, srcYStride, map, mapStride, dstY, dstYStride, kernelY);
+
+            WarpParam paramU(srcWidth / 2, srcHeight / 2, width / 2, height / 2, 1, SimdResizeChannelByte, SimdWarpInterpBilinear, border, yuv + 1);
+            WarpParam paramV(srcWidth / 2, srcHeight / 2, width / 2, height / 2, 1, SimdResizeChannelByte, SimdWarpInterpBilinear, border, yuv + 2);
+            size_t threadNumber = Simd::Min(GetThreadNumber(), DivHi(paramU.dstH, WARP_BAND_MIN));
+            Simd::Parallel(0, paramU.dstH, [&](size_t thread, size_t begin, size_t end)
+            {
+                end = Simd::Min(end, paramU.dstH);
+                Array32i sx(paramU.dstW), sy(paramU.dstW), x0(width), y0(width), x1(width), y1(width);
+                for (size_t y = begin; y < end; ++y)
+                {
+                    RemapUnpackMap((const int16_t*)((const uint8_t*)map + (2 * y + 0) * mapStride), width, x0.data, y0.data);
+                    RemapUnpackMap((const int16_t*)((const uint8_t*)map + (2 * y + 1) * mapStride), width, x1.data, y1.data);
+                    RemapChroma(x0.data, y0.data, x1.data, y1.data, width, sx.data, sy.data);
+                    kernelUV(paramU, srcU, srcUStride, sx.data, sy.data, dstU + y * dstUStride);
+                    kernelUV(paramV, srcV, srcVStride, sx.data, sy.data, dstV + y * dstVStride);
+                }
+            }, threadNumber, WARP_BAND_MIN);
+        }
+
+        void RemapBilinearYuv420p(const uint8_t * srcY, size_t srcYStride, const uint8_t * srcU, size_t srcUStride, const uint8_t * srcV, size_t srcVStride,
+            size_t srcWidth, size_t srcHeight, const int16_t * map, size_t mapStride, size_t width, size_t height, SimdWarpBorderType border, const uint8_t * value,
+            uint8_t * dstY, size_t dstYStride, uint8_t * dstU, size_t dstUStride, uint8_t * dstV, size_t dstVStride)
+        {
+            assert((srcWidth % 2 == 0) && (srcHeight % 2 == 0) && (width % 2 == 0) && (height % 2 == 0) && srcWidth && srcHeight && width && height);
+            WarpKernelPtr kernel = GetWarpKernel(WarpParam(srcWidth, srcHeight, width, height, 1, SimdResizeChannelByte, SimdWarpInterpBilinear, border, value));
+            RemapYuv420p(srcY, srcYStride, srcU, srcUStride, srcV, srcVStride, srcWidth, srcHeight, map, mapStride, width, height, border, value,
+                dstY, dstYStride, dstU, dstUStride, dstV, dstVStride, kernel, kernel);
+        }
+
+        //---------------------------------------------------------------------
+
+        void * WarpInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type,
+            const float * mat, SimdWarpTransformType transform, SimdWarpInterpType interp, SimdWarpBorderType border, const uint8_t * value)
+        {
+            WarpParam param(srcW, srcH, dstW, dstH, channels, type, mat, transform, interp, border, value);
+            if (!param.Valid())
+                return NULL;
+            return new WarperCommon(param);
+        }
+    }
+}
@@ -0,0 +1,71 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdBoxFilter_h__
+#define __SimdBoxFilter_h__
+
+#include "Simd/SimdMath.h"
+#include "Simd/SimdArray.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        SIMD_INLINE size_t BoxRow(ptrdiff_t row, size_t height)
+        {
+            return (size_t)Simd::RestrictRange<ptrdiff_t>(row, 0, (ptrdiff_t)height - 1);
+        }
+
+        template<class T> SIMD_INLINE void BoxSetBorder(T * cols, size_t width, size_t channelCount, size_t radius)
+        {
+            const T * first = cols, * last = cols + (width - 1)*channelCount;
+            for (size_t r = 1; r <= radius; ++r)
+            {
+                T * left = cols - r*channelCount, * right = cols + (width - 1 + r)*channelCount;
+                for (size_t c = 0; c < channelCount; ++c)
+                {
+                    left[c] = first[c];
+                    right[c] = last[c];
+                }
+            }
+        }
+
+        template<class T> struct BoxBuffer
+        {
+            BoxBuffer(size_t width, size_t channelCount, size_t radiusX)
+                : size(width*channelCount)
+                , border(radiusX*channelCount)
+                , kernel((2*radiusX + 1)*channelCount)
+                , cols(size + 2*border)
+                , sums(size + 2*border + channelCount, true)
+                , dst(size)
+            {
+            }
+
+            size_t size, border, kernel;
+            Array<T> cols, sums, dst;
+        };
+    }
+}
+
+#endif//__SimdBoxFilter_h__
@@ -0,0 +1,57 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdCanny_h__
+#define __SimdCanny_h__
+
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        const size_t CANNY_CHUNK = 32;
+
+        const int CANNY_TAN_NUM = 12;
+        const int CANNY_TAN_DEN = 29; // 12/29 ~ tan(22.5)
+
+        const uint8_t CANNY_NONE = 0;
+        const uint8_t CANNY_WEAK = 1;
+        const uint8_t CANNY_STRONG = 2;
+
+        typedef void(*CannySobelPtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+        typedef void(*CannyMagnitudePtr)(const int16_t * dx, const int16_t * dy, size_t width, int16_t * mag);
+        typedef void(*CannyNmsPtr)(const int16_t * dx, const int16_t * dy, const int16_t * mag0, const int16_t * mag1, const int16_t * mag2,
+            size_t width, int16_t lowThreshold, int16_t highThreshold, uint8_t * map);
+
+        void CannyMagnitude(const int16_t * dx, const int16_t * dy, size_t width, int16_t * mag);
+
+        void CannyNms(const int16_t * dx, const int16_t * dy, const int16_t * mag0, const int16_t * mag1, const int16_t * mag2,
+            size_t width, int16_t lowThreshold, int16_t highThreshold, uint8_t * map);
+
+        void Canny(const uint8_t * src, size_t srcStride, size_t width, size_t height, int16_t lowThreshold, int16_t highThreshold, 
+            uint8_t * dst, size_t dstStride, CannySobelPtr sobelDx, CannySobelPtr sobelDy, CannyMagnitudePtr magnitude, CannyNmsPtr nms);
+    }
+}
+
+#endif//__SimdCanny_h__
@@ -27,6 +27,7 @@
 #include "Simd/SimdConst.h"
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdEnable.h"
+#include "Simd/SimdMappedFile.h"
 
 #include "Simd/SimdView.hpp"
 
@@ -42,6 +43,25 @@ namespace Simd
 
         struct Data : public Deletable
         {
+            template<class T> class Array
+            {
+            public:
+                Array() : _external(NULL), _size(0) {}
+
+                void reserve(size_t size) { _vector.reserve(size); }
+                void push_back(const T & value) { _vector.push_back(value); }
+                void Assign(const T * data, size_t size) { _vector.clear(); _external = data; _size = size; }
+
+                size_t size() const { return _external ? _size : _vector.size(); }
+                const T * data() const { return _external ? _external : _vector.data(); }
+                const T & operator[](size_t index) const { return data()[index]; }
+
+            private:
+                std::vector<T> _vector;
+                const T * _external;
+                size_t _size;
+            };
+
             struct DTreeNode
             {
                 int featureIdx;
@@ -96,14 +116,16 @@ namespace Simd
             int ncategories;
             Size origWinSize;
 
-            std::vector<Stage> stages;
-            std::vector<DTree> classifiers;
-            std::vector<DTreeNode> nodes;
-            std::vector<float> leaves;
-            std::vector<int> subsets;
+            Array<Stage> stages;
+            Array<DTree> classifiers;
+            Array<DTreeNode> nodes;
+            Array<float> leaves;
+            Array<int> subsets;
+
+            Array<HaarFeature> haarFeatures;
+            Array<LbpFeature> lbpFeatures;
 
-            std::vector<HaarFeature> haarFeatures;
-            std::vector<LbpFeature> lbpFeatures;
+            MappedFile file; // Keeps the binary cascade which is referenced by arrays above.
 
             virtual ~Data() {}
         };
@@ -31,6 +31,10 @@
 #include <vector>
 #include <map>
 #include <memory>
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+#include <cmath>
 
 #include <limits.h>
 
@@ -151,6 +155,7 @@ namespace Simd
         typedef std::vector<Size> Sizes; /*!< A vector of image sizes type definition. */
         typedef Simd::Rectangle<ptrdiff_t> Rect; /*!< A rectangle type definition. */
         typedef std::vector<Rect> Rects; /*!< A vector of rectangles type definition. */
+        typedef std::vector<View> Views; /*!< A vector of images type definition. */
         typedef int Tag; /*!< A tag type definition. */
 
         static const Tag UNDEFINED_OBJECT_TAG = -1; /*!< The undefined object tag. */
@@ -198,6 +203,9 @@ namespace Simd
             Creates a new empty Detection structure.
         */
         Detection()
+            : _slices(0)
+            , _frame(0)
+            , _margin(0.5)
         {
         }
 
@@ -241,6 +249,8 @@ namespace Simd
 
         /*!
             Loads from file classifier cascade. Supports OpenCV HAAR and LBP cascades type.
+            Also it supports binary cascades saved with using of method Detection::Save.
+            Binary cascades are mapped into memory, so several Detection structures share one read-only copy of them.
             You can call this function more than once if you want to use several object detectors at the same time.
 
             \note Tree based cascades and old cascade formats are not supported!
@@ -263,6 +273,19 @@ namespace Simd
             return handle != NULL;
         }
 
+        /*!
+            Saves loaded classifier cascade to file in compact binary format.
+            The saved cascade can be loaded with using of method Detection::Load much faster than original XML cascade.
+
+            \param [in] path - a path to output file.
+            \param [in] index - an index of loaded cascade (in order of loading).
+            \return a result of this operation.
+        */
+        bool Save(const std::string & path, size_t index = 0) const
+        {
+            return index < _data.size() && ::SimdDetectionSave(_data[index].handle, path.c_str()) == SimdTrue;
+        }
+
         /*!
             Prepares Detection structure to work with image of given size.
 
@@ -284,9 +307,34 @@ namespace Simd
             _imageSize = imageSize;
             ptrdiff_t threadNumberMax = std::thread::hardware_concurrency();
             _threadNumber = (threadNumber <= 0 || threadNumber > threadNumberMax) ? threadNumberMax : threadNumber;
+            _frame = 0;
+            _previous.clear();
+            _slots.clear();
+            _bases.clear();
             return InitLevels(scaleFactor, sizeMin, sizeMax, roi);
         }
 
+        /*!
+            Enables or disables incremental detection mode. It is useful for video from static camera, where most objects persist between frames.
+            In this mode elementary detections are kept between frames, and method Detection::Detect rescans only changed regions:
+            motion regions, neighborhoods of objects detected at previous frame and one of horizontal slices of the frame.
+            The slices are rescanned in turn, so a new object outside of motion regions is detected in at most slices frames.
+
+            \note The first frame after enabling of this mode is scanned completely.
+
+            \param [in] slices - a number of horizontal slices of the frame. Zero value disables incremental mode (it is default).
+            \param [in] margin - a size of rescanned neighborhood of previous detections (relative to their size).
+        */
+        void SetIncremental(size_t slices, double margin = 0.5)
+        {
+            _slices = slices;
+            _margin = margin;
+            _frame = 0;
+            _previous.clear();
+            for (size_t i = 0; i < _levels.size(); ++i)
+                _levels[i]->valid = false;
+        }
+
         /*!
             Detects objects at given image.
 
@@ -297,6 +345,8 @@ namespace Simd
             \param [in] motionMask - an using of motion detection flag. Useful for dynamical restriction of detection region to addition to ROI.
             \param [in] motionRegions - a set of rectangles (motion regions) to restrict detection region to addition to ROI.
                                         The regions affect to the center of detected object.
+                                        In incremental mode (see Detection::SetIncremental) they do not restrict detection
+                                        but define changed regions which have to be rescanned.
             \return a result of this operation.
         */
         bool Detect(const View & src, Objects & objects, int groupSizeMin = 3, double sizeDifferenceMax = 0.2,
@@ -309,28 +359,49 @@ namespace Simd
 
             FillLevels(src);
 
-            typedef std::map<Tag, Objects> Candidates;
-            Candidates candidates;
-
+            bool incremental = _slices > 0;
+            Rects regions;
+            _tasks.clear();
             for (size_t i = 0; i < _levels.size(); ++i)
             {
                 Level & level = *_levels[i];
-                View mask = level.roi;
-                Rect rect = level.rect;
-                if (motionMask)
+                level.active = level.rect;
+                level.current = &level.roi;
+                if (motionMask && !incremental)
                 {
-                    FillMotionMask(motionRegions, level, rect);
-                    mask = level.mask;
+                    FillMotionMask(motionRegions, level, level.active);
+                    level.current = &level.mask;
                 }
-                if (rect.Empty())
+                if (level.active.Empty())
                     continue;
+                if (incremental && level.valid)
+                    GetChangedRegions(level, motionMask ? motionRegions : Rects(), regions);
                 for (size_t j = 0; j < level.hids.size(); ++j)
                 {
                     Hid & hid = level.hids[j];
+                    ::SimdDetectionPrepare(hid.handle);
+                    if (incremental && level.valid)
+                        AddTasks(level, hid, regions);
+                    else
+                        AddTask(level, hid, hid.Scanned(level.active));
+                }
+                level.valid = incremental;
+            }
+
+            SplitTasks();
+            RunTasks();
 
-                    hid.Detect(mask, rect, level.dst, _threadNumber, level.throughColumn);
+            Candidates candidates;
 
-                    AddObjects(candidates[hid.data->tag], level.dst, rect, hid.data->size, level.scale,
+            for (size_t i = 0; i < _levels.size(); ++i)
+            {
+                Level & level = *_levels[i];
+                if (level.active.Empty())
+                    continue;
+                for (size_t j = 0; j < level.hids.size(); ++j)
+                {
+                    Hid & hid = level.hids[j];
+                    AddObjects(candidates[hid.data->tag], hid.dst, level.active, hid.data->size, level.scale,
                         level.throughColumn ? 2 : 1, hid.data->tag);
                 }
             }
@@ -339,12 +410,114 @@ namespace Simd
             for (typename Candidates::iterator it = candidates.begin(); it != candidates.end(); ++it)
                 GroupObjects(objects, it->second, groupSizeMin, sizeDifferenceMax);
 
+            if (incremental)
+            {
+                _previous.clear();
+                for (size_t i = 0; i < objects.size(); ++i)
+                    _previous.push_back(objects[i].rect);
+                _frame++;
+            }
+
+            return true;
+        }
+
+        /*!
+            Detects objects at a batch of images from different video streams.
+            All images share loaded cascades and work threads: the work for every pair of image and scale level is scheduled on one pool of threads.
+            Every thread uses its own integral images and buffers, so the memory consumption does not depend on the number of streams.
+
+            \note All images must have the size which was given in Detection::Init. Motion regions and incremental mode are not used here.
+
+            \param [in] src - input images (an image per stream).
+            \param [out] objects - detected objects for every input image.
+            \param [in] groupSizeMin - a minimal weight (number of elementary detections) of detected image.
+            \param [in] sizeDifferenceMax - a parameter to group elementary detections.
+            \return a result of this operation.
+        */
+        bool Detect(const Views & src, std::vector<Objects> & objects, int groupSizeMin = 3, double sizeDifferenceMax = 0.2)
+        {
+            SIMD_CHECK_PERFORMANCE();
+
+            if (_levels.empty())
+                return false;
+            for (size_t i = 0; i < src.size(); ++i)
+                if (src[i].Size() != _imageSize)
+                    return false;
+
+            size_t threadNumber = _threadNumber;
+            if (!InitSlots(threadNumber))
+                return false;
+
+            if (_bases.size() < src.size())
+                _bases.resize(src.size());
+            for (size_t i = 0; i < src.size(); ++i)
+                if (!_bases[i])
+                    _bases[i].reset(new View(_levels[0]->src.Size(), View::Gray8));
+
+            std::atomic<size_t> next(0);
+            Parallel(0, threadNumber, [&](size_t thread, size_t begin, size_t end)
+            {
+                View gray;
+                for (size_t i = next++; i < src.size(); i = next++)
+                    FillBase(src[i], *_bases[i], gray);
+            }, threadNumber);
+
+            struct Unit
+            {
+                size_t stream, level;
+                double cost;
+                Candidates candidates;
+            };
+            std::vector<Unit> units(src.size() * _levels.size());
+            std::vector<size_t> order(units.size());
+            for (size_t i = 0; i < units.size(); ++i)
+            {
+                Unit & unit = units[i];
+                unit.stream = i / _levels.size();
+                unit.level = i % _levels.size();
+                const Level & level = *_levels[unit.level];
+                unit.cost = double(level.rect.Area()) * double(level.hids.size()) / (level.throughColumn ? 4.0 : 1.0);
+                order[i] = i;
+            }
+            std::sort(order.begin(), order.end(), [&units](size_t a, size_t b) { return units[a].cost > units[b].cost; });
+
+            next = 0;
+            Parallel(0, threadNumber, [&](size_t thread, size_t begin, size_t end)
+            {
+                LevelPtrs & levels = Slot(thread);
+                for (size_t i = next++; i < order.size(); i = next++)
+                {
+                    Unit & unit = units[order[i]];
+                    DetectLevel(*_bases[unit.stream], *levels[unit.level], unit.candidates);
+                }
+            }, threadNumber);
+
+            objects.assign(src.size(), Objects());
+            for (size_t s = 0; s < src.size(); ++s)
+            {
+                Candidates candidates;
+                for (size_t l = 0; l < _levels.size(); ++l)
+                {
+                    const Candidates & unit = units[s * _levels.size() + l].candidates;
+                    for (typename Candidates::const_iterator it = unit.begin(); it != unit.end(); ++it)
+                        candidates[it->first].insert(candidates[it->first].end(), it->second.begin(), it->second.end());
+                }
+                for (typename Candidates::iterator it = candidates.begin(); it != candidates.end(); ++it)
+                    GroupObjects(objects[s], it->second, groupSizeMin, sizeDifferenceMax);
+            }
+
+            for (size_t i = 0; i < _levels.size(); ++i)
+                _levels[i]->valid = false;
+
             return true;
         }
 
     private:
 
         typedef void * Handle;
+        typedef std::map<Tag, Objects> Candidates;
+        typedef std::unique_ptr<View> ViewPtr;
+        typedef std::vector<ViewPtr> ViewPtrs;
 
         struct Data
         {
@@ -370,21 +543,21 @@ namespace Simd
             Handle handle;
             Data * data;
             DetectPtr detect;
+            View dst;
+            double cost; // Measured time of one scanning window (in seconds). It is zero before the first measurement.
 
-            void Detect(const View & mask, const Rect & rect, View & dst, size_t threadNumber, bool throughColumn)
+            Rect Scanned(const Rect & rect) const
             {
-                SIMD_CHECK_PERFORMANCE();
+                return rect.Shifted(-data->size / 2).Intersection(Rect(dst.Size() - data->size));
+            }
 
-                Size s = dst.Size() - data->size;
-                View m = mask.Region(s, View::MiddleCenter);
-                Rect r = rect.Shifted(-data->size / 2).Intersection(Rect(s));
-                Simd::Fill(dst, 0);
-                ::SimdDetectionPrepare(handle);
+            void Detect(const View & mask, const Rect & rect)
+            {
+                SIMD_CHECK_PERFORMANCE();
 
-                Parallel(r.top, r.bottom, [&](size_t thread, size_t begin, size_t end)
-                {
-                    detect(handle, m.data, m.stride, r.left, begin, r.right, end, dst.data, dst.stride);
-                }, rect.Area() >= (data->Haar() ? 10000 : 30000) ? threadNumber : 1, throughColumn ? 2 : 1);
+                View m = mask.Region(dst.Size() - data->size, View::MiddleCenter);
+                Simd::Fill(dst.Region(rect).Ref(), 0);
+                detect(handle, m.data, m.stride, rect.left, rect.top, rect.right, rect.bottom, dst.data, dst.stride);
             }
         };
         typedef std::vector<Hid> Hids;
@@ -399,16 +572,17 @@ namespace Simd
             View mask;
 
             Rect rect;
+            Rect active;
+            const View * current;
 
             View sum;
             View sqsum;
             View tilted;
 
-            View dst;
-
             bool throughColumn;
             bool needSqsum;
             bool needTilted;
+            bool valid; // Detection results of the hids are actual for unchanged regions (incremental mode).
 
             ~Level()
             {
@@ -419,11 +593,26 @@ namespace Simd
         typedef std::unique_ptr<Level> LevelPtr;
         typedef std::vector<LevelPtr> LevelPtrs;
 
+        struct Task
+        {
+            Level * level;
+            Hid * hid;
+            Rect rect;
+            double windows, cost, time;
+        };
+        typedef std::vector<Task> Tasks;
+
         std::vector<Data> _data;
         Size _imageSize;
         bool _needNormalization;
         ptrdiff_t _threadNumber;
         LevelPtrs _levels;
+        Tasks _tasks;
+        size_t _slices, _frame;
+        double _margin;
+        Rects _previous;
+        std::vector<LevelPtrs> _slots;
+        ViewPtrs _bases;
 
         bool InitLevels(double scaleFactor, const Size & sizeMin, const Size & sizeMax, const View & roi)
         {
@@ -454,49 +643,12 @@ namespace Simd
                     _levels.push_back(LevelPtr(new Level()));
                     Level & level = *_levels.back();
 
-                    level.scale = scale;
-                    level.throughColumn = scale <= 2.0;
-                    Size scaledSize(_imageSize / scale);
-
-                    level.src.Recreate(scaledSize, View::Gray8);
-                    level.roi.Recreate(scaledSize, View::Gray8);
-                    level.mask.Recreate(scaledSize, View::Gray8);
-
-                    level.sum.Recreate(scaledSize + Size(1, 1), View::Int32);
-                    level.sqsum.Recreate(scaledSize + Size(1, 1), View::Int32);
-                    level.tilted.Recreate(scaledSize + Size(1, 1), View::Int32);
-
-                    level.dst.Recreate(scaledSize, View::Gray8);
-
-                    level.needSqsum = false, level.needTilted = false;
+                    std::vector<Data*> data;
                     for (size_t i = 0; i < _data.size(); ++i)
-                    {
-                        if (!inserts[i])
-                            continue;
-                        Handle handle = ::SimdDetectionInit(_data[i].handle, level.sum.data, level.sum.stride, level.sum.width, level.sum.height,
-                            level.sqsum.data, level.sqsum.stride, level.tilted.data, level.tilted.stride, level.throughColumn, _data[i].Int16());
-                        if (handle)
-                        {
-                            Hid hid;
-                            hid.handle = handle;
-                            hid.data = &_data[i];
-                            if (_data[i].Haar())
-                                hid.detect = level.throughColumn ? ::SimdDetectionHaarDetect32fi : ::SimdDetectionHaarDetect32fp;
-                            else
-                            {
-                                if (_data[i].Int16())
-                                    hid.detect = level.throughColumn ? ::SimdDetectionLbpDetect16ii : ::SimdDetectionLbpDetect16ip;
-                                else
-                                    hid.detect = level.throughColumn ? ::SimdDetectionLbpDetect32fi : ::SimdDetectionLbpDetect32fp;
-                            }
-                            level.hids.push_back(hid);
-                        }
-                        else
-                            return false;
-                        level.needSqsum = level.needSqsum | _data[i].Haar();
-                        level.needTilted = level.needTilted | _data[i].Tilted();
-                        _needNormalization = _needNormalization | _data[i].Haar();
-                    }
+                        if (inserts[i])
+                            data.push_back(&_data[i]);
+                    if (!InitLevel(level, scale, data))
+                        return false;
 
                     level.rect = Rect(level.roi.Size());
                     if (roi.format == View::None)
@@ -513,9 +665,90 @@ namespace Simd
             return !_levels.empty();
         }
 
-        void FillLevels(View src)
+        bool InitLevel(Level & level, double scale, const std::vector<Data*> & data)
+        {
+            level.scale = scale;
+            level.throughColumn = scale <= 2.0;
+            Size scaledSize(_imageSize / scale);
+
+            level.src.Recreate(scaledSize, View::Gray8);
+            level.roi.Recreate(scaledSize, View::Gray8);
+            level.mask.Recreate(scaledSize, View::Gray8);
+
+            level.sum.Recreate(scaledSize + Size(1, 1), View::Int32);
+            level.sqsum.Recreate(scaledSize + Size(1, 1), View::Int32);
+            level.tilted.Recreate(scaledSize + Size(1, 1), View::Int32);
+
+            level.needSqsum = false, level.needTilted = false, level.valid = false;
+            for (size_t i = 0; i < data.size(); ++i)
+            {
+                Handle handle = ::SimdDetectionInit(data[i]->handle, level.sum.data, level.sum.stride, level.sum.width, level.sum.height,
+                    level.sqsum.data, level.sqsum.stride, level.tilted.data, level.tilted.stride, level.throughColumn, data[i]->Int16());
+                if (handle)
+                {
+                    Hid hid;
+                    hid.handle = handle;
+                    hid.data = data[i];
+                    hid.cost = 0;
+                    if (data[i]->Haar())
+                        hid.detect = level.throughColumn ? ::SimdDetectionHaarDetect32fi : ::SimdDetectionHaarDetect32fp;
+                    else
+                    {
+                        if (data[i]->Int16())
+                            hid.detect = level.throughColumn ? ::SimdDetectionLbpDetect16ii : ::SimdDetectionLbpDetect16ip;
+                        else
+                            hid.detect = level.throughColumn ? ::SimdDetectionLbpDetect32fi : ::SimdDetectionLbpDetect32fp;
+                    }
+                    level.hids.push_back(hid);
+                }
+                else
+                    return false;
+                level.needSqsum = level.needSqsum | data[i]->Haar();
+                level.needTilted = level.needTilted | data[i]->Tilted();
+                _needNormalization = _needNormalization | data[i]->Haar();
+            }
+
+            for (size_t i = 0; i < level.hids.size(); ++i)
+                level.hids[i].dst.Recreate(scaledSize, View::Gray8);
+
+            return true;
+        }
+
+        LevelPtrs & Slot(size_t thread)
+        {
+            return thread ? _slots[thread - 1] : _levels;
+        }
+
+        bool InitSlots(size_t threadNumber)
+        {
+            if (_slots.size() + 1 >= threadNumber)
+                return true;
+            _slots.resize(threadNumber - 1);
+            for (size_t s = 0; s < _slots.size(); ++s)
+            {
+                LevelPtrs & levels = _slots[s];
+                for (size_t l = levels.size(); l < _levels.size(); ++l)
+                {
+                    const Level & original = *_levels[l];
+                    levels.push_back(LevelPtr(new Level()));
+                    Level & level = *levels.back();
+                    std::vector<Data*> data;
+                    for (size_t i = 0; i < original.hids.size(); ++i)
+                        data.push_back(original.hids[i].data);
+                    if (!InitLevel(level, original.scale, data))
+                    {
+                        _slots.resize(s); // Only completely filled slots are kept.
+                        return false;
+                    }
+                    Simd::Copy(original.roi, level.roi);
+                    level.rect = original.rect;
+                }
+            }
+            return true;
+        }
+
+        void FillBase(View src, View & base, View & gray) const
         {
-            View gray;
             if (src.format != View::Gray8)
             {
                 gray.Recreate(src.Size(), View::Gray8);
@@ -523,9 +756,37 @@ namespace Simd
                 src = gray;
             }
 
-            Simd::ResizeBilinear(src, _levels[0]->src);
+            Simd::ResizeBilinear(src, base);
             if (_needNormalization)
-                Simd::NormalizeHistogram(_levels[0]->src, _levels[0]->src);
+                Simd::NormalizeHistogram(base, base);
+        }
+
+        void DetectLevel(const View & base, Level & level, Candidates & candidates)
+        {
+            if (level.rect.Empty())
+                return;
+            if (base.Size() == level.src.Size())
+                Simd::Copy(base, level.src);
+            else
+                Simd::ResizeBilinear(base, level.src);
+            EstimateIntegral(level);
+            for (size_t i = 0; i < level.hids.size(); ++i)
+            {
+                Hid & hid = level.hids[i];
+                ::SimdDetectionPrepare(hid.handle);
+                Rect r = hid.Scanned(level.rect);
+                if (r.Empty())
+                    continue;
+                hid.Detect(level.roi, r);
+                AddObjects(candidates[hid.data->tag], hid.dst, level.rect, hid.data->size, level.scale,
+                    level.throughColumn ? 2 : 1, hid.data->tag);
+            }
+        }
+
+        void FillLevels(View src)
+        {
+            View gray;
+            FillBase(src, _levels[0]->src, gray);
             EstimateIntegral(*_levels[0]);
             for (size_t i = 1; i < _levels.size(); ++i)
             {
@@ -561,6 +822,160 @@ namespace Simd
             Simd::OperationBinary8u(level.mask, level.roi, level.mask, SimdOperationBinary8uAnd);
         }
 
+        void AddTask(Level & level, Hid & hid, const Rect & rect)
+        {
+            if (rect.Empty())
+                return;
+            Task task;
+            task.level = &level;
+            task.hid = &hid;
+            task.rect = rect;
+            _tasks.push_back(task);
+        }
+
+        void GetChangedRegions(const Level & level, const Rects & motionRegions, Rects & regions) const
+        {
+            regions.clear();
+            for (size_t i = 0; i < motionRegions.size(); ++i)
+                regions.push_back(motionRegions[i] / level.scale);
+            for (size_t i = 0; i < _previous.size(); ++i)
+            {
+                Rect r = _previous[i] / level.scale;
+                ptrdiff_t x = ptrdiff_t(r.Width() * _margin), y = ptrdiff_t(r.Height() * _margin);
+                regions.push_back(Rect(r.left - x, r.top - y, r.right + x, r.bottom + y));
+            }
+            ptrdiff_t slice = _frame % _slices, height = level.rect.Height();
+            regions.push_back(Rect(level.rect.left, level.rect.top + height * slice / _slices,
+                level.rect.right, level.rect.top + height * (slice + 1) / _slices));
+        }
+
+        void AddTasks(Level & level, Hid & hid, const Rects & regions)
+        {
+            Rect scanned = hid.Scanned(level.active);
+            ptrdiff_t step = level.throughColumn ? 2 : 1;
+            Rects rects;
+            std::vector<ptrdiff_t> rows;
+            for (size_t i = 0; i < regions.size(); ++i)
+            {
+                Rect r = hid.Scanned(regions[i].Intersection(level.active));
+                if (r.Empty())
+                    continue;
+                r.left = scanned.left + (r.left - scanned.left) / step * step;
+                r.top = scanned.top + (r.top - scanned.top) / step * step;
+                r.bottom = std::min(scanned.top + (r.bottom - scanned.top + step - 1) / step * step, scanned.bottom);
+                rects.push_back(r);
+                rows.push_back(r.top);
+                rows.push_back(r.bottom);
+            }
+            std::sort(rows.begin(), rows.end());
+            rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+
+            size_t first = _tasks.size();
+            for (size_t i = 1; i < rows.size(); ++i)
+            {
+                Rect band(scanned.right, rows[i - 1], scanned.left, rows[i]);
+                for (size_t j = 0; j < rects.size(); ++j)
+                {
+                    if (rects[j].top <= band.top && rects[j].bottom >= band.bottom)
+                    {
+                        band.left = std::min(band.left, rects[j].left);
+                        band.right = std::max(band.right, rects[j].right);
+                    }
+                }
+                if (band.left >= band.right)
+                    continue;
+                if (_tasks.size() > first)
+                {
+                    Rect & last = _tasks.back().rect;
+                    if (last.bottom == band.top && last.left == band.left && last.right == band.right)
+                    {
+                        last.bottom = band.bottom;
+                        continue;
+                    }
+                }
+                AddTask(level, hid, band);
+            }
+        }
+
+        void SplitTasks()
+        {
+            double average = 0, measured = 0, total = 0;
+            for (size_t i = 0; i < _tasks.size(); ++i)
+            {
+                Task & task = _tasks[i];
+                ptrdiff_t step = task.level->throughColumn ? 2 : 1;
+                task.windows = double((task.rect.Width() + step - 1) / step) * double((task.rect.Height() + step - 1) / step);
+                if (task.hid->cost > 0)
+                    average += task.hid->cost, measured += 1;
+            }
+            average = measured > 0 ? average / measured : 1.0;
+            for (size_t i = 0; i < _tasks.size(); ++i)
+            {
+                Task & task = _tasks[i];
+                task.cost = task.windows * (task.hid->cost > 0 ? task.hid->cost : average);
+                total += task.cost;
+            }
+
+            if (_threadNumber > 1 && total > 0)
+            {
+                const double target = total / double(_threadNumber * 4);
+                Tasks tasks;
+                for (size_t i = 0; i < _tasks.size(); ++i)
+                {
+                    const Task & task = _tasks[i];
+                    ptrdiff_t step = task.level->throughColumn ? 2 : 1;
+                    ptrdiff_t rows = (task.rect.Height() + step - 1) / step;
+                    ptrdiff_t parts = std::max<ptrdiff_t>(std::min<ptrdiff_t>(ptrdiff_t(task.cost / target + 0.5), rows), 1);
+                    ptrdiff_t size = (rows + parts - 1) / parts * step;
+                    for (ptrdiff_t top = task.rect.top; top < task.rect.bottom; top += size)
+                    {
+                        Task part = task;
+                        part.rect.top = top;
+                        part.rect.bottom = std::min(top + size, task.rect.bottom);
+                        double share = double(part.rect.Height()) / double(task.rect.Height());
+                        part.windows = task.windows * share;
+                        part.cost = task.cost * share;
+                        tasks.push_back(part);
+                    }
+                }
+                _tasks.swap(tasks);
+            }
+
+            std::sort(_tasks.begin(), _tasks.end(), [](const Task & a, const Task & b) { return a.cost > b.cost; });
+        }
+
+        void RunTasks()
+        {
+            std::atomic<size_t> next(0);
+            size_t threadNumber = std::min<size_t>(_threadNumber, _tasks.size());
+            Parallel(0, threadNumber, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t i = next++; i < _tasks.size(); i = next++)
+                {
+                    Task & task = _tasks[i];
+                    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                    task.hid->Detect(*task.level->current, task.rect);
+                    task.time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                }
+            }, threadNumber);
+
+            typedef std::map<Hid*, std::pair<double, double>> Measurements;
+            Measurements measurements;
+            for (size_t i = 0; i < _tasks.size(); ++i)
+            {
+                std::pair<double, double> & measurement = measurements[_tasks[i].hid];
+                measurement.first += _tasks[i].time;
+                measurement.second += _tasks[i].windows;
+            }
+            for (typename Measurements::iterator it = measurements.begin(); it != measurements.end(); ++it)
+            {
+                if (it->second.second <= 0)
+                    continue;
+                double cost = it->second.first / it->second.second;
+                it->first->cost = it->first->cost > 0 ? 0.75 * it->first->cost + 0.25 * cost : cost;
+            }
+        }
+
         void AddObjects(Objects & objects, const View & dst, const Rect & rect, const Size & size, double scale, size_t step, Tag tag)
         {
             Size s = dst.Size() - size;
@@ -592,10 +1007,34 @@ namespace Simd
                     std::abs(r1.right - r2.right) <= delta && std::abs(r1.bottom - r2.bottom) <= delta;
             }
 
+            SIMD_INLINE double Delta(const Object & o) const
+            {
+                return _sizeDifferenceMax * (o.rect.Width() + o.rect.Height()) * 0.5;
+            }
+
         private:
             double _sizeDifferenceMax;
         };
 
+        struct Cell
+        {
+            ptrdiff_t level, y, x;
+            int index;
+
+            SIMD_INLINE bool operator < (const Cell & c) const
+            {
+                return level < c.level || (level == c.level && (y < c.y || (y == c.y && (x < c.x || (x == c.x && index < c.index)))));
+            }
+        };
+        typedef std::vector<Cell> Cells;
+
+        SIMD_INLINE int CellLevel(double delta)
+        {
+            int level;
+            std::frexp(std::max(delta, 1.0), &level);
+            return level;
+        }
+
         template<typename T> int Partition(const std::vector<T> & vec, std::vector<int> & labels, double sizeDifferenceMax)
         {
             Similar similar(sizeDifferenceMax);
@@ -603,6 +1042,26 @@ namespace Simd
             const int PARENT = 0;
             const int RANK = 1;
 
+            // Similar objects differ in every edge by at most Delta() of the smaller one.
+            // Objects are bucketed by size class: an object with Delta() in [2^(L-1), 2^L)
+            // goes to the grid of level L with step 2^L. So partners of any object lie
+            // in the neighboring 3x3 cells of the grid of their own level.
+            Cells cells(N);
+            std::vector<int> levels(N);
+            for (i = 0; i < N; i++)
+            {
+                int level = CellLevel(similar.Delta(vec[i]));
+                double step = std::ldexp(1.0, level);
+                cells[i].level = level;
+                cells[i].y = (ptrdiff_t)std::floor(vec[i].rect.top / step);
+                cells[i].x = (ptrdiff_t)std::floor(vec[i].rect.left / step);
+                cells[i].index = i;
+                levels[i] = level;
+            }
+            std::sort(cells.begin(), cells.end());
+            std::sort(levels.begin(), levels.end());
+            levels.erase(std::unique(levels.begin(), levels.end()), levels.end());
+
             std::vector<int> _nodes(N * 2);
             int(*nodes)[2] = (int(*)[2])&_nodes[0];
 
@@ -618,40 +1077,52 @@ namespace Simd
                 while (nodes[root][PARENT] >= 0)
                     root = nodes[root][PARENT];
 
-                for (j = 0; j < N; j++)
+                for (size_t l = 0; l < levels.size(); l++)
                 {
-                    if (i == j || !similar(vec[i], vec[j]))
-                        continue;
-                    int root2 = j;
-
-                    while (nodes[root2][PARENT] >= 0)
-                        root2 = nodes[root2][PARENT];
-
-                    if (root2 != root)
+                    double step = std::ldexp(1.0, levels[l]);
+                    ptrdiff_t y = (ptrdiff_t)std::floor(vec[i].rect.top / step);
+                    ptrdiff_t x = (ptrdiff_t)std::floor(vec[i].rect.left / step);
+                    for (ptrdiff_t dy = -1; dy <= 1; dy++)
                     {
-                        int rank = nodes[root][RANK], rank2 = nodes[root2][RANK];
-                        if (rank > rank2)
-                            nodes[root2][PARENT] = root;
-                        else
+                        Cell lo = { levels[l], y + dy, x - 1, 0 }, hi = { levels[l], y + dy, x + 2, 0 };
+                        typename Cells::const_iterator end = std::lower_bound(cells.begin(), cells.end(), hi);
+                        for (typename Cells::const_iterator it = std::lower_bound(cells.begin(), cells.end(), lo); it != end; ++it)
                         {
-                            nodes[root][PARENT] = root2;
-                            nodes[root2][RANK] += rank == rank2;
-                            root = root2;
-                        }
-                        assert(nodes[root][PARENT] < 0);
+                            j = it->index;
+                            if (j <= i || !similar(vec[i], vec[j]))
+                                continue;
+                            int root2 = j;
 
-                        int k = j, parent;
-                        while ((parent = nodes[k][PARENT]) >= 0)
-                        {
-                            nodes[k][PARENT] = root;
-                            k = parent;
-                        }
+                            while (nodes[root2][PARENT] >= 0)
+                                root2 = nodes[root2][PARENT];
 
-                        k = i;
-                        while ((parent = nodes[k][PARENT]) >= 0)
-                        {
-                            nodes[k][PARENT] = root;
-                            k = parent;
+                            if (root2 != root)
+                            {
+                                int rank = nodes[root][RANK], rank2 = nodes[root2][RANK];
+                                if (rank > rank2)
+                                    nodes[root2][PARENT] = root;
+                                else
+                                {
+                                    nodes[root][PARENT] = root2;
+                                    nodes[root2][RANK] += rank == rank2;
+                                    root = root2;
+                                }
+                                assert(nodes[root][PARENT] < 0);
+
+                                int k = j, parent;
+                                while ((parent = nodes[k][PARENT]) >= 0)
+                                {
+                                    nodes[k][PARENT] = root;
+                                    k = parent;
+                                }
+
+                                k = i;
+                                while ((parent = nodes[k][PARENT]) >= 0)
+                                {
+                                    nodes[k][PARENT] = root;
+                                    k = parent;
+                                }
+                            }
                         }
                     }
                 }
@@ -0,0 +1,52 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdDistance_h__
+#define __SimdDistance_h__
+
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        const int32_t DISTANCE_INF = 1 << 28;
+        const size_t DISTANCE_STRIP = 64;
+        const size_t DISTANCE_BAND_MIN = 16;
+
+        typedef void(*DistanceColDownPtr)(const uint8_t * mask, uint8_t index, const int32_t * prev, int32_t * curr, size_t width);
+        typedef void(*DistanceColUpPtr)(const int32_t * next, int32_t * curr, size_t width);
+        typedef void(*DistanceChamferVertPtr)(const int32_t * row1, const int32_t * row2, int32_t * curr, size_t width, int32_t a, int32_t b, int32_t c);
+
+        void DistanceColDown(const uint8_t * mask, uint8_t index, const int32_t * prev, int32_t * curr, size_t width);
+
+        void DistanceColUp(const int32_t * next, int32_t * curr, size_t width);
+
+        void DistanceChamferVert(const int32_t * row1, const int32_t * row2, int32_t * curr, size_t width, int32_t a, int32_t b, int32_t c);
+
+        void DistanceTransformRun(const uint8_t * mask, size_t maskStride, size_t width, size_t height, uint8_t index, SimdDistanceType type,
+            uint8_t * dst, size_t dstStride, SimdPixelFormatType dstFormat, DistanceColDownPtr colDown, DistanceColUpPtr colUp, DistanceChamferVertPtr chamferVert);
+    }
+}
+
+#endif//__SimdDistance_h__
@@ -343,6 +343,40 @@ namespace Simd
     */
     template <template<class> class A> void Convert(const Frame<A> & src, Frame<A> & dst);
 
+
+    /*! @ingroup cpp_frame_functions
+
+        \fn template <template<class> class A> void RemapBilinear(const Frame<A> & src, const View<A> & map, Frame<A> & dst, ::SimdWarpBorderType border = ::SimdWarpBorderConstant, const uint8_t * value = NULL);
+
+        \short Performs remapping of frame with using bilinear interpolation and precomputed fixed-point map.
+
+        The frames must have the same format (Gray8, Bgr24, Bgra32, Rgb24 or Yuv420p). The map must be created by function Simd::RemapConvertMap.
+
+        \param [in] src - an input frame.
+        \param [in] map - a fixed-point map (it is created for the first plane of the frame).
+        \param [out] dst - an output frame.
+        \param [in] border - a type of border processing. By default it is equal to ::SimdWarpBorderConstant.
+        \param [in] value - a pointer to border pixel value (Y, U and V values for Yuv420p format). By default it is NULL (zero value).
+    */
+    template <template<class> class A> void RemapBilinear(const Frame<A> & src, const View<A> & map, Frame<A> & dst, 
+        ::SimdWarpBorderType border = ::SimdWarpBorderConstant, const uint8_t * value = NULL);
+
+    /*! @ingroup cpp_frame_functions
+
+        \fn template <template<class> class A> void TransformImage(const Frame<A> & src, ::SimdTransformType transform, Frame<A> & dst);
+
+        \short Performs transformation (rotation and/or transposition) of all planes of the frame.
+
+        The frames must have the same format. Chroma planes of Nv12 and Yuv420p formats are transformed with their own (half) size,
+        so the output frame size must be equal to Simd::TransformSize(src.Size(), transform).
+
+        \note This function is a C++ wrapper for function ::SimdTransformImage.
+
+        \param [in] src - an input frame.
+        \param [in] transform - a type of image transformation.
+        \param [out] dst - an output frame.
+    */
+    template <template<class> class A> void TransformImage(const Frame<A> & src, ::SimdTransformType transform, Frame<A> & dst);
     //-------------------------------------------------------------------------
 
     // struct Frame implementation:
@@ -877,6 +911,36 @@ namespace Simd
             assert(0);
         }
     }
+
+    template <template<class> class A> SIMD_INLINE void RemapBilinear(const Frame<A> & src, const View<A> & map, Frame<A> & dst, ::SimdWarpBorderType border, const uint8_t * value)
+    {
+        assert(src.format == dst.format && src.flipped == dst.flipped);
+
+        switch (src.format)
+        {
+        case Frame<A>::Yuv420p:
+            SimdRemapBilinearYuv420p(src.planes[0].data, src.planes[0].stride, src.planes[1].data, src.planes[1].stride, src.planes[2].data, src.planes[2].stride,
+                src.width, src.height, (int16_t*)map.data, map.stride, dst.width, dst.height, border, value, 
+                dst.planes[0].data, dst.planes[0].stride, dst.planes[1].data, dst.planes[1].stride, dst.planes[2].data, dst.planes[2].stride);
+            break;
+        case Frame<A>::Gray8:
+        case Frame<A>::Bgr24:
+        case Frame<A>::Bgra32:
+        case Frame<A>::Rgb24:
+            Simd::RemapBilinear(src.planes[0], map, dst.planes[0], border, value);
+            break;
+        default:
+            assert(0);
+        }
+    }
+
+    template <template<class> class A> SIMD_INLINE void TransformImage(const Frame<A> & src, ::SimdTransformType transform, Frame<A> & dst)
+    {
+        assert(src.format == dst.format && src.flipped == dst.flipped && TransformSize(src.Size(), transform) == dst.Size());
+
+        for (size_t i = 0, n = src.PlaneCount(); i < n; ++i)
+            Simd::TransformImage(src.planes[i], transform, dst.planes[i]);
+    }
 }
 
 #endif//__SimdFrame_hpp__
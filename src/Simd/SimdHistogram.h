@@ -0,0 +1,71 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdHistogram_h__
+#define __SimdHistogram_h__
+
+#include "Simd/SimdMath.h"
+#include "Simd/SimdParallel.hpp"
+
+namespace Simd
+{
+    namespace Base
+    {
+        const size_t HISTOGRAM_AREA_MIN = 64 * 1024;
+
+        size_t HistogramThreadNumber(size_t width, size_t height);
+
+        template<class Func> void HistogramParallel(size_t height, size_t threadNumber, uint32_t * histogram, Func func)
+        {
+            std::vector<uint32_t> histograms(threadNumber * HISTOGRAM_SIZE, 0);
+            Simd::Parallel(0, height, [&](size_t thread, size_t begin, size_t end)
+            {
+                end = Simd::Min(end, height);
+                func(begin, end, histograms.data() + thread * HISTOGRAM_SIZE);
+            }, threadNumber);
+
+            memcpy(histogram, histograms.data(), HISTOGRAM_SIZE * sizeof(uint32_t));
+            for (size_t thread = 1; thread < threadNumber; ++thread)
+            {
+                const uint32_t * h = histograms.data() + thread * HISTOGRAM_SIZE;
+                for (size_t i = 0; i < HISTOGRAM_SIZE; ++i)
+                    histogram[i] += h[i];
+            }
+        }
+
+        const int CLAHE_SHIFT = 8;
+        const int CLAHE_RANGE = 1 << CLAHE_SHIFT;
+        const int CLAHE_ROUND = 1 << (2 * CLAHE_SHIFT - 1);
+
+        typedef void(*ClaheRowPtr)(const uint8_t * src, size_t width, const uint8_t * lut0, const uint8_t * lut1, 
+            const int32_t * ix0, const int32_t * ix1, const int32_t * wx, int32_t wy, uint8_t * dst);
+
+        void ClaheRow(const uint8_t * src, size_t width, const uint8_t * lut0, const uint8_t * lut1,
+            const int32_t * ix0, const int32_t * ix1, const int32_t * wx, int32_t wy, uint8_t * dst);
+
+        void ClaheRun(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t tilesX, size_t tilesY, 
+            float clipLimit, uint8_t * dst, size_t dstStride, ClaheRowPtr claheRow);
+    }
+}
+
+#endif//__SimdHistogram_h__
@@ -0,0 +1,305 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdHog_hpp__
+#define __SimdHog_hpp__
+
+#include "Simd/SimdLib.hpp"
+#include "Simd/SimdParallel.hpp"
+
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <thread>
+#include <algorithm>
+
+#include <limits.h>
+#include <float.h>
+
+namespace Simd
+{
+    /*! @ingroup cpp_hog
+
+        \short HogDetector structure provides multi-scale detection of objects (pedestrians, vehicles etc.) with HOG features and linear SVM.
+
+        HOG features (31 features for every 8x8 cell, see ::SimdHogExtractFeatures) are computed once for every scale level.
+        A linear SVM is evaluated over all windows of the level at once as a correlation of its weights with the feature map:
+        every weight is multiplied by a row of feature map and added to a row of window responses (see ::SimdNeuralAddVectorMultipliedByValue).
+        Levels are processed in parallel. Detections from all levels are grouped with non-maximum suppression (see ::SimdNonMaxSuppression32f).
+
+        Using example:
+        \verbatim
+        #include "Simd/SimdHog.hpp"
+        #include "Simd/SimdDrawing.hpp"
+
+        int main()
+        {
+            typedef Simd::HogDetector<Simd::Allocator> HogDetector;
+
+            HogDetector::View image;
+            image.Load("pedestrians.pgm");
+
+            std::vector<float> weights = ...; // weights of linear SVM trained on 8x16 cells windows.
+            float bias = ...;
+
+            HogDetector detector;
+            detector.SetModel(weights.data(), HogDetector::Size(8, 16), bias);
+            detector.Init(image.Size());
+
+            HogDetector::Objects objects;
+            detector.Detect(image, objects);
+
+            for (size_t i = 0; i < objects.size(); ++i)
+                Simd::DrawRectangle(image, objects[i].rect, uint8_t(255));
+            image.Save("result.pgm");
+
+            return 0;
+        }
+        \endverbatim
+    */
+    template <template<class> class A>
+    struct HogDetector
+    {
+        typedef A<uint8_t> Allocator; /*!< Allocator type definition. */
+        typedef Simd::View<A> View; /*!< An image type definition. */
+        typedef Simd::Point<ptrdiff_t> Size; /*!< An image size type definition. */
+        typedef Rectangle<ptrdiff_t> Rect; /*!< A rectangle type definition. */
+
+        static const ptrdiff_t CELL = 8; /*!< A size of HOG cell. */
+        static const size_t FEATURES = 31; /*!< A number of HOG features in one cell. */
+
+        /*!
+            \short The Object structure describes detected object.
+        */
+        struct Object
+        {
+            Rect rect; /*!< \brief A bounding box around of detected object. */
+            float score; /*!< \brief A response of linear SVM. */
+
+            /*!
+                Creates a new Object structure.
+
+                \param [in] r - initial bounding box.
+                \param [in] s - initial score.
+            */
+            Object(const Rect & r = Rect(), float s = 0.0f)
+                : rect(r)
+                , score(s)
+            {
+            }
+        };
+        typedef std::vector<Object> Objects; /*!< A vector of detected objects. */
+
+        /*!
+            Creates a new empty HogDetector structure.
+        */
+        HogDetector()
+            : _bias(0)
+            , _threadNumber(1)
+        {
+        }
+
+        /*!
+            Sets a model of linear SVM.
+
+            \param [in] weights - a pointer to SVM weights. The weights are stored in the same order as HOG features of window:
+                                  window.y rows of window.x cells with 31 features for every cell.
+            \param [in] window - a size of detection window (in cells).
+            \param [in] bias - a bias of SVM.
+            \return a result of this operation.
+        */
+        bool SetModel(const float * weights, const Size & window, float bias)
+        {
+            if (weights == NULL || window.x <= 0 || window.y <= 0)
+                return false;
+            _window = window;
+            _weights.assign(weights, weights + window.x * window.y * FEATURES);
+            _bias = bias;
+            _levels.clear();
+            return true;
+        }
+
+        /*!
+            Prepares HogDetector structure to work with image of given size.
+
+            \param [in] imageSize - a size of input image.
+            \param [in] scaleFactor - a scale factor between neighboring levels. It must be greater than 1.
+            \param [in] sizeMin - a minimal size of detected objects.
+            \param [in] sizeMax - a maximal size of detected objects.
+            \param [in] threadNumber - a number of work threads. Use value -1 to auto choose of thread number.
+            \return a result of this operation.
+        */
+        bool Init(const Size & imageSize, double scaleFactor = 1.2, const Size & sizeMin = Size(0, 0),
+            const Size & sizeMax = Size(INT_MAX, INT_MAX), ptrdiff_t threadNumber = -1)
+        {
+            if (_weights.empty() || scaleFactor <= 1.0)
+                return false;
+            _imageSize = imageSize;
+            ptrdiff_t threadNumberMax = std::thread::hardware_concurrency();
+            _threadNumber = (threadNumber <= 0 || threadNumber > threadNumberMax) ? threadNumberMax : threadNumber;
+            _levels.clear();
+            for (double scale = 1.0; true; scale *= scaleFactor)
+            {
+                Size size = Size(ptrdiff_t(imageSize.x / scale), ptrdiff_t(imageSize.y / scale));
+                Size cells = size / CELL;
+                if (cells.x < std::max<ptrdiff_t>(_window.x, 2) || cells.y < std::max<ptrdiff_t>(_window.y, 2))
+                    break;
+                Size object = Size(ptrdiff_t(_window.x * CELL * scale), ptrdiff_t(_window.y * CELL * scale));
+                if (object.x > sizeMax.x || object.y > sizeMax.y)
+                    break;
+                if (object.x < sizeMin.x || object.y < sizeMin.y)
+                    continue;
+
+                _levels.push_back(LevelPtr(new Level()));
+                Level & level = *_levels.back();
+                level.scaleX = double(imageSize.x) / size.x;
+                level.scaleY = double(imageSize.y) / size.y;
+                level.cells = cells;
+                level.map = cells - _window + Size(1, 1);
+                if (size != imageSize)
+                    level.image.Recreate(size, View::Gray8);
+                level.features.resize(cells.x * cells.y * FEATURES);
+                level.planes.resize(cells.x * cells.y * FEATURES);
+                level.scores.resize(level.map.x * level.map.y);
+            }
+            return !_levels.empty();
+        }
+
+        /*!
+            Detects objects at given image.
+
+            \param [in] src - an input 8-bit gray image. It must have the size which was given in HogDetector::Init.
+            \param [out] objects - detected objects.
+            \param [in] threshold - a minimal response of SVM for detected objects. By default it is equal to 0.
+            \param [in] overlap - a maximal overlap (intersection over union) of grouped objects.
+                                  If it is not less then 1 then the detections are not grouped. By default it is equal to 0.5.
+            \return a result of this operation.
+        */
+        bool Detect(const View & src, Objects & objects, float threshold = 0.0f, float overlap = 0.5f)
+        {
+            if (_levels.empty() || src.format != View::Gray8 || src.Size() != _imageSize)
+                return false;
+
+            std::atomic<size_t> next(0);
+            size_t threadNumber = std::min<size_t>(_threadNumber, _levels.size());
+            Parallel(0, threadNumber, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t i = next++; i < _levels.size(); i = next++)
+                    DetectLevel(*_levels[i], src, threshold);
+            }, threadNumber);
+
+            Objects candidates;
+            for (size_t i = 0; i < _levels.size(); ++i)
+                candidates.insert(candidates.end(), _levels[i]->objects.begin(), _levels[i]->objects.end());
+
+            objects.clear();
+            if (overlap >= 1.0f)
+            {
+                objects.swap(candidates);
+                return true;
+            }
+
+            std::vector<Rectangle<float>> boxes(candidates.size());
+            std::vector<float> scores(candidates.size());
+            for (size_t i = 0; i < candidates.size(); ++i)
+            {
+                const Rect & r = candidates[i].rect;
+                boxes[i] = Rectangle<float>(float(r.left), float(r.top), float(r.right), float(r.bottom));
+                scores[i] = candidates[i].score;
+            }
+            std::vector<size_t> indices;
+            NonMaxSuppression(boxes, scores, indices, SimdNonMaxSuppressionHard, overlap, 0.5f, -FLT_MAX);
+            for (size_t i = 0; i < indices.size(); ++i)
+                objects.push_back(candidates[indices[i]]);
+
+            return true;
+        }
+
+    private:
+        struct Level
+        {
+            double scaleX, scaleY;
+            Size cells, map;
+            View image;
+            std::vector<float> features, planes, scores;
+            Objects objects;
+        };
+        typedef std::unique_ptr<Level> LevelPtr;
+        typedef std::vector<LevelPtr> LevelPtrs;
+
+        Size _imageSize, _window;
+        std::vector<float> _weights;
+        float _bias;
+        LevelPtrs _levels;
+        ptrdiff_t _threadNumber;
+
+        void DetectLevel(Level & level, const View & src, float threshold)
+        {
+            const Size & cells = level.cells, & map = level.map;
+            if (level.image.format != View::None)
+                Simd::ResizeBilinear(src, level.image);
+            const View & image = level.image.format != View::None ? level.image : src;
+            Simd::HogExtractFeatures(image.Region(0, 0, cells.x * CELL, cells.y * CELL), level.features.data());
+
+            float * planes[FEATURES];
+            for (size_t f = 0; f < FEATURES; ++f)
+                planes[f] = level.planes.data() + f * cells.x * cells.y;
+            SimdHogDeinterleave(level.features.data(), cells.x * FEATURES, cells.x, cells.y, FEATURES, planes, cells.x);
+
+            std::fill(level.scores.begin(), level.scores.end(), _bias);
+            for (ptrdiff_t y = 0; y < map.y; ++y)
+            {
+                float * dst = level.scores.data() + y * map.x;
+                for (ptrdiff_t wy = 0; wy < _window.y; ++wy)
+                {
+                    for (ptrdiff_t wx = 0; wx < _window.x; ++wx)
+                    {
+                        const float * weight = _weights.data() + (wy * _window.x + wx) * FEATURES;
+                        for (size_t f = 0; f < FEATURES; ++f)
+                            SimdNeuralAddVectorMultipliedByValue(planes[f] + (y + wy) * cells.x + wx, map.x, weight + f, dst);
+                    }
+                }
+            }
+
+            level.objects.clear();
+            for (ptrdiff_t y = 0; y < map.y; ++y)
+            {
+                const float * score = level.scores.data() + y * map.x;
+                for (ptrdiff_t x = 0; x < map.x; ++x)
+                {
+                    if (score[x] > threshold)
+                    {
+                        Rect rect(Round(x * CELL * level.scaleX), Round(y * CELL * level.scaleY),
+                            Round((x + _window.x) * CELL * level.scaleX), Round((y + _window.y) * CELL * level.scaleY));
+                        level.objects.push_back(Object(rect, score[x]));
+                    }
+                }
+            }
+        }
+    };
+
+    template <template<class> class A> const ptrdiff_t HogDetector<A>::CELL;
+    template <template<class> class A> const size_t HogDetector<A>::FEATURES;
+}
+
+#endif//__SimdHog_hpp__
@@ -0,0 +1,541 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdHogLite_hpp__
+#define __SimdHogLite_hpp__
+
+#include "Simd/SimdLib.hpp"
+#include "Simd/SimdParallel.hpp"
+
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <thread>
+#include <algorithm>
+#include <cmath>
+
+#include <float.h>
+
+namespace Simd
+{
+    /*! @ingroup cpp_hog
+
+        \short HogLite structure provides multi-scale part-based (DPM-style) object detection with lite HOG features.
+
+        The feature pyramid is built once per image:
+        - features are extracted (see ::SimdHogLiteExtractFeatures) only at the base of every octave (the image is reduced in 2 times between octaves);
+        - features of intermediate levels of octave are resized from the features of its base (see ::SimdHogLiteResizeFeatures);
+        - features of parts (twice finer resolution) of a level are the root features of the level which is one octave below;
+          for the first octave they are extracted with 4x4 cells;
+        - optionally features are compressed from 16 to 8 values with PCA (see ::SimdHogLiteCompressFeatures).
+
+        For every level (levels are processed in parallel) the root filter is applied to the root features,
+        the parts filters are applied to the parts features only near positions of roots which pass root threshold (see ::SimdHogLiteCreateMask, ::SimdHogLiteFilterFeatures),
+        and the best displacement of every part is searched in 7x7 neighborhood of its anchor (see ::SimdHogLiteFindMax7x7).
+        Local maximums of total score are returned as peaks.
+
+        Using example:
+        \verbatim
+        #include "Simd/SimdHogLite.hpp"
+
+        int main()
+        {
+            typedef Simd::HogLite<Simd::Allocator> HogLite;
+
+            HogLite::View image;
+            image.Load("cars.pgm");
+
+            HogLite::Model model = ...; // root filter, parts and bias of trained model.
+
+            HogLite hogLite;
+            hogLite.SetModel(model);
+            hogLite.Init(image.Size());
+
+            HogLite::Peaks peaks;
+            hogLite.Detect(image, peaks, 0.0f);
+
+            return 0;
+        }
+        \endverbatim
+    */
+    template <template<class> class A>
+    struct HogLite
+    {
+        typedef A<uint8_t> Allocator; /*!< Allocator type definition. */
+        typedef Simd::View<A> View; /*!< An image type definition. */
+        typedef Simd::Point<ptrdiff_t> Size; /*!< An image size type definition. */
+        typedef Simd::Point<ptrdiff_t> Point; /*!< A point type definition. */
+        typedef Rectangle<ptrdiff_t> Rect; /*!< A rectangle type definition. */
+        typedef std::vector<Rect> Rects; /*!< A vector of rectangles type definition. */
+
+        static const ptrdiff_t CELL = 8; /*!< A size of cell of root features (in pixels of pyramid level). */
+        static const size_t FEATURES = 16; /*!< A number of lite HOG features in one cell. */
+        static const size_t COMPRESSED = 8; /*!< A number of features in one cell after PCA compression. */
+        static const ptrdiff_t DISPLACEMENT = 3; /*!< A maximal displacement of part from its anchor (in cells of parts features). */
+
+        /*!
+            \short The Filter structure describes a filter applied to feature map.
+        */
+        struct Filter
+        {
+            Size size; /*!< \brief A size of the filter (in cells). */
+            std::vector<float> weights; /*!< \brief Weights of the filter: size.y rows of size.x cells with 16 (or 8 if PCA is used) weights for every cell. */
+        };
+
+        /*!
+            \short The Part structure describes a part of the model.
+        */
+        struct Part
+        {
+            Filter filter; /*!< \brief A filter of the part. It is applied to the features of twice finer resolution. */
+            Point anchor; /*!< \brief A position of the part relative to the root (in cells of parts features, i.e. doubled root cells). Zero anchor places the part at the top-left corner of the root. */
+            float deformation[49]; /*!< \brief 7x7 costs of part displacement in range [-3, 3] from its anchor. The cost is subtracted from the part response. */
+        };
+        typedef std::vector<Part> Parts; /*!< A vector of parts type definition. */
+
+        /*!
+            \short The Model structure describes a model: root filter, parts and bias.
+        */
+        struct Model
+        {
+            Filter root; /*!< \brief A root filter. */
+            Parts parts; /*!< \brief Parts of the model. It can be empty. */
+            float bias; /*!< \brief A bias of the model. */
+            std::vector<float> pca; /*!< \brief A PCA matrix 16x8. If it is not empty then features are compressed to 8 values for every cell. */
+
+            Model() : bias(0) {}
+        };
+
+        /*!
+            \short The Peak structure describes a detected object.
+        */
+        struct Peak
+        {
+            Rect rect; /*!< \brief A bounding box of the root. */
+            float score; /*!< \brief A total score (root and parts responses, deformation costs and bias). */
+            double scale; /*!< \brief A scale of pyramid level where the peak was found. */
+            size_t level; /*!< \brief An index of pyramid level where the peak was found. */
+            Rects parts; /*!< \brief Bounding boxes of placed parts. */
+        };
+        typedef std::vector<Peak> Peaks; /*!< A vector of peaks type definition. */
+
+        /*!
+            \short The Features structure describes a feature map of pyramid level.
+        */
+        struct Features
+        {
+            const float * data; /*!< \brief A pointer to features. */
+            size_t stride; /*!< \brief A row size of the feature map (in floats). */
+            Size size; /*!< \brief A size of the feature map (in cells). */
+        };
+
+        /*!
+            Creates a new empty HogLite structure.
+        */
+        HogLite()
+            : _interval(0)
+            , _featureSize(FEATURES)
+            , _threadNumber(1)
+        {
+        }
+
+        /*!
+            Sets the model.
+
+            \param [in] model - a model.
+            \return a result of this operation.
+        */
+        bool SetModel(const Model & model)
+        {
+            size_t featureSize = model.pca.empty() ? FEATURES : COMPRESSED;
+            if (!model.pca.empty() && model.pca.size() != FEATURES * COMPRESSED)
+                return false;
+            if (!Valid(model.root, featureSize))
+                return false;
+            for (size_t i = 0; i < model.parts.size(); ++i)
+                if (!Valid(model.parts[i].filter, featureSize))
+                    return false;
+            _model = model;
+            _featureSize = featureSize;
+            _deformations.assign(model.parts.size() * 8 * 8, 0.0f);
+            for (size_t i = 0; i < model.parts.size(); ++i)
+                for (size_t y = 0; y < 7; ++y)
+                    for (size_t x = 0; x < 7; ++x)
+                        _deformations[(i * 8 + y) * 8 + x] = -model.parts[i].deformation[y * 7 + x];
+            _levels.clear();
+            return true;
+        }
+
+        /*!
+            Prepares HogLite structure to work with image of given size.
+
+            \param [in] imageSize - a size of input image.
+            \param [in] interval - a number of levels in one octave. By default it is equal to 5.
+            \param [in] threadNumber - a number of work threads. Use value -1 to auto choose of thread number.
+            \return a result of this operation.
+        */
+        bool Init(const Size & imageSize, size_t interval = 5, ptrdiff_t threadNumber = -1)
+        {
+            if (_model.root.weights.empty() || interval == 0)
+                return false;
+            _imageSize = imageSize;
+            _interval = interval;
+            ptrdiff_t threadNumberMax = std::thread::hardware_concurrency();
+            _threadNumber = (threadNumber <= 0 || threadNumber > threadNumberMax) ? threadNumberMax : threadNumber;
+
+            _octaves.clear();
+            _levels.clear();
+            for (Size size = imageSize; true; size = (size + Size(1, 1)) / 2)
+            {
+                size_t added = 0;
+                for (size_t k = 0; k < interval; ++k, ++added)
+                {
+                    Size base = size / CELL - Size(2, 2);
+                    if (size.x < CELL * 3 || size.y < CELL * 3)
+                        break;
+                    double factor = ::pow(2.0, double(k) / interval);
+                    Size root(Round(base.x / factor), Round(base.y / factor));
+                    if (root.x < _model.root.size.x || root.y < _model.root.size.y)
+                        break;
+                    if (k == 0)
+                        _octaves.push_back(ViewPtr(new View(size, View::Gray8)));
+                    _levels.push_back(LevelPtr(new Level()));
+                    Level & level = *_levels.back();
+                    level.octave = _octaves.size() - 1;
+                    level.scale = double(1 << level.octave) * factor;
+                    level.root.Resize(root, _featureSize);
+                    if (level.octave == 0)
+                        level.part.Resize(k == 0 ? imageSize / (CELL / 2) - Size(2, 2) : Size(), _featureSize);
+                }
+                if (added < interval)
+                    break;
+            }
+            for (size_t l = 0; l < _levels.size(); ++l)
+            {
+                Level & level = *_levels[l];
+                if (level.octave == 0 && l > 0)
+                {
+                    Size base = _levels[0]->part.size;
+                    double factor = level.scale;
+                    level.part.Resize(Size(Round(base.x / factor), Round(base.y / factor)), _featureSize);
+                }
+                InitEvaluation(level, l);
+            }
+            return !_levels.empty();
+        }
+
+        /*!
+            Detects objects at given image.
+
+            \param [in] src - an input 8-bit gray image. It must have the size which was given in HogLite::Init.
+            \param [out] peaks - detected objects (local maximums of total score) ordered by score.
+            \param [in] threshold - a minimal total score of detected objects. By default it is equal to 0.
+            \param [in] rootThreshold - a minimal response of root filter. Parts are evaluated only for roots with greater response. 
+                                        By default it is equal to -FLT_MAX (all roots are evaluated).
+            \return a result of this operation.
+        */
+        bool Detect(const View & src, Peaks & peaks, float threshold = 0.0f, float rootThreshold = -FLT_MAX)
+        {
+            if (_levels.empty() || src.format != View::Gray8 || src.Size() != _imageSize)
+                return false;
+
+            Simd::Copy(src, *_octaves[0]);
+            for (size_t o = 1; o < _octaves.size(); ++o)
+                Simd::ReduceGray2x2(*_octaves[o - 1], *_octaves[o]);
+
+            Run([this](Level & level, size_t index) { if (index % _interval == 0) ExtractFeatures(level); });
+            Run([this](Level & level, size_t index) { if (index % _interval != 0) ResizeFeatures(level, *_levels[index - index % _interval]); });
+            Run([this, threshold, rootThreshold](Level & level, size_t index) { EvaluateLevel(level, index, threshold, rootThreshold); });
+
+            peaks.clear();
+            for (size_t l = 0; l < _levels.size(); ++l)
+                peaks.insert(peaks.end(), _levels[l]->peaks.begin(), _levels[l]->peaks.end());
+            std::stable_sort(peaks.begin(), peaks.end(), [](const Peak & a, const Peak & b) { return a.score > b.score; });
+            return true;
+        }
+
+        /*!
+            Gets number of levels in the pyramid.
+
+            \return a number of pyramid levels.
+        */
+        size_t Levels() const
+        {
+            return _levels.size();
+        }
+
+        /*!
+            Gets a scale of pyramid level (relative to input image).
+
+            \param [in] level - an index of pyramid level.
+            \return a scale of the level.
+        */
+        double Scale(size_t level) const
+        {
+            return _levels[level]->scale;
+        }
+
+        /*!
+            Gets root features of pyramid level (they are valid after HogLite::Detect).
+
+            \param [in] level - an index of pyramid level.
+            \return root features.
+        */
+        Features RootFeatures(size_t level) const
+        {
+            return _levels[level]->root.Get();
+        }
+
+        /*!
+            Gets parts features of pyramid level (they are valid after HogLite::Detect).
+
+            \param [in] level - an index of pyramid level.
+            \return parts features.
+        */
+        Features PartFeatures(size_t level) const
+        {
+            return PartMap(level).Get();
+        }
+
+    private:
+        struct Map
+        {
+            Size size;
+            size_t stride;
+            std::vector<float> data;
+
+            void Resize(const Size & s, size_t featureSize)
+            {
+                size = s;
+                stride = size.x * featureSize;
+                data.resize(stride * size.y);
+            }
+
+            Features Get() const
+            {
+                Features features = { data.data(), stride, size };
+                return features;
+            }
+        };
+
+        struct Level
+        {
+            size_t octave;
+            double scale;
+            Map root, part, padded;
+            Size map, mask, pad;
+            std::vector<float> rootMap, scores, responses, buffer;
+            std::vector<uint32_t> masks;
+            Peaks peaks;
+        };
+        typedef std::unique_ptr<Level> LevelPtr;
+        typedef std::vector<LevelPtr> LevelPtrs;
+        typedef std::unique_ptr<View> ViewPtr;
+        typedef std::vector<ViewPtr> ViewPtrs;
+
+        Model _model;
+        Size _imageSize;
+        size_t _interval, _featureSize;
+        ptrdiff_t _threadNumber;
+        std::vector<float> _deformations;
+        ViewPtrs _octaves;
+        LevelPtrs _levels;
+
+        static bool Valid(const Filter & filter, size_t featureSize)
+        {
+            return filter.size.x > 0 && filter.size.y > 0 && filter.weights.size() == filter.size.x * filter.size.y * featureSize;
+        }
+
+        const Map & PartMap(size_t index) const
+        {
+            return index < _interval ? _levels[index]->part : _levels[index - _interval]->root;
+        }
+
+        template<class Function> void Run(Function function)
+        {
+            std::atomic<size_t> next(0);
+            size_t threadNumber = std::min<size_t>(_threadNumber, _levels.size());
+            Parallel(0, threadNumber, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t i = next++; i < _levels.size(); i = next++)
+                    function(*_levels[i], i);
+            }, threadNumber);
+        }
+
+        void Extract(const View & image, size_t cell, Map & map, std::vector<float> & buffer)
+        {
+            if (_model.pca.empty())
+                Simd::HogLiteExtractFeatures(image, cell, map.data.data(), map.stride);
+            else
+            {
+                buffer.resize(map.size.x * map.size.y * FEATURES);
+                Simd::HogLiteExtractFeatures(image, cell, buffer.data(), map.size.x * FEATURES);
+                SimdHogLiteCompressFeatures(buffer.data(), map.size.x * FEATURES, map.size.x, map.size.y, _model.pca.data(), map.data.data(), map.stride);
+            }
+        }
+
+        void ExtractFeatures(Level & level)
+        {
+            const View & image = *_octaves[level.octave];
+            Extract(image, CELL, level.root, level.buffer);
+            if (level.part.size.x > 0)
+                Extract(image, CELL / 2, level.part, level.buffer);
+        }
+
+        void ResizeFeatures(Level & level, const Level & base)
+        {
+            SimdHogLiteResizeFeatures(base.root.data.data(), base.root.stride, base.root.size.x, base.root.size.y, _featureSize,
+                level.root.data.data(), level.root.stride, level.root.size.x, level.root.size.y);
+            if (level.part.size.x > 0)
+                SimdHogLiteResizeFeatures(base.part.data.data(), base.part.stride, base.part.size.x, base.part.size.y, _featureSize,
+                    level.part.data.data(), level.part.stride, level.part.size.x, level.part.size.y);
+        }
+
+        static SIMD_INLINE Size PartOrigin(const Part & part)
+        {
+            // Root cell x starts at pixel (x + 1) * CELL, that is at part cell 2 * x + 1.
+            return part.anchor + Size(1, 1) - Size(DISPLACEMENT, DISPLACEMENT);
+        }
+
+        void InitEvaluation(Level & level, size_t index)
+        {
+            const Filter & root = _model.root;
+            level.map = level.root.size - root.size + Size(1, 1);
+            level.rootMap.resize(level.map.x * level.map.y);
+            level.scores.resize(level.map.x * level.map.y);
+            if (_model.parts.empty())
+                return;
+            level.mask = level.map * 2 + Size(5, 5);
+            level.masks.resize(level.mask.x * level.mask.y);
+            level.responses.resize(_model.parts.size() * level.mask.x * level.mask.y + 8);
+            const Size & part = PartMap(index).size;
+            Size lo, hi;
+            for (size_t i = 0; i < _model.parts.size(); ++i)
+            {
+                const Part & p = _model.parts[i];
+                Size begin = PartOrigin(p);
+                Size end = begin + level.mask + p.filter.size - Size(1, 1);
+                lo = Size(std::max(lo.x, -begin.x), std::max(lo.y, -begin.y));
+                hi = Size(std::max(hi.x, end.x - part.x), std::max(hi.y, end.y - part.y));
+            }
+            level.pad = lo;
+            level.padded.Resize(part + lo + hi, _featureSize);
+        }
+
+        void EvaluateLevel(Level & level, size_t index, float threshold, float rootThreshold)
+        {
+            const Filter & root = _model.root;
+            const Map & features = level.root;
+            SimdHogLiteFilterFeatures(features.data.data(), features.stride, features.size.x, features.size.y, _featureSize,
+                root.weights.data(), root.size.x, root.size.y, NULL, 0, level.rootMap.data(), level.map.x);
+            for (size_t i = 0; i < level.scores.size(); ++i)
+                level.scores[i] = level.rootMap[i] > rootThreshold ? level.rootMap[i] + _model.bias : -FLT_MAX;
+
+            if (!_model.parts.empty())
+            {
+                SimdHogLiteCreateMask(level.rootMap.data(), level.map.x, level.map.x, level.map.y, &rootThreshold, 2, 7, level.masks.data(), level.mask.x);
+
+                const Map & part = PartMap(index);
+                for (ptrdiff_t y = 0; y < part.size.y; ++y)
+                    std::copy(part.data.data() + y * part.stride, part.data.data() + (y + 1) * part.stride,
+                        level.padded.data.data() + (y + level.pad.y) * level.padded.stride + level.pad.x * _featureSize);
+
+                for (size_t i = 0; i < _model.parts.size(); ++i)
+                {
+                    const Part & p = _model.parts[i];
+                    Size begin = PartOrigin(p) + level.pad;
+                    const float * src = level.padded.data.data() + begin.y * level.padded.stride + begin.x * _featureSize;
+                    float * response = level.responses.data() + i * level.mask.x * level.mask.y;
+                    SimdHogLiteFilterFeatures(src, level.padded.stride, level.mask.x + p.filter.size.x - 1, level.mask.y + p.filter.size.y - 1, _featureSize,
+                        p.filter.weights.data(), p.filter.size.x, p.filter.size.y, level.masks.data(), level.mask.x, response, level.mask.x);
+                    for (ptrdiff_t y = 0; y < level.map.y; ++y)
+                    {
+                        float * scores = level.scores.data() + y * level.map.x;
+                        for (ptrdiff_t x = 0; x < level.map.x; ++x)
+                        {
+                            if (scores[x] == -FLT_MAX)
+                                continue;
+                            float value;
+                            size_t col, row;
+                            SimdHogLiteFindMax7x7(response + 2 * y * level.mask.x + 2 * x, level.mask.x, _deformations.data() + i * 64, 8, 7, &value, &col, &row);
+                            scores[x] += value;
+                        }
+                    }
+                }
+            }
+
+            level.peaks.clear();
+            for (ptrdiff_t y = 0; y < level.map.y; ++y)
+            {
+                for (ptrdiff_t x = 0; x < level.map.x; ++x)
+                {
+                    float score = level.scores[y * level.map.x + x];
+                    if (score <= threshold || !LocalMaximum(level, x, y, score))
+                        continue;
+                    Peak peak;
+                    peak.score = score;
+                    peak.scale = level.scale;
+                    peak.level = index;
+                    peak.rect = Box(Point(x + 1, y + 1) * CELL, root.size * CELL, level.scale);
+                    for (size_t i = 0; i < _model.parts.size(); ++i)
+                    {
+                        const Part & p = _model.parts[i];
+                        const float * response = level.responses.data() + i * level.mask.x * level.mask.y;
+                        float value;
+                        size_t col, row;
+                        SimdHogLiteFindMax7x7(response + 2 * y * level.mask.x + 2 * x, level.mask.x, _deformations.data() + i * 64, 8, 7, &value, &col, &row);
+                        Point position = Point(x, y) * 2 + PartOrigin(p) + Point(col, row);
+                        peak.parts.push_back(Box((position + Point(1, 1)) * (CELL / 2), p.filter.size * (CELL / 2), level.scale));
+                    }
+                    level.peaks.push_back(peak);
+                }
+            }
+        }
+
+        static bool LocalMaximum(const Level & level, ptrdiff_t x, ptrdiff_t y, float score)
+        {
+            for (ptrdiff_t dy = -1; dy <= 1; ++dy)
+            {
+                for (ptrdiff_t dx = -1; dx <= 1; ++dx)
+                {
+                    ptrdiff_t nx = x + dx, ny = y + dy;
+                    if ((dx || dy) && nx >= 0 && nx < level.map.x && ny >= 0 && ny < level.map.y && level.scores[ny * level.map.x + nx] > score)
+                        return false;
+                }
+            }
+            return true;
+        }
+
+        static Rect Box(const Point & position, const Size & size, double scale)
+        {
+            return Rect(Round(position.x * scale), Round(position.y * scale), Round((position.x + size.x) * scale), Round((position.y + size.y) * scale));
+        }
+    };
+
+    template <template<class> class A> const ptrdiff_t HogLite<A>::CELL;
+    template <template<class> class A> const size_t HogLite<A>::FEATURES;
+    template <template<class> class A> const size_t HogLite<A>::COMPRESSED;
+    template <template<class> class A> const ptrdiff_t HogLite<A>::DISPLACEMENT;
+}
+
+#endif//__SimdHogLite_hpp__
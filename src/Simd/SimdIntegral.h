@@ -46,7 +46,7 @@ namespace Simd
         void *_p;
     };
 
-    template <class TSum> void IntegralSum(const uint8_t * src, size_t srcStride, size_t width, size_t height, TSum * sum, size_t sumStride)
+    template <class TSum, class TSrc> void IntegralSum(const TSrc * src, size_t srcStride, size_t width, size_t height, TSum * sum, size_t sumStride)
     {
         memset(sum, 0, (width + 1) * sizeof(TSum));
         sum += sumStride + 1;
@@ -65,7 +65,7 @@ namespace Simd
         }
     }
 
-    template <class TSum, class TSqsum> void IntegralSumSqsum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+    template <class TSum, class TSqsum, class TSrc> void IntegralSumSqsum(const TSrc * src, size_t srcStride, size_t width, size_t height,
         TSum * sum, size_t sumStride, TSqsum * sqsum, size_t sqsumStride)
     {
         memset(sum, 0, (width + 1) * sizeof(TSum));
@@ -246,5 +246,54 @@ namespace Simd
             }
         }
     }
+
+    template <class TSum, class TSrc> SIMD_INLINE void IntegralRowSum(const TSrc * src, size_t width, TSum * sum)
+    {
+        TSum rowSum = 0;
+        sum[-1] = 0;
+        for (size_t col = 0; col < width; col++)
+        {
+            rowSum += src[col];
+            sum[col] = rowSum;
+        }
+    }
+
+    template <class TSum, class TSqsum, class TSrc> SIMD_INLINE void IntegralRowSumSqsum(const TSrc * src, size_t width, TSum * sum, TSqsum * sqsum)
+    {
+        TSum rowSum = 0;
+        TSqsum rowSqsum = 0;
+        sum[-1] = 0;
+        sqsum[-1] = 0;
+        for (size_t col = 0; col < width; col++)
+        {
+            TSum value = src[col];
+            rowSum += value;
+            rowSqsum += value*value;
+            sum[col] = rowSum;
+            sqsum[col] = rowSqsum;
+        }
+    }
+
+    template <class T> void IntegralColSum(T * sum, size_t stride, size_t width, size_t height)
+    {
+        for (size_t row = 1; row < height; row++)
+        {
+            const T * prev = sum;
+            sum += stride;
+            for (size_t col = 0; col < width; col++)
+                sum[col] += prev[col];
+        }
+    }
+
+    namespace Base
+    {
+        const size_t INTEGRAL_BAND_MIN = 64;
+        const size_t INTEGRAL_STRIP = 256;
+
+        size_t IntegralThreadNumber(size_t width, size_t height);
+
+        void IntegralParallel(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * sum, size_t sumStride, 
+            uint8_t * sqsum, size_t sqsumStride, SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat, size_t threadNumber);
+    }
 }
 #endif//__SimdIntegral_h__
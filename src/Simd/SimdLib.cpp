@@ -62,6 +62,8 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdPerformance.h"
 
 #include "Simd/SimdResizer.h"
+#include "Simd/SimdWarp.h"
+#include "Simd/SimdBackgroundMixture.h"
 #include "Simd/SimdSynetConvolution8i.h"
 #include "Simd/SimdSynetConvolution32f.h"
 #include "Simd/SimdSynetDeconvolution32f.h"
@@ -764,6 +766,22 @@ SIMD_API void SimdBackgroundInitMask(const uint8_t * src, size_t srcStride, size
         Base::BackgroundInitMask(src, srcStride, width, height, index, value, dst, dstStride);
 }
 
+SIMD_API void * SimdBackgroundMixtureInit(size_t width, size_t height, size_t channels, size_t gaussians, size_t scale,
+    float learningRate, float varianceThreshold, float backgroundRatio)
+{
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        return Avx2::BackgroundMixtureInit(width, height, channels, gaussians, scale, learningRate, varianceThreshold, backgroundRatio);
+    else
+#endif
+        return Base::BackgroundMixtureInit(width, height, channels, gaussians, scale, learningRate, varianceThreshold, backgroundRatio);
+}
+
+SIMD_API void SimdBackgroundMixtureRun(void * mixture, const uint8_t * src, size_t srcStride, uint8_t * mask, size_t maskStride)
+{
+    ((BackgroundMixture*)mixture)->Run(src, srcStride, mask, maskStride);
+}
+
 SIMD_API void SimdBayerToBgr(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -1364,6 +1382,44 @@ SIMD_API void SimdAveragingBinarization(const uint8_t * src, size_t srcStride, s
         Base::AveragingBinarization(src, srcStride, width, height, value, neighborhood, threshold, positive, negative, dst, dstStride, compareType);
 }
 
+SIMD_API void SimdBoxFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+    size_t channelCount, size_t radiusX, size_t radiusY, uint8_t * dst, size_t dstStride)
+{
+    typedef void(*SimdBoxFilterPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        size_t channelCount, size_t radiusX, size_t radiusY, uint8_t * dst, size_t dstStride);
+    const static SimdBoxFilterPtr simdBoxFilter = SIMD_FUNC2(BoxFilter, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC);
+
+    simdBoxFilter(src, srcStride, width, height, channelCount, radiusX, radiusY, dst, dstStride);
+}
+
+SIMD_API void SimdBoxSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+    size_t channelCount, size_t radiusX, size_t radiusY, uint8_t * sum, size_t sumStride)
+{
+    typedef void(*SimdBoxSumPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        size_t channelCount, size_t radiusX, size_t radiusY, uint8_t * sum, size_t sumStride);
+    const static SimdBoxSumPtr simdBoxSum = SIMD_FUNC2(BoxSum, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC);
+
+    simdBoxSum(src, srcStride, width, height, channelCount, radiusX, radiusY, sum, sumStride);
+}
+
+SIMD_API void SimdBoxFilter32f(const float * src, size_t srcStride, size_t width, size_t height, size_t channelCount,
+    size_t radiusX, size_t radiusY, float * dst, size_t dstStride, SimdBool normalize)
+{
+    typedef void(*SimdBoxFilter32fPtr) (const float * src, size_t srcStride, size_t width, size_t height, size_t channelCount,
+        size_t radiusX, size_t radiusY, float * dst, size_t dstStride, SimdBool normalize);
+    const static SimdBoxFilter32fPtr simdBoxFilter32f = SIMD_FUNC2(BoxFilter32f, SIMD_AVX_FUNC, SIMD_SSE_FUNC);
+
+    simdBoxFilter32f(src, srcStride, width, height, channelCount, radiusX, radiusY, dst, dstStride, normalize);
+}
+
+SIMD_API void SimdCanny(const uint8_t * src, size_t srcStride, size_t width, size_t height, int16_t lowThreshold, int16_t highThreshold, uint8_t * dst, size_t dstStride)
+{
+    typedef void(*SimdCannyPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, int16_t lowThreshold, int16_t highThreshold, uint8_t * dst, size_t dstStride);
+    const static SimdCannyPtr simdCanny = SIMD_FUNC2(Canny, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC);
+
+    simdCanny(src, srcStride, width, height, lowThreshold, highThreshold, dst, dstStride);
+}
+
 SIMD_API void SimdConditionalCount8u(const uint8_t * src, size_t stride, size_t width, size_t height,
                                    uint8_t value, SimdCompareType compareType, uint32_t * count)
 {
@@ -1653,6 +1709,11 @@ SIMD_API void * SimdDetectionLoadA(const char * path)
     return Base::DetectionLoadA(path);
 }
 
+SIMD_API SimdBool SimdDetectionSave(const void * data, const char * path)
+{
+    return Base::DetectionSave(data, path);
+}
+
 SIMD_API void SimdDetectionInfo(const void * data, size_t * width, size_t * height, SimdDetectionInfoFlags * flags)
 {
     Base::DetectionInfo(data, width, height, flags);
@@ -1831,6 +1892,16 @@ SIMD_API void SimdDetectionLbpDetect16ii(const void * hid, const uint8_t * mask,
         Base::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
 }
 
+SIMD_API void SimdDistanceTransform(const uint8_t * mask, size_t maskStride, size_t width, size_t height, uint8_t index, SimdDistanceType type,
+    uint8_t * dst, size_t dstStride, SimdPixelFormatType dstFormat)
+{
+    typedef void(*SimdDistanceTransformPtr) (const uint8_t * mask, size_t maskStride, size_t width, size_t height, uint8_t index, SimdDistanceType type,
+        uint8_t * dst, size_t dstStride, SimdPixelFormatType dstFormat);
+    const static SimdDistanceTransformPtr simdDistanceTransform = SIMD_FUNC1(DistanceTransform, SIMD_AVX2_FUNC);
+
+    simdDistanceTransform(mask, maskStride, width, height, index, type, dst, dstStride, dstFormat);
+}
+
 SIMD_API void SimdEdgeBackgroundGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                  uint8_t * background, size_t backgroundStride)
 {
@@ -2514,6 +2585,14 @@ SIMD_API void SimdNormalizeHistogram(const uint8_t * src, size_t srcStride, size
         Base::NormalizeHistogram(src, srcStride, width, height, dst, dstStride);
 }
 
+SIMD_API void SimdClahe(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t tilesX, size_t tilesY, float clipLimit, uint8_t * dst, size_t dstStride)
+{
+    typedef void(*SimdClahePtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t tilesX, size_t tilesY, float clipLimit, uint8_t * dst, size_t dstStride);
+    const static SimdClahePtr simdClahe = SIMD_FUNC1(Clahe, SIMD_AVX2_FUNC);
+
+    simdClahe(src, srcStride, width, height, tilesX, tilesY, clipLimit, dst, dstStride);
+}
+
 SIMD_API void SimdHogDirectionHistograms(const uint8_t * src, size_t stride, size_t width, size_t height, 
                                          size_t cellX, size_t cellY, size_t quantization, float * histograms)
 {
@@ -2832,6 +2911,12 @@ SIMD_API void SimdIntegral(const uint8_t * src, size_t srcStride, size_t width,
         Base::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
 }
 
+SIMD_API void SimdIntegral32f(const float * src, size_t srcStride, size_t width, size_t height, 
+    double * sum, size_t sumStride, double * sqsum, size_t sqsumStride)
+{
+    Base::Integral32f(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride);
+}
+
 SIMD_API void SimdInterferenceIncrement(uint8_t * statistic, size_t stride, size_t width, size_t height, uint8_t increment, int16_t saturation)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -3161,6 +3246,18 @@ SIMD_API void SimdLbpEstimate(const uint8_t * src, size_t srcStride, size_t widt
         Base::LbpEstimate(src, srcStride, width, height, dst, dstStride);
 }
 
+SIMD_API void SimdLucasKanadeTrack(const uint8_t * prev, size_t prevStride, const uint8_t * next, size_t nextStride, size_t width, size_t height,
+    const float * prevPoints, float * nextPoints, size_t count, size_t window, size_t iterations, float epsilon, float minEigen,
+    uint8_t * status, float * errors)
+{
+    typedef void(*SimdLucasKanadeTrackPtr) (const uint8_t * prev, size_t prevStride, const uint8_t * next, size_t nextStride, size_t width, size_t height,
+        const float * prevPoints, float * nextPoints, size_t count, size_t window, size_t iterations, float epsilon, float minEigen,
+        uint8_t * status, float * errors);
+    const static SimdLucasKanadeTrackPtr simdLucasKanadeTrack = SIMD_FUNC1(LucasKanadeTrack, SIMD_AVX2_FUNC);
+
+    simdLucasKanadeTrack(prev, prevStride, next, nextStride, width, height, prevPoints, nextPoints, count, window, iterations, epsilon, minEigen, status, errors);
+}
+
 SIMD_API void SimdMeanFilter3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -3316,6 +3413,24 @@ SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, s
         Base::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
+SIMD_API void SimdMedianFilterSquare(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t radius, uint8_t * dst, size_t dstStride)
+{
+    typedef void(*SimdMedianFilterSquarePtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t radius, uint8_t * dst, size_t dstStride);
+    const static SimdMedianFilterSquarePtr simdMedianFilterSquare = SIMD_FUNC2(MedianFilterSquare, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC);
+
+    simdMedianFilterSquare(src, srcStride, width, height, channelCount, radius, dst, dstStride);
+}
+
+SIMD_API void SimdMorphology(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount,
+    size_t radiusX, size_t radiusY, SimdMorphologyType type, uint8_t * dst, size_t dstStride)
+{
+    typedef void(*SimdMorphologyPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount,
+        size_t radiusX, size_t radiusY, SimdMorphologyType type, uint8_t * dst, size_t dstStride);
+    const static SimdMorphologyPtr simdMorphology = SIMD_FUNC2(Morphology, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC);
+
+    simdMorphology(src, srcStride, width, height, channelCount, radiusX, radiusY, type, dst, dstStride);
+}
+
 SIMD_API void SimdNeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -3829,6 +3944,16 @@ SIMD_API void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, s
     simdNeuralConvolutionForward(src, srcWidth, srcHeight, srcDepth, weight, kernelX, kernelY, padX, padY, strideX, strideY, dilationX, dilationY, buffer, size, dst, dstWidth, dstHeight, dstDepth, add);
 }
 
+SIMD_API size_t SimdNonMaxSuppression32f(const float * boxes, float * scores, size_t count, SimdNonMaxSuppressionType type,
+    float iouThreshold, float sigma, float scoreThreshold, size_t * indices)
+{
+    typedef size_t(*SimdNonMaxSuppression32fPtr) (const float * boxes, float * scores, size_t count, SimdNonMaxSuppressionType type,
+        float iouThreshold, float sigma, float scoreThreshold, size_t * indices);
+    const static SimdNonMaxSuppression32fPtr simdNonMaxSuppression32f = SIMD_FUNC1(NonMaxSuppression32f, SIMD_AVX2_FUNC);
+
+    return simdNonMaxSuppression32f(boxes, scores, count, type, iouThreshold, sigma, scoreThreshold, indices);
+}
+
 SIMD_API void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
                size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type)
 {
@@ -4292,6 +4417,60 @@ SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t s
     ((Resizer*)resizer)->Run(src, srcStride, dst, dstStride);
 }
 
+SIMD_API void * SimdWarpInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type,
+    const float * mat, SimdWarpTransformType transform, SimdWarpInterpType interp, SimdWarpBorderType border, const uint8_t * value)
+{
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        return Avx2::WarpInit(srcW, srcH, dstW, dstH, channels, type, mat, transform, interp, border, value);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if (Sse2::Enable)
+        return Sse2::WarpInit(srcW, srcH, dstW, dstH, channels, type, mat, transform, interp, border, value);
+    else
+#endif
+        return Base::WarpInit(srcW, srcH, dstW, dstH, channels, type, mat, transform, interp, border, value);
+}
+
+SIMD_API void SimdWarpRun(const void * warp, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+{
+    ((Warper*)warp)->Run(src, srcStride, dst, dstStride);
+}
+
+SIMD_API void SimdRemapConvertMap(const float * mapX, size_t mapXStride, const float * mapY, size_t mapYStride, size_t width, size_t height,
+    size_t srcWidth, size_t srcHeight, int16_t * map, size_t mapStride)
+{
+    typedef void(*SimdRemapConvertMapPtr) (const float * mapX, size_t mapXStride, const float * mapY, size_t mapYStride, size_t width, size_t height,
+        size_t srcWidth, size_t srcHeight, int16_t * map, size_t mapStride);
+    const static SimdRemapConvertMapPtr simdRemapConvertMap = SIMD_FUNC2(RemapConvertMap, SIMD_AVX2_FUNC, SIMD_SSE2_FUNC);
+
+    simdRemapConvertMap(mapX, mapXStride, mapY, mapYStride, width, height, srcWidth, srcHeight, map, mapStride);
+}
+
+SIMD_API void SimdRemapBilinear(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t channelCount, const int16_t * map, size_t mapStride,
+    size_t width, size_t height, SimdWarpBorderType border, const uint8_t * value, uint8_t * dst, size_t dstStride)
+{
+    typedef void(*SimdRemapBilinearPtr) (const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t channelCount, const int16_t * map, size_t mapStride,
+        size_t width, size_t height, SimdWarpBorderType border, const uint8_t * value, uint8_t * dst, size_t dstStride);
+    const static SimdRemapBilinearPtr simdRemapBilinear = SIMD_FUNC1(RemapBilinear, SIMD_AVX2_FUNC);
+
+    simdRemapBilinear(src, srcStride, srcWidth, srcHeight, channelCount, map, mapStride, width, height, border, value, dst, dstStride);
+}
+
+SIMD_API void SimdRemapBilinearYuv420p(const uint8_t * srcY, size_t srcYStride, const uint8_t * srcU, size_t srcUStride, const uint8_t * srcV, size_t srcVStride,
+    size_t srcWidth, size_t srcHeight, const int16_t * map, size_t mapStride, size_t width, size_t height, SimdWarpBorderType border, const uint8_t * value,
+    uint8_t * dstY, size_t dstYStride, uint8_t * dstU, size_t dstUStride, uint8_t * dstV, size_t dstVStride)
+{
+    typedef void(*SimdRemapBilinearYuv420pPtr) (const uint8_t * srcY, size_t srcYStride, const uint8_t * srcU, size_t srcUStride, const uint8_t * srcV, size_t srcVStride,
+        size_t srcWidth, size_t srcHeight, const int16_t * map, size_t mapStride, size_t width, size_t height, SimdWarpBorderType border, const uint8_t * value,
+        uint8_t * dstY, size_t dstYStride, uint8_t * dstU, size_t dstUStride, uint8_t * dstV, size_t dstVStride);
+    const static SimdRemapBilinearYuv420pPtr simdRemapBilinearYuv420p = SIMD_FUNC1(RemapBilinearYuv420p, SIMD_AVX2_FUNC);
+
+    simdRemapBilinearYuv420p(srcY, srcYStride, srcU, srcUStride, srcV, srcVStride, srcWidth, srcHeight, map, mapStride, width, height, border, value,
+        dstY, dstYStride, dstU, dstUStride, dstV, dstVStride);
+}
+
 SIMD_API void SimdRgbToBgra(const uint8_t* rgb, size_t width, size_t height, size_t rgbStride, uint8_t* bgra, size_t bgraStride, uint8_t alpha)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -4402,6 +4581,16 @@ SIMD_API void SimdSegmentationFillSingleHoles(uint8_t * mask, size_t stride, siz
         Base::SegmentationFillSingleHoles(mask, stride, width, height, index);
 }
 
+SIMD_API size_t SimdSegmentationLabelComponents(const uint8_t * mask, size_t maskStride, size_t width, size_t height, uint8_t index, SimdConnectivityType connectivity,
+    uint32_t * labels, size_t labelsStride, SimdConnectedComponent * components, size_t capacity)
+{
+    typedef size_t(*SimdSegmentationLabelComponentsPtr) (const uint8_t * mask, size_t maskStride, size_t width, size_t height, uint8_t index, SimdConnectivityType connectivity,
+        uint32_t * labels, size_t labelsStride, SimdConnectedComponent * components, size_t capacity);
+    const static SimdSegmentationLabelComponentsPtr simdSegmentationLabelComponents = SIMD_FUNC1(SegmentationLabelComponents, SIMD_AVX2_FUNC);
+
+    return simdSegmentationLabelComponents(mask, maskStride, width, height, index, connectivity, labels, labelsStride, components, capacity);
+}
+
 SIMD_API void SimdSegmentationPropagate2x2(const uint8_t * parent, size_t parentStride, size_t width, size_t height, 
                                            uint8_t * child, size_t childStride, const uint8_t * difference, size_t differenceStride, 
                                            uint8_t currentIndex, uint8_t invalidIndex, uint8_t emptyIndex, uint8_t differenceThreshold)
@@ -5699,6 +5888,22 @@ SIMD_API void SimdSynetUnaryOperation32fLayerForward(const float* src, size_t si
     simdSynetUnaryOperation32fLayerForward(src, size, type, dst);
 }
 
+SIMD_API void SimdTemplateMatch(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const uint8_t * tmpl, size_t tmplStride,
+    size_t tmplWidth, size_t tmplHeight, SimdTemplateMatchType type, float * dst, size_t dstStride)
+{
+    typedef void(*SimdTemplateMatchPtr) (const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const uint8_t * tmpl, size_t tmplStride,
+        size_t tmplWidth, size_t tmplHeight, SimdTemplateMatchType type, float * dst, size_t dstStride);
+    const static SimdTemplateMatchPtr simdTemplateMatch = SIMD_FUNC1(TemplateMatch, SIMD_AVX2_FUNC);
+
+    simdTemplateMatch(src, srcStride, srcWidth, srcHeight, tmpl, tmplStride, tmplWidth, tmplHeight, type, dst, dstStride);
+}
+
+SIMD_API size_t SimdTemplateMatchPeaks(const float * map, size_t mapStride, size_t width, size_t height, SimdTemplateMatchType type,
+    size_t radius, SimdTemplateMatchPeak * peaks, size_t count)
+{
+    return Base::TemplateMatchPeaks(map, mapStride, width, height, type, radius, peaks, count);
+}
+
 SIMD_API void SimdTextureBoostedSaturatedGradient(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                      uint8_t saturation, uint8_t boost, uint8_t * dx, size_t dxStride, uint8_t * dy, size_t dyStride)
 {
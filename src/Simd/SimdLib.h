@@ -96,6 +96,31 @@ typedef enum
     SimdCompareLesserOrEqual,
 } SimdCompareType;
 
+/*! @ingroup segmentation
+    Describes pixel connectivity used in function ::SimdSegmentationLabelComponents.
+*/
+typedef enum
+{
+    /*! Pixels are connected with 4 neighbors (left, top, right and bottom). */
+    SimdConnectivity4,
+    /*! Pixels are connected with 8 neighbors (including diagonal ones). */
+    SimdConnectivity8,
+} SimdConnectivityType;
+
+/*! @ingroup segmentation
+    Describes statistics of connected component found by function ::SimdSegmentationLabelComponents.
+*/
+typedef struct SimdConnectedComponent
+{
+    size_t area; /*!< A number of pixels of the component. */
+    ptrdiff_t left; /*!< A left side of the component bounding box. */
+    ptrdiff_t top; /*!< A top side of the component bounding box. */
+    ptrdiff_t right; /*!< A right side of the component bounding box (exclusive). */
+    ptrdiff_t bottom; /*!< A bottom side of the component bounding box (exclusive). */
+    double x; /*!< X coordinate of the component centroid. */
+    double y; /*!< Y coordinate of the component centroid. */
+} SimdConnectedComponent;
+
 /*! @ingroup synet
     Describes type of activation function. It is used in ::SimdSynetConvolution32fInit, ::SimdSynetConvolution8iInit, ::SimdSynetDeconvolution32fInit and ::SimdSynetMergedConvolution32fInit.
 */
@@ -200,6 +225,49 @@ typedef enum
     SimdDetectionInfoCanInt16 = 8,
 } SimdDetectionInfoFlags;
 
+/*! @ingroup distance_transform
+    Describes type of distance transform in function ::SimdDistanceTransform.
+*/
+typedef enum
+{
+    /*! Exact Euclidean distance transform (Felzenszwalb-Huttenlocher algorithm). */
+    SimdDistanceEuclidean,
+    /*! Chamfer distance transform with 3x3 mask (weights 3 and 4 for straight and diagonal steps). */
+    SimdDistanceChamfer3x3,
+    /*! Chamfer distance transform with 5x5 mask (weights 5, 7 and 11 for straight, diagonal and knight steps). */
+    SimdDistanceChamfer5x5,
+} SimdDistanceType;
+
+/*! @ingroup c_types
+    Describes types of morphological operation performed by function ::SimdMorphology.
+*/
+typedef enum
+{
+    /*! Erosion: minimum of every channel over the structuring element. */
+    SimdMorphologyErode,
+    /*! Dilation: maximum of every channel over the structuring element. */
+    SimdMorphologyDilate,
+    /*! Opening: erosion followed by dilation. */
+    SimdMorphologyOpen,
+    /*! Closing: dilation followed by erosion. */
+    SimdMorphologyClose,
+    /*! Morphological gradient: difference between dilation and erosion. */
+    SimdMorphologyGradient,
+} SimdMorphologyType;
+
+/*! @ingroup object_detection
+    Describes type of non-maximum suppression in function ::SimdNonMaxSuppression32f.
+*/
+typedef enum
+{
+    /*! Hard suppression: boxes which overlap a kept box by more than the IoU threshold are removed. */
+    SimdNonMaxSuppressionHard,
+    /*! Soft suppression with linear decay: scores of boxes with IoU above the threshold are multiplied by (1 - IoU). */
+    SimdNonMaxSuppressionLinear,
+    /*! Soft suppression with Gaussian decay: scores of all boxes are multiplied by exp(-IoU*IoU/sigma). */
+    SimdNonMaxSuppressionGaussian,
+} SimdNonMaxSuppressionType;
+
 /*! @ingroup c_types
     Describes types of binary operation between two images performed by function ::SimdOperationBinary8u.
     Images must have the same format (unsigned 8-bit integer for every channel).
@@ -364,6 +432,27 @@ typedef enum
     SimdSynetUnaryOperation32fZero,
 } SimdSynetUnaryOperation32fType;
 
+/*! @ingroup correlation
+    Describes type of template matching metric in functions ::SimdTemplateMatch and ::SimdTemplateMatchPeaks.
+*/
+typedef enum
+{
+    /*! Sum of squared differences (the best match has minimal value). */
+    SimdTemplateMatchSsd,
+    /*! Normalized cross-correlation in range [-1, 1] (the best match has maximal value). */
+    SimdTemplateMatchNcc,
+} SimdTemplateMatchType;
+
+/*! @ingroup correlation
+    Describes a peak of template matching map found by function ::SimdTemplateMatchPeaks.
+*/
+typedef struct SimdTemplateMatchPeak
+{
+    ptrdiff_t x; /*!< X coordinate of the peak (left side of matched template). */
+    ptrdiff_t y; /*!< Y coordinate of the peak (top side of matched template). */
+    float value; /*!< A value of matching metric in the peak. */
+} SimdTemplateMatchPeak;
+
 /*! @ingroup synet
     Describes <a href="http://github.com/ermig1979/Synet">Synet Framework</a> 4D-tensor format type.
 */
@@ -411,6 +500,41 @@ typedef enum
     SimdTransformTransposeRotate270, /*!< Image transposed and rotated 270 degrees counterclockwise. It is equal to vertical mirroring of image. The output image has the same size as input image.*/
 } SimdTransformType;
 
+/*! @ingroup warping
+    Describes geometric transformation used in function ::SimdWarpInit.
+*/
+typedef enum
+{
+    /*! Affine transformation. The matrix has 2x3 size. */
+    SimdWarpTransformAffine,
+    /*! Perspective transformation. The matrix has 3x3 size. */
+    SimdWarpTransformPerspective,
+} SimdWarpTransformType;
+
+/*! @ingroup warping
+    Describes interpolation method used in function ::SimdWarpInit.
+*/
+typedef enum
+{
+    /*! Nearest neighbor interpolation. */
+    SimdWarpInterpNearest,
+    /*! Bilinear interpolation. */
+    SimdWarpInterpBilinear,
+} SimdWarpInterpType;
+
+/*! @ingroup warping
+    Describes processing of output points which are mapped outside of input image in function ::SimdWarpInit.
+*/
+typedef enum
+{
+    /*! Outside pixels of input image are replaced by given constant value. */
+    SimdWarpBorderConstant,
+    /*! Outside pixels of input image are replaced by nearest pixel of input image. */
+    SimdWarpBorderReplicate,
+    /*! Output points which are mapped outside of input image are not changed. */
+    SimdWarpBorderTransparent,
+} SimdWarpBorderType;
+
 /*! @ingroup synet
     \brief Callback function type "SimdGemm32fNNPtr";
 
@@ -1254,6 +1378,66 @@ extern "C"
     SIMD_API void SimdBackgroundInitMask(const uint8_t * src, size_t srcStride, size_t width, size_t height,
         uint8_t index, uint8_t value, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup background
+
+        \fn void * SimdBackgroundMixtureInit(size_t width, size_t height, size_t channels, size_t gaussians, size_t scale, float learningRate, float varianceThreshold, float backgroundRatio);
+
+        \short Creates context of Gaussian mixture background model.
+
+        Every pixel of background is described by a mixture of several Gaussians (weight, mean and common variance of all channels).
+        For every new frame and every pixel:
+        \verbatim
+        dist[j] = sum(c, (value[c] - mean[j][c])^2);
+        k = the heaviest Gaussian which satisfies: dist[k] < varianceThreshold*variance[k];
+        if(k is found)
+        {
+            background = sum(j, weight[j], weight[j] > weight[k]) < backgroundRatio*sum(j, weight[j]);
+            weight[j] += learningRate*((j == k ? 1 : 0) - weight[j]);
+            mean[k][c] += learningRate*(value[c] - mean[k][c]);
+            variance[k] += learningRate*(dist[k]/channels - variance[k]);
+        }
+        else
+        {
+            background = false;
+            weight[j] -= learningRate*weight[j];
+            the lightest Gaussian is replaced by new one: weight = learningRate, mean = value, variance = 15^2.
+        }
+        \endverbatim
+        The variance is updated with distance dist[k] to the mean before its update.
+        The model is updated in 16-bit fixed point (weights in Q15, means in Q7 and variances in Q4 format, the variance is restricted by range [4, 2047]).
+        The model is initialized by the first frame.
+
+        \param [in] width - a width of input image.
+        \param [in] height - a height of input image.
+        \param [in] channels - a channel number of input image. It can be 1 (8-bit gray) or 3 (24-bit BGR).
+        \param [in] gaussians - a number of Gaussians per pixel. It can be from 1 to 5.
+        \param [in] scale - a scale of the model: it is built for input image reduced in scale times (by averaging). It can be from 1 to 8.
+        \param [in] learningRate - a learning rate of the model. It is restricted by range (0, 1]. The typical value is 0.01.
+        \param [in] varianceThreshold - a threshold of squared Mahalanobis distance to match pixel and Gaussian. It is restricted by range (0, 16). The typical value is 6.25.
+        \param [in] backgroundRatio - a part of total weight of the heaviest Gaussians which describe background. It is restricted by range (0, 1]. The typical value is 0.7.
+        \return a pointer to background model context. On error it returns NULL.
+                This pointer is used in functions ::SimdBackgroundMixtureRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdBackgroundMixtureInit(size_t width, size_t height, size_t channels, size_t gaussians, size_t scale,
+        float learningRate, float varianceThreshold, float backgroundRatio);
+
+    /*! @ingroup background
+
+        \fn void SimdBackgroundMixtureRun(void * mixture, const uint8_t * src, size_t srcStride, uint8_t * mask, size_t maskStride);
+
+        \short Updates Gaussian mixture background model by next frame and creates foreground mask.
+
+        Bands of rows of the model are processed in several threads (see ::SimdSetThreadNumber).
+
+        \param [in, out] mixture - a context of background model. It must be created by function ::SimdBackgroundMixtureInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of next input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] mask - a pointer to pixels data of output 8-bit foreground mask (0 - background, 255 - foreground). It has the same width and height as input image.
+        \param [in] maskStride - a row size of the foreground mask.
+    */
+    SIMD_API void SimdBackgroundMixtureRun(void * mixture, const uint8_t * src, size_t srcStride, uint8_t * mask, size_t maskStride);
+
     /*! @ingroup bayer_conversion
 
         \fn void SimdBayerToBgr(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride);
@@ -1758,6 +1942,122 @@ extern "C"
         uint8_t value, size_t neighborhood, uint8_t threshold, uint8_t positive, uint8_t negative,
         uint8_t * dst, size_t dstStride, SimdCompareType compareType);
 
+    /*! @ingroup other_filter
+
+        \fn void SimdBoxFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t radiusX, size_t radiusY, uint8_t * dst, size_t dstStride);
+
+        \short Performs an averaging with rectangular window of arbitrary size.
+
+        For every point:
+        \verbatim
+        dst[x, y] = Round(sum(src[x + dx, y + dy]) / ((2*radiusX + 1)*(2*radiusY + 1)));
+        \endverbatim
+        where dx is in range [-radiusX, radiusX], dy is in range [-radiusY, radiusY]. Border pixels of the image are replicated.
+        The function uses running column sums and sliding row sums so its cost per pixel does not depend on the window size.
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+
+        \note This function has a C++ wrapper Simd::BoxFilter(const View<A>& src, size_t radiusX, size_t radiusY, View<A>& dst).
+
+        \param [in] src - a pointer to pixels data of source image.
+        \param [in] srcStride - a row size of the src image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] channelCount - a channel count.
+        \param [in] radiusX - a horizontal radius of the window.
+        \param [in] radiusY - a vertical radius of the window.
+        \param [out] dst - a pointer to pixels data of destination image.
+        \param [in] dstStride - a row size of the dst image.
+    */
+    SIMD_API void SimdBoxFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        size_t channelCount, size_t radiusX, size_t radiusY, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup other_filter
+
+        \fn void SimdBoxSum(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t radiusX, size_t radiusY, uint8_t * sum, size_t sumStride);
+
+        \short Calculates unnormalized sums of 8-bit image over rectangular window of arbitrary size.
+
+        For every point:
+        \verbatim
+        sum[x, y] = sum(src[x + dx, y + dy]);
+        \endverbatim
+        where dx is in range [-radiusX, radiusX], dy is in range [-radiusY, radiusY]. Border pixels of the image are replicated.
+        The function uses running column sums and sliding row sums so its cost per pixel does not depend on the window size.
+
+        All images must have the same width and height. Input image can have 8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA format.
+        Output image has 32-bit unsigned integer channels (its channel count is equal to the channel count of the input image).
+
+        \note This function has a C++ wrapper Simd::BoxSum(const View<A>& src, size_t radiusX, size_t radiusY, View<A>& sum).
+
+        \param [in] src - a pointer to pixels data of source image.
+        \param [in] srcStride - a row size of the src image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] channelCount - a channel count.
+        \param [in] radiusX - a horizontal radius of the window.
+        \param [in] radiusY - a vertical radius of the window.
+        \param [out] sum - a pointer to pixels data of output 32-bit integer image.
+        \param [in] sumStride - a row size of the sum image (in bytes).
+    */
+    SIMD_API void SimdBoxSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        size_t channelCount, size_t radiusX, size_t radiusY, uint8_t * sum, size_t sumStride);
+
+    /*! @ingroup other_filter
+
+        \fn void SimdBoxFilter32f(const float * src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t radiusX, size_t radiusY, float * dst, size_t dstStride, SimdBool normalize);
+
+        \short Performs box filtration of 32-bit float image with rectangular window of arbitrary size.
+
+        For every point:
+        \verbatim
+        dst[x, y] = sum(src[x + dx, y + dy]) * (normalize ? 1 / ((2*radiusX + 1)*(2*radiusY + 1)) : 1);
+        \endverbatim
+        where dx is in range [-radiusX, radiusX], dy is in range [-radiusY, radiusY]. Border pixels of the image are replicated.
+        The function uses running column sums and sliding row sums so its cost per pixel does not depend on the window size.
+
+        \note This function has a C++ wrapper Simd::BoxFilter32f(const View<A>& src, size_t radiusX, size_t radiusY, View<A>& dst, bool normalize).
+
+        \param [in] src - a pointer to input 32-bit float image.
+        \param [in] srcStride - a row size of the input image (in floats).
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] channelCount - a channel count (channels are interleaved).
+        \param [in] radiusX - a horizontal radius of the window.
+        \param [in] radiusY - a vertical radius of the window.
+        \param [out] dst - a pointer to output 32-bit float image.
+        \param [in] dstStride - a row size of the output image (in floats).
+        \param [in] normalize - a flag of normalization of the sums by the window area.
+    */
+    SIMD_API void SimdBoxFilter32f(const float * src, size_t srcStride, size_t width, size_t height, size_t channelCount,
+        size_t radiusX, size_t radiusY, float * dst, size_t dstStride, SimdBool normalize);
+
+    /*! @ingroup contour
+
+        \fn void SimdCanny(const uint8_t * src, size_t srcStride, size_t width, size_t height, int16_t lowThreshold, int16_t highThreshold, uint8_t * dst, size_t dstStride);
+
+        \short Detects edges at the image with using Canny algorithm.
+
+        Input image must has 8-bit gray format, output image must has 8-bit gray format and the same size.
+        Gradients are calculated by Sobel's filters (see ::SimdSobelDx and ::SimdSobelDy), gradient magnitude is equal to |dx| + |dy| (from 0 to 2040).
+        The algorithm performs non-maximum suppression along one of 4 gradient directions and hysteresis thresholding:
+        a point is an edge if its magnitude is greater then highThreshold or if it is greater then lowThreshold 
+        and the point is connected (8-connectivity) with other edge point. Edge points are set to 255, other points are set to 0. 
+        The image is processed by horizontal bands in several threads (see ::SimdSetThreadNumber).
+
+        \note This function has a C++ wrappers: Simd::Canny(const View<A>& src, int16_t lowThreshold, int16_t highThreshold, View<A>& dst).
+
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size of the input image.
+        \param [in] width - an image width. It must be greater then 1.
+        \param [in] height - an image height. It must be greater then 1.
+        \param [in] lowThreshold - a low threshold of hysteresis.
+        \param [in] highThreshold - a high threshold of hysteresis. It must not be less then lowThreshold.
+        \param [out] dst - a pointer to pixels data of the output image with edges.
+        \param [in] dstStride - a row size of the output image.
+    */
+    SIMD_API void SimdCanny(const uint8_t * src, size_t srcStride, size_t width, size_t height, int16_t lowThreshold, int16_t highThreshold, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup conditional
 
         \fn void SimdConditionalCount8u(const uint8_t * src, size_t stride, size_t width, size_t height, uint8_t value, SimdCompareType compareType, uint32_t * count);
@@ -2060,6 +2360,8 @@ extern "C"
 
         This function supports OpenCV HAAR and LBP cascades type.
         Tree based cascades and old cascade formats are not supported.
+        It also loads binary cascades saved with using of function ::SimdDetectionSave.
+        A binary cascade is mapped into memory (read-only), so all cascades loaded from one file share the same physical memory.
 
         \note This function is used for implementation of Simd::Detection.
 
@@ -2069,6 +2371,23 @@ extern "C"
     */
     SIMD_API void * SimdDetectionLoadA(const char * path);
 
+    /*! @ingroup object_detection
+
+        \fn SimdBool SimdDetectionSave(const void * data, const char * path);
+
+        \short Saves a classifier cascade to file in compact binary format.
+
+        The binary format stores the cascade in memory layout of current platform. It can be loaded by function ::SimdDetectionLoadA
+        much faster than original XML cascade.
+
+        \note This function is used for implementation of Simd::Detection.
+
+        \param [in] data - a pointer to cascade which was received with using of function ::SimdDetectionLoadA or ::SimdDetectionLoadStringXml.
+        \param [in] path - a path to output file.
+        \return result of the operation.
+    */
+    SIMD_API SimdBool SimdDetectionSave(const void * data, const char * path);
+
     /*! @ingroup object_detection
 
         \fn void * SimdDetectionLoadStringXml(char * xml);
@@ -2290,6 +2609,37 @@ extern "C"
     SIMD_API void SimdDetectionLbpDetect16ii(const void * hid, const uint8_t * mask, size_t maskStride,
         ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup distance_transform
+
+        \fn void SimdDistanceTransform(const uint8_t * mask, size_t maskStride, size_t width, size_t height, uint8_t index, SimdDistanceType type, uint8_t * dst, size_t dstStride, SimdPixelFormatType dstFormat);
+
+        \short Performs distance transform of 8-bit mask image.
+
+        For every pixel it calculates a distance to the nearest pixel of the mask which is equal to given index.
+        Pixels equal to the index have zero distance. If the mask has no such pixels then output is filled by FLT_MAX (or 65535).
+
+        The exact Euclidean transform is separable: the column pass is vectorized across columns and parallelized by column strips,
+        the row pass (lower envelope of parabolas) is parallelized by rows. Chamfer transforms use two raster passes
+        with vectorized processing of neighbors from previous rows. Chamfer distances are normalized by the weight of straight step.
+
+        \note This function has a C++ wrapper Simd::DistanceTransform(const View<A> & mask, uint8_t index, SimdDistanceType type, View<A> & dst).
+
+        \note Euclidean transform supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] mask - a pointer to pixels data of 8-bit gray mask image.
+        \param [in] maskStride - a row size of the mask image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] index - a mask index of pixels to measure distance from.
+        \param [in] type - a type of distance transform.
+        \param [out] dst - a pointer to pixels data of output distance image.
+        \param [in] dstStride - a row size of the output image (in bytes).
+        \param [in] dstFormat - a format of output image. It can be ::SimdPixelFormatFloat (32-bit float distance)
+            or ::SimdPixelFormatInt16 (unsigned 16-bit rounded distance, saturated to 65535).
+    */
+    SIMD_API void SimdDistanceTransform(const uint8_t * mask, size_t maskStride, size_t width, size_t height, uint8_t index, SimdDistanceType type,
+        uint8_t * dst, size_t dstStride, SimdPixelFormatType dstFormat);
+
     /*! @ingroup edge_background
 
         \fn void SimdEdgeBackgroundGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * background, size_t backgroundStride);
@@ -2902,6 +3252,8 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::Histogram(const View<A>& src, uint32_t * histogram).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] src - a pointer to pixels data of input 8-bit gray image.
         \param [in] width - an image width.
         \param [in] height - an image height.
@@ -2924,6 +3276,8 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::HistogramMasked(const View<A> & src, const View<A> & mask, uint8_t index, uint32_t * histogram).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [in] src - a pointer to pixels data of input 8-bit gray image.
         \param [in] srcStride - a row size of the image.
         \param [in] width - an image width.
@@ -3019,6 +3373,35 @@ extern "C"
     */
     SIMD_API void SimdNormalizeHistogram(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup histogram
+
+        \fn void SimdClahe(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t tilesX, size_t tilesY, float clipLimit, uint8_t * dst, size_t dstStride);
+
+        \short Performs contrast limited adaptive histogram equalization (CLAHE) for 8-bit gray image.
+
+        The image is divided into tilesX x tilesY tiles. For every tile a clipped histogram is computed and normalized
+        (the excess over clip limit is redistributed among all bins). The output pixel value is a bilinear interpolation
+        of the mapped values of the four nearest tile centers.
+
+        The input and output 8-bit gray images must have the same size.
+
+        \note This function has a C++ wrapper Simd::Clahe(const View<A> & src, View<A> & dst, size_t tilesX, size_t tilesY, float clipLimit).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] src - a pointer to pixels data of input 8-bit gray image.
+        \param [in] srcStride - a row size of the image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] tilesX - a number of tiles in horizontal direction. It must be in range [1, width].
+        \param [in] tilesY - a number of tiles in vertical direction. It must be in range [1, height].
+        \param [in] clipLimit - a relative clip limit of tile histogram (clip = clipLimit * tileArea / 256).
+            Zero or negative value disables clipping (ordinary adaptive histogram equalization).
+        \param [out] dst - a pointer to pixels data of output 8-bit gray image.
+        \param [in] dstStride - a row size of the output image.
+    */
+    SIMD_API void SimdClahe(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t tilesX, size_t tilesY, float clipLimit, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup hog
 
         \fn void SimdHogDirectionHistograms(const uint8_t * src, size_t stride, size_t width, size_t height, size_t cellX, size_t cellY, size_t quantization, float * histograms);
@@ -3346,17 +3729,47 @@ extern "C"
         \param [in] height - an image height.
         \param [out] sum - a pointer to pixels data of 32-bit integer sum image.
         \param [in] sumStride - a row size of sum image (in bytes).
-        \param [out] sqsum - a pointer to pixels data of 32-bit integer or 64-bit float point square sum image. It can be NULL.
+        \param [out] sqsum - a pointer to pixels data of 32-bit integer, 64-bit integer or 64-bit float point square sum image. It can be NULL.
         \param [in] sqsumStride - a row size of sqsum image (in bytes).
         \param [out] tilted - a pointer to pixels data of 32-bit integer tilted sum image. It can be NULL.
         \param [in] tiltedStride - a row size of tilted image (in bytes).
         \param [in] sumFormat - a format of sum image and tilted image. It can be equal to ::SimdPixelFormatInt32.
-        \param [in] sqsumFormat - a format of sqsum image. It can be equal to ::SimdPixelFormatInt32 or ::SimdPixelFormatDouble.
+        \param [in] sqsumFormat - a format of sqsum image. It can be equal to ::SimdPixelFormatInt32, ::SimdPixelFormatInt64 or ::SimdPixelFormatDouble.
+            Use ::SimdPixelFormatInt64 or ::SimdPixelFormatDouble for large images (32-bit square sum overflows for images greater than 256x256).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber) if tilted image is not used.
     */
     SIMD_API void SimdIntegral(const uint8_t * src, size_t srcStride, size_t width, size_t height,
         uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride,
         SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat);
 
+    /*! @ingroup integral
+
+        \fn void SimdIntegral32f(const float * src, size_t srcStride, size_t width, size_t height, double * sum, size_t sumStride, double * sqsum, size_t sqsumStride);
+
+        \short Calculates integral images for input 32-bit float image (feature map).
+
+        The function calculates sum integral image and square sum integral image (optionally).
+        A integral images must have width and height per unit greater than that of the input image.
+
+        \note This function has a C++ wrappers:
+        \n Simd::Integral(const View<A>& src, View<A>& sum),
+        \n Simd::Integral(const View<A>& src, View<A>& sum, View<A>& sqsum).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] src - a pointer to pixels data of input 32-bit float image.
+        \param [in] srcStride - a row size of src image (in floats).
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] sum - a pointer to pixels data of 64-bit float point sum image.
+        \param [in] sumStride - a row size of sum image (in doubles).
+        \param [out] sqsum - a pointer to pixels data of 64-bit float point square sum image. It can be NULL.
+        \param [in] sqsumStride - a row size of sqsum image (in doubles).
+    */
+    SIMD_API void SimdIntegral32f(const float * src, size_t srcStride, size_t width, size_t height, 
+        double * sum, size_t sumStride, double * sqsum, size_t sqsumStride);
+
     /*! @ingroup interference
 
         \fn void SimdInterferenceIncrement(uint8_t * statistic, size_t stride, size_t width, size_t height, uint8_t increment, int16_t saturation);
@@ -3636,6 +4049,46 @@ extern "C"
     */
     SIMD_API void SimdLbpEstimate(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup optical_flow
+
+        \fn void SimdLucasKanadeTrack(const uint8_t * prev, size_t prevStride, const uint8_t * next, size_t nextStride, size_t width, size_t height, const float * prevPoints, float * nextPoints, size_t count, size_t window, size_t iterations, float epsilon, float minEigen, uint8_t * status, float * errors);
+
+        \short Tracks sparse points between two 8-bit gray images with iterative Lucas-Kanade method (one pyramid level).
+
+        For every point the window around its position in the previous image is sampled with bilinear interpolation, 
+        its gradients and 2x2 gradient matrix G are estimated. Then the position in the next image is refined iteratively:
+        \verbatim
+        b = SUM((J(x + v) - I(x))*[Ix, Iy]);
+        v = v - inverse(G)*b;
+        \endverbatim
+        until the shift becomes less than epsilon or the number of iterations is reached.
+        Points are processed in parallel.
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \note This function has a C++ wrapper Simd::LucasKanadeTrack(const Pyramid<A> & prev, const Pyramid<A> & next, const std::vector<Point<float>> & prevPoints, std::vector<Point<float>> & nextPoints, std::vector<uint8_t> & status, std::vector<float> * errors, size_t window, size_t iterations, float epsilon, float minEigen) 
+            which tracks points across all levels of image pyramids.
+
+        \param [in] prev - a pointer to pixels data of previous 8-bit gray image.
+        \param [in] prevStride - a row size of the previous image.
+        \param [in] next - a pointer to pixels data of next 8-bit gray image.
+        \param [in] nextStride - a row size of the next image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] prevPoints - a pointer to array with coordinates (x, y pairs) of points in the previous image.
+        \param [in, out] nextPoints - a pointer to array with coordinates (x, y pairs) of points in the next image. It contains the initial estimations on input and refined positions on output.
+        \param [in] count - a number of points.
+        \param [in] window - a size of the tracking window. It must be odd and lie in range [3, 63].
+        \param [in] iterations - a maximal number of iterations.
+        \param [in] epsilon - a minimal shift of point to continue iterations.
+        \param [in] minEigen - a minimal eigen value of normalized (divided by window area) gradient matrix. Points in flat areas are rejected.
+        \param [in, out] status - a pointer to array with statuses of points. Points with zero status are skipped. Status of lost points is set to zero.
+        \param [out] errors - a pointer to array with mean absolute differences between windows in previous and next images. It can be NULL.
+    */
+    SIMD_API void SimdLucasKanadeTrack(const uint8_t * prev, size_t prevStride, const uint8_t * next, size_t nextStride, size_t width, size_t height,
+        const float * prevPoints, float * nextPoints, size_t count, size_t window, size_t iterations, float epsilon, float minEigen,
+        uint8_t * status, float * errors);
+
     /*! @ingroup other_filter
 
         \fn void SimdMeanFilter3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
@@ -3748,6 +4201,57 @@ extern "C"
     SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height,
         size_t channelCount, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup median_filter
+
+        \fn void SimdMedianFilterSquare(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t radius, uint8_t * dst, size_t dstStride);
+
+        \short Performs median filtration of input image (filter window is a square (2*radius + 1)x(2*radius + 1)).
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+        Image borders are replicated. The filter uses running histograms of image columns (Perreault-Hebert algorithm), 
+        so its execution time doesn't depend on window size. 
+
+        \note This function has a C++ wrappers: Simd::MedianFilterSquare(const View<A>& src, size_t radius, View<A>& dst).
+
+        \param [in] src - a pointer to pixels data of original input image.
+        \param [in] srcStride - a row size of src image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] channelCount - a channel count.
+        \param [in] radius - a radius of filter window. It must be less than 128.
+        \param [out] dst - a pointer to pixels data of filtered output image.
+        \param [in] dstStride - a row size of dst image.
+    */
+    SIMD_API void SimdMedianFilterSquare(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        size_t channelCount, size_t radius, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup morphology_filter
+
+        \fn void SimdMorphology(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t radiusX, size_t radiusY, SimdMorphologyType type, uint8_t * dst, size_t dstStride);
+
+        \short Performs morphological operation with rectangular structuring element of size (2*radiusX + 1)x(2*radiusY + 1).
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+        Image borders are replicated. Erosion and dilation use van Herk/Gil-Werman algorithm, 
+        so their execution time doesn't depend on the size of structuring element. 
+        Input and output image can be the same image (in-place mode).
+
+        \note This function has a C++ wrappers: Simd::Morphology(const View<A>& src, size_t radiusX, size_t radiusY, SimdMorphologyType type, View<A>& dst).
+
+        \param [in] src - a pointer to pixels data of original input image.
+        \param [in] srcStride - a row size of src image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] channelCount - a channel count.
+        \param [in] radiusX - a horizontal radius of structuring element.
+        \param [in] radiusY - a vertical radius of structuring element.
+        \param [in] type - a type of morphological operation.
+        \param [out] dst - a pointer to pixels data of output image.
+        \param [in] dstStride - a row size of dst image.
+    */
+    SIMD_API void SimdMorphology(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount,
+        size_t radiusX, size_t radiusY, SimdMorphologyType type, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup neural
 
         \fn void SimdNeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion);
@@ -4392,6 +4896,35 @@ extern "C"
     */
     SIMD_API void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, size_t srcHeight, size_t srcDepth, const float * weight, size_t kernelX, size_t kernelY, size_t padX, size_t padY, size_t strideX, size_t strideY, size_t dilationX, size_t dilationY, void * buffer, size_t * size, float * dst, size_t dstWidth, size_t dstHeight, size_t dstDepth, int add);
 
+    /*! @ingroup object_detection
+
+        \fn size_t SimdNonMaxSuppression32f(const float * boxes, float * scores, size_t count, SimdNonMaxSuppressionType type, float iouThreshold, float sigma, float scoreThreshold, size_t * indices);
+
+        \short Performs non-maximum suppression (hard or soft) of scored boxes.
+
+        Boxes with score less than scoreThreshold are rejected at once. Then the box with the greatest score is kept
+        and the intersection over union (IoU) between it and all remaining boxes is computed in one batch.
+        Hard suppression removes boxes with IoU greater than iouThreshold, soft suppression decays their scores
+        (see ::SimdNonMaxSuppressionType) and removes boxes whose scores fall below scoreThreshold. The step is repeated until no boxes remain.
+
+        \note This function is not tied to Simd::Detection: it can be used to filter outputs of any detector (for example, of neural networks).
+
+        \note This function has a C++ wrapper Simd::NonMaxSuppression(const std::vector<Rectangle<float>> & boxes, std::vector<float> & scores, std::vector<size_t> & indices, SimdNonMaxSuppressionType type, float iouThreshold, float sigma, float scoreThreshold).
+
+        \param [in] boxes - a pointer to array of boxes. Every box is given by 4 values: left, top, right and bottom.
+        \param [in, out] scores - a pointer to array of box scores. On output scores of removed boxes are set to zero, 
+            scores of kept boxes contain their values at the moment of selection (it differs from input in case of soft suppression).
+        \param [in] count - a number of boxes.
+        \param [in] type - a type of suppression.
+        \param [in] iouThreshold - an IoU threshold. It is not used by Gaussian suppression.
+        \param [in] sigma - a parameter of Gaussian suppression. It must be positive.
+        \param [in] scoreThreshold - a minimal score of kept boxes.
+        \param [out] indices - a pointer to array of indices of kept boxes in the order of selection. Its size must be at least count.
+        \return a number of kept boxes.
+    */
+    SIMD_API size_t SimdNonMaxSuppression32f(const float * boxes, float * scores, size_t count, SimdNonMaxSuppressionType type,
+        float iouThreshold, float sigma, float scoreThreshold, size_t * indices);
+
     /*! @ingroup operation
 
         \fn void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type);
@@ -4735,6 +5268,163 @@ extern "C"
     */
     SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup warping
+
+        \fn void * SimdWarpInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, const float * mat, SimdWarpTransformType transform, SimdWarpInterpType interp, SimdWarpBorderType border, const uint8_t * value);
+
+        \short Creates context of affine or perspective image warping.
+
+        The matrix maps coordinates of output image to coordinates of input image:
+        \verbatim
+        affine:
+        sx = mat[0]*dx + mat[1]*dy + mat[2];
+        sy = mat[3]*dx + mat[4]*dy + mat[5];
+
+        perspective:
+        sw = mat[6]*dx + mat[7]*dy + mat[8];
+        sx = (mat[0]*dx + mat[1]*dy + mat[2])/sw;
+        sy = (mat[3]*dx + mat[4]*dy + mat[5])/sw;
+        \endverbatim
+        Bilinear interpolation uses fixed-point weights with 1/256 pixel precision.
+
+        \note This function has a C++ wrappers: Simd::WarpAffine(const View<A> & src, const float * mat, View<A> & dst, SimdWarpInterpType interp, SimdWarpBorderType border, const uint8_t * value), 
+            Simd::WarpPerspective(const View<A> & src, const float * mat, View<A> & dst, SimdWarpInterpType interp, SimdWarpBorderType border, const uint8_t * value).
+
+        \param [in] srcW - a width of the input image.
+        \param [in] srcH - a height of the input image.
+        \param [in] dstW - a width of the output image.
+        \param [in] dstH - a height of the output image.
+        \param [in] channels - a channel number of input and output image. It can be from 1 to 4.
+        \param [in] type - a type of input and output image channel.
+        \param [in] mat - a pointer to transformation matrix (2x3 for affine and 3x3 for perspective transformation).
+        \param [in] transform - a type of transformation.
+        \param [in] interp - an interpolation method.
+        \param [in] border - a type of border processing.
+        \param [in] value - a pointer to border pixel value (it is used for ::SimdWarpBorderConstant). It can be NULL (zero value).
+        \return a pointer to warp context. On error it returns NULL.
+                This pointer is used in functions ::SimdWarpRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdWarpInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, 
+        const float * mat, SimdWarpTransformType transform, SimdWarpInterpType interp, SimdWarpBorderType border, const uint8_t * value);
+
+    /*! @ingroup warping
+
+        \fn void SimdWarpRun(const void * warp, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        \short Performs affine or perspective image warping.
+
+        Output image is processed by bands of rows in several threads (see ::SimdSetThreadNumber).
+
+        \param [in] warp - a warp context. It must be created by function ::SimdWarpInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] dst - a pointer to pixels data of the output image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdWarpRun(const void * warp, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup warping
+
+        \fn void SimdRemapConvertMap(const float * mapX, size_t mapXStride, const float * mapY, size_t mapYStride, size_t width, size_t height, size_t srcWidth, size_t srcHeight, int16_t * map, size_t mapStride);
+
+        \short Converts floating point remap tables to compact fixed-point map used in functions ::SimdRemapBilinear and ::SimdRemapBilinearYuv420p.
+
+        Every row of output map contains three arrays of width 16-bit values (6 bytes per point):
+        \verbatim
+        map[y][x] = floor(mapX[y][x]);
+        map[y][width + x] = floor(mapY[y][x]);
+        map[y][2*width + x] = fx | (fy << 8);
+        \endverbatim
+        where integer coordinates are signed and restricted to range [-2, srcWidth + 1] and [-2, srcHeight + 1],
+        fx and fy are unsigned 8-bit fractional parts of x- and y-coordinates. The input image size must be less than 32767.
+        The map has to be built once and can be reused for every frame.
+
+        \note This function has a C++ wrappers: Simd::RemapConvertMap(const View<A> & mapX, const View<A> & mapY, size_t srcWidth, size_t srcHeight, View<A> & map).
+
+        \param [in] mapX - a pointer to table of x-coordinates (32-bit float) of input image points.
+        \param [in] mapXStride - a row size (in bytes) of x-coordinates table.
+        \param [in] mapY - a pointer to table of y-coordinates (32-bit float) of input image points.
+        \param [in] mapYStride - a row size (in bytes) of y-coordinates table.
+        \param [in] width - a width of the tables (and output image).
+        \param [in] height - a height of the tables (and output image).
+        \param [in] srcWidth - a width of the input image.
+        \param [in] srcHeight - a height of the input image.
+        \param [out] map - a pointer to output fixed-point map. Its row size must be at least 3*width 16-bit integers.
+        \param [in] mapStride - a row size (in bytes) of the output map.
+    */
+    SIMD_API void SimdRemapConvertMap(const float * mapX, size_t mapXStride, const float * mapY, size_t mapYStride, size_t width, size_t height,
+        size_t srcWidth, size_t srcHeight, int16_t * map, size_t mapStride);
+
+    /*! @ingroup warping
+
+        \fn void SimdRemapBilinear(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t channelCount, const int16_t * map, size_t mapStride, size_t width, size_t height, SimdWarpBorderType border, const uint8_t * value, uint8_t * dst, size_t dstStride);
+
+        \short Performs remapping of image with using bilinear interpolation and precomputed fixed-point map.
+
+        For every point of output image:
+        \verbatim
+        dst[x, y] = Bilinear(src, map[y][x], map[y][width + x], map[y][2*width + x]);
+        \endverbatim
+        The map must be created by function ::SimdRemapConvertMap.
+        Output image is processed by bands of rows in several threads (see ::SimdSetThreadNumber).
+
+        \note This function has a C++ wrappers: Simd::RemapBilinear(const View<A> & src, const View<A> & map, View<A> & dst, SimdWarpBorderType border, const uint8_t * value),
+            Simd::RemapBilinear(const Frame<A> & src, const View<A> & map, Frame<A> & dst, SimdWarpBorderType border, const uint8_t * value).
+
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [in] srcWidth - a width of the input image.
+        \param [in] srcHeight - a height of the input image.
+        \param [in] channelCount - a channel count (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA image). It can be from 1 to 4.
+        \param [in] map - a pointer to fixed-point map.
+        \param [in] mapStride - a row size (in bytes) of the map.
+        \param [in] width - a width of the output image.
+        \param [in] height - a height of the output image.
+        \param [in] border - a type of border processing.
+        \param [in] value - a pointer to border pixel value (it is used for ::SimdWarpBorderConstant). It can be NULL (zero value).
+        \param [out] dst - a pointer to pixels data of the output image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdRemapBilinear(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t channelCount, const int16_t * map, size_t mapStride,
+        size_t width, size_t height, SimdWarpBorderType border, const uint8_t * value, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup warping
+
+        \fn void SimdRemapBilinearYuv420p(const uint8_t * srcY, size_t srcYStride, const uint8_t * srcU, size_t srcUStride, const uint8_t * srcV, size_t srcVStride, size_t srcWidth, size_t srcHeight, const int16_t * map, size_t mapStride, size_t width, size_t height, SimdWarpBorderType border, const uint8_t * value, uint8_t * dstY, size_t dstYStride, uint8_t * dstU, size_t dstUStride, uint8_t * dstV, size_t dstVStride);
+
+        \short Performs remapping of YUV420P image with using bilinear interpolation and precomputed fixed-point map.
+
+        The map is given for Y plane. Coordinates for U and V planes are estimated from the map on the fly (average of 2x2 block).
+        The map must be created by function ::SimdRemapConvertMap. All image sizes must be even.
+
+        \note This function has a C++ wrappers: Simd::RemapBilinear(const Frame<A> & src, const View<A> & map, Frame<A> & dst, SimdWarpBorderType border, const uint8_t * value).
+
+        \param [in] srcY - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] srcYStride - a row size of the Y plane of input image.
+        \param [in] srcU - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] srcUStride - a row size of the U plane of input image.
+        \param [in] srcV - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] srcVStride - a row size of the V plane of input image.
+        \param [in] srcWidth - a width of the input image.
+        \param [in] srcHeight - a height of the input image.
+        \param [in] map - a pointer to fixed-point map.
+        \param [in] mapStride - a row size (in bytes) of the map.
+        \param [in] width - a width of the output image.
+        \param [in] height - a height of the output image.
+        \param [in] border - a type of border processing.
+        \param [in] value - a pointer to border Y, U, V values (it is used for ::SimdWarpBorderConstant). It can be NULL (zero values).
+        \param [out] dstY - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] dstYStride - a row size of the Y plane of output image.
+        \param [out] dstU - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] dstUStride - a row size of the U plane of output image.
+        \param [out] dstV - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] dstVStride - a row size of the V plane of output image.
+    */
+    SIMD_API void SimdRemapBilinearYuv420p(const uint8_t * srcY, size_t srcYStride, const uint8_t * srcU, size_t srcUStride, const uint8_t * srcV, size_t srcVStride,
+        size_t srcWidth, size_t srcHeight, const int16_t * map, size_t mapStride, size_t width, size_t height, SimdWarpBorderType border, const uint8_t * value,
+        uint8_t * dstY, size_t dstYStride, uint8_t * dstU, size_t dstUStride, uint8_t * dstV, size_t dstVStride);
+
     /*! @ingroup rgb_conversion
 
         \fn void SimdRgbToBgra(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
@@ -4817,6 +5507,38 @@ extern "C"
     */
     SIMD_API void SimdSegmentationFillSingleHoles(uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index);
 
+    /*! @ingroup segmentation
+
+        \fn size_t SimdSegmentationLabelComponents(const uint8_t * mask, size_t maskStride, size_t width, size_t height, uint8_t index, SimdConnectivityType connectivity, uint32_t * labels, size_t labelsStride, SimdConnectedComponent * components, size_t capacity);
+
+        \short Performs connected components labeling of mask image.
+
+        Finds connected components of the mask pixels which are equal to given index. Components are numbered from 1
+        in the raster order of their first pixel. Optionally it fills output labels image (0 for background pixels)
+        and statistics (area, bounding box and centroid) of every component. All is made in one pass over the mask.
+
+        Mask must has 8-bit gray pixel format.
+
+        \note This function has a C++ wrapper Simd::SegmentationLabelComponents(const View<A> & mask, uint8_t index, SimdConnectivityType connectivity, View<A> & labels, std::vector<SimdConnectedComponent> & components).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+            The mask is split into row bands which are labeled in parallel and their labels are merged across band borders.
+
+        \param [in] mask - a pointer to pixels data of 8-bit gray mask image.
+        \param [in] maskStride - a row size of the mask image.
+        \param [in] width - a mask width.
+        \param [in] height - a mask height.
+        \param [in] index - a mask index of foreground pixels.
+        \param [in] connectivity - a pixel connectivity (4 or 8).
+        \param [out] labels - a pointer to output 32-bit labels image. It can be NULL.
+        \param [in] labelsStride - a row size of the labels image (in 32-bit values).
+        \param [out] components - a pointer to output array with statistics of components. It can be NULL.
+        \param [in] capacity - a size of the components array. Only first capacity components are written.
+        \return a total number of connected components (it can be greater than capacity).
+    */
+    SIMD_API size_t SimdSegmentationLabelComponents(const uint8_t * mask, size_t maskStride, size_t width, size_t height, uint8_t index, SimdConnectivityType connectivity,
+        uint32_t * labels, size_t labelsStride, SimdConnectedComponent * components, size_t capacity);
+
     /*! @ingroup segmentation
 
         \fn void SimdSegmentationPropagate2x2(const uint8_t * parent, size_t parentStride, size_t width, size_t height, uint8_t * child, size_t childStride, const uint8_t * difference, size_t differenceStride, uint8_t currentIndex, uint8_t invalidIndex, uint8_t emptyIndex, uint8_t differenceThreshold);
@@ -6730,6 +7452,64 @@ extern "C"
     */
     SIMD_API void SimdSynetUnaryOperation32fLayerForward(const float * src, size_t size, SimdSynetUnaryOperation32fType type, float * dst);
 
+    /*! @ingroup correlation
+
+        \fn void SimdTemplateMatch(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const uint8_t * tmpl, size_t tmplStride, size_t tmplWidth, size_t tmplHeight, SimdTemplateMatchType type, float * dst, size_t dstStride);
+
+        \short Matches template over search region of 8-bit gray image.
+
+        For every position of template inside of search region it calculates a matching metric:
+        \verbatim
+        SSD: dst[x, y] = sum((src[x + i, y + j] - tmpl[i, j])^2);
+        NCC: dst[x, y] = sum((src[x + i, y + j] - srcMean)*(tmpl[i, j] - tmplMean))/sqrt(srcDev*tmplDev);
+        \endverbatim
+        The sums and square sums of source windows are taken from integral images. The dot products of template
+        and source windows are calculated with using SIMD for 16 positions at once. If a source window or template is
+        uniform then NCC is equal to 0.
+
+        \note This function has a C++ wrapper Simd::TemplateMatch(const View<A> & src, const View<A> & tmpl, SimdTemplateMatchType type, View<A> & dst).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] src - a pointer to pixels data of 8-bit gray search region.
+        \param [in] srcStride - a row size of the search region.
+        \param [in] srcWidth - a width of the search region.
+        \param [in] srcHeight - a height of the search region.
+        \param [in] tmpl - a pointer to pixels data of 8-bit gray template.
+        \param [in] tmplStride - a row size of the template.
+        \param [in] tmplWidth - a width of the template. It must be not greater than srcWidth.
+        \param [in] tmplHeight - a height of the template. It must be not greater than srcHeight. Template area must be not greater than 32768.
+        \param [in] type - a type of matching metric.
+        \param [out] dst - a pointer to output 32-bit float matching map. Its size is (srcWidth - tmplWidth + 1)x(srcHeight - tmplHeight + 1).
+        \param [in] dstStride - a row size of the output map (in 32-bit float values).
+    */
+    SIMD_API void SimdTemplateMatch(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const uint8_t * tmpl, size_t tmplStride,
+        size_t tmplWidth, size_t tmplHeight, SimdTemplateMatchType type, float * dst, size_t dstStride);
+
+    /*! @ingroup correlation
+
+        \fn size_t SimdTemplateMatchPeaks(const float * map, size_t mapStride, size_t width, size_t height, SimdTemplateMatchType type, size_t radius, SimdTemplateMatchPeak * peaks, size_t count);
+
+        \short Finds the best peaks of template matching map.
+
+        It finds local extremums (minimums for SSD and maximums for NCC) of the map, sorts them from the best to the worst
+        and greedy suppresses peaks which are closer than radius (in Chebyshev metric) to better ones.
+
+        \note This function has a C++ wrapper Simd::TemplateMatchPeaks(const View<A> & map, SimdTemplateMatchType type, size_t radius, size_t count, std::vector<SimdTemplateMatchPeak> & peaks).
+
+        \param [in] map - a pointer to 32-bit float matching map (output of function ::SimdTemplateMatch).
+        \param [in] mapStride - a row size of the map (in 32-bit float values).
+        \param [in] width - a width of the map.
+        \param [in] height - a height of the map.
+        \param [in] type - a type of matching metric.
+        \param [in] radius - a radius of non-maximum suppression.
+        \param [out] peaks - a pointer to output array of peaks.
+        \param [in] count - a maximal number of peaks (size of the peaks array).
+        \return a number of found peaks.
+    */
+    SIMD_API size_t SimdTemplateMatchPeaks(const float * map, size_t mapStride, size_t width, size_t height, SimdTemplateMatchType type, 
+        size_t radius, SimdTemplateMatchPeak * peaks, size_t count);
+
     /*! @ingroup texture_estimation
 
         \fn void SimdTextureBoostedSaturatedGradient(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t saturation, uint8_t boost, uint8_t * dx, size_t dxStride, uint8_t * dy, size_t dyStride);
@@ -6853,7 +7633,10 @@ extern "C"
 
         \short Performs transformation of input image. The type of transformation is defined by ::SimdTransformType enumeration.
 
-        \note This function has a C++ wrappers: Simd::TransformImage(const View<A> & src, ::SimdTransformType transform, View<A> & dst).
+        \note This function has a C++ wrappers: Simd::TransformImage(const View<A> & src, ::SimdTransformType transform, View<A> & dst), 
+            Simd::TransformImage(const Frame<A> & src, ::SimdTransformType transform, Frame<A> & dst).
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
 
         \param [in] src - a pointer to pixels data of input image.
         \param [in] srcStride - a row size of input image.
@@ -27,6 +27,7 @@
 #include "Simd/SimdView.hpp"
 #include "Simd/SimdPixel.hpp"
 #include "Simd/SimdPyramid.hpp"
+#include "Simd/SimdParallel.hpp"
 
 #ifndef __SimdLib_hpp__
 #define __SimdLib_hpp__
@@ -582,6 +583,53 @@ namespace Simd
         SimdBackgroundInitMask(src.data, src.stride, src.width, src.height, index, value, dst.data, dst.stride);
     }
 
+    /*! @ingroup background
+
+        \fn void * BackgroundMixtureInit(const View<A> & src, size_t gaussians, size_t scale, float learningRate, float varianceThreshold, float backgroundRatio);
+
+        \short Creates context of Gaussian mixture background model for images with the same size and format as given image.
+
+        The input image must be 8-bit gray or 24-bit BGR.
+
+        \note This function is a C++ wrapper for function ::SimdBackgroundMixtureInit.
+
+        \param [in] src - an input image which defines size and format of the model.
+        \param [in] gaussians - a number of Gaussians per pixel. It can be from 1 to 5.
+        \param [in] scale - a scale of the model: it is built for input image reduced in scale times (by averaging). It can be from 1 to 8.
+        \param [in] learningRate - a learning rate of the model. It is restricted by range (0, 1]. The typical value is 0.01.
+        \param [in] varianceThreshold - a threshold of squared Mahalanobis distance to match pixel and Gaussian. It is restricted by range (0, 16). The typical value is 6.25.
+        \param [in] backgroundRatio - a part of total weight of the heaviest Gaussians which describe background. It is restricted by range (0, 1]. The typical value is 0.7.
+        \return a pointer to background model context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+    */
+    template<template<class> class A> SIMD_INLINE void * BackgroundMixtureInit(const View<A> & src, size_t gaussians, size_t scale,
+        float learningRate, float varianceThreshold, float backgroundRatio)
+    {
+        assert(src.format == View<A>::Gray8 || src.format == View<A>::Bgr24);
+
+        return SimdBackgroundMixtureInit(src.width, src.height, src.ChannelCount(), gaussians, scale, learningRate, varianceThreshold, backgroundRatio);
+    }
+
+    /*! @ingroup background
+
+        \fn void BackgroundMixtureRun(void * mixture, const View<A> & src, View<A> & mask);
+
+        \short Updates Gaussian mixture background model by next frame and creates foreground mask.
+
+        The input image must have the size and format given at creation of the model. The mask must have the same size and 8-bit gray format.
+
+        \note This function is a C++ wrapper for function ::SimdBackgroundMixtureRun.
+
+        \param [in, out] mixture - a context of background model. It must be created by function Simd::BackgroundMixtureInit and released by function ::SimdRelease.
+        \param [in] src - a next input image.
+        \param [out] mask - an output foreground mask (0 - background, 255 - foreground).
+    */
+    template<template<class> class A> SIMD_INLINE void BackgroundMixtureRun(void * mixture, const View<A> & src, View<A> & mask)
+    {
+        assert(mixture && EqualSize(src, mask) && (src.format == View<A>::Gray8 || src.format == View<A>::Bgr24) && mask.format == View<A>::Gray8);
+
+        SimdBackgroundMixtureRun(mixture, src.data, src.stride, mask.data, mask.stride);
+    }
+
     /*! @ingroup bayer_conversion
 
         \fn void BayerToBgr(const View<A>& bayer, View<A>& bgr);
@@ -1107,6 +1155,114 @@ namespace Simd
             neighborhood, threshold, positive, negative, dst.data, dst.stride, compareType);
     }
 
+    /*! @ingroup other_filter
+
+        \fn void BoxFilter(const View<A>& src, size_t radiusX, size_t radiusY, View<A>& dst)
+
+        \short Performs an averaging with rectangular window of arbitrary size.
+
+        For every point:
+        \verbatim
+        dst[x, y] = Round(sum(src[x + dx, y + dy]) / ((2*radiusX + 1)*(2*radiusY + 1)));
+        \endverbatim
+        where dx is in range [-radiusX, radiusX], dy is in range [-radiusY, radiusY]. Border pixels of the image are replicated.
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+
+        \note This function is a C++ wrapper for function ::SimdBoxFilter.
+
+        \param [in] src - a source image.
+        \param [in] radiusX - a horizontal radius of the window.
+        \param [in] radiusY - a vertical radius of the window.
+        \param [out] dst - a destination image.
+    */
+    template<template<class> class A> SIMD_INLINE void BoxFilter(const View<A>& src, size_t radiusX, size_t radiusY, View<A>& dst)
+    {
+        assert(Compatible(src, dst) && src.ChannelSize() == 1);
+
+        SimdBoxFilter(src.data, src.stride, src.width, src.height, src.ChannelCount(), radiusX, radiusY, dst.data, dst.stride);
+    }
+
+    /*! @ingroup other_filter
+
+        \fn void BoxSum(const View<A>& src, size_t radiusX, size_t radiusY, View<A>& sum)
+
+        \short Calculates unnormalized sums of 8-bit gray image over rectangular window of arbitrary size.
+
+        For every point:
+        \verbatim
+        sum[x, y] = sum(src[x + dx, y + dy]);
+        \endverbatim
+        where dx is in range [-radiusX, radiusX], dy is in range [-radiusY, radiusY]. Border pixels of the image are replicated.
+
+        All images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdBoxSum.
+
+        \param [in] src - an input 8-bit gray image.
+        \param [in] radiusX - a horizontal radius of the window.
+        \param [in] radiusY - a vertical radius of the window.
+        \param [out] sum - an output 32-bit integer image with sums.
+    */
+    template<template<class> class A> SIMD_INLINE void BoxSum(const View<A>& src, size_t radiusX, size_t radiusY, View<A>& sum)
+    {
+        assert(EqualSize(src, sum) && src.format == View<A>::Gray8 && sum.format == View<A>::Int32);
+
+        SimdBoxSum(src.data, src.stride, src.width, src.height, 1, radiusX, radiusY, sum.data, sum.stride);
+    }
+
+    /*! @ingroup other_filter
+
+        \fn void BoxFilter32f(const View<A>& src, size_t radiusX, size_t radiusY, View<A>& dst, bool normalize = true)
+
+        \short Performs box filtration of 32-bit float image with rectangular window of arbitrary size.
+
+        For every point:
+        \verbatim
+        dst[x, y] = sum(src[x + dx, y + dy]) * (normalize ? 1 / ((2*radiusX + 1)*(2*radiusY + 1)) : 1);
+        \endverbatim
+        where dx is in range [-radiusX, radiusX], dy is in range [-radiusY, radiusY]. Border pixels of the image are replicated.
+
+        All images must have the same width, height and format (32-bit float).
+
+        \note This function is a C++ wrapper for function ::SimdBoxFilter32f.
+
+        \param [in] src - an input 32-bit float image.
+        \param [in] radiusX - a horizontal radius of the window.
+        \param [in] radiusY - a vertical radius of the window.
+        \param [out] dst - an output 32-bit float image.
+        \param [in] normalize - a flag of normalization of the sums by the window area. By default it is true.
+    */
+    template<template<class> class A> SIMD_INLINE void BoxFilter32f(const View<A>& src, size_t radiusX, size_t radiusY, View<A>& dst, bool normalize = true)
+    {
+        assert(Compatible(src, dst) && src.format == View<A>::Float);
+
+        SimdBoxFilter32f((float*)src.data, src.stride / sizeof(float), src.width, src.height, 1, 
+            radiusX, radiusY, (float*)dst.data, dst.stride / sizeof(float), normalize ? SimdTrue : SimdFalse);
+    }
+
+    /*! @ingroup contour
+
+        \fn void Canny(const View<A>& src, int16_t lowThreshold, int16_t highThreshold, View<A>& dst)
+
+        \short Detects edges at the image with using Canny algorithm.
+
+        Input and output images must have the same size and 8-bit gray format.
+
+        \note This function is a C++ wrapper for function ::SimdCanny.
+
+        \param [in] src - an input image.
+        \param [in] lowThreshold - a low threshold of hysteresis.
+        \param [in] highThreshold - a high threshold of hysteresis.
+        \param [out] dst - an output image with edges.
+    */
+    template<template<class> class A> SIMD_INLINE void Canny(const View<A>& src, int16_t lowThreshold, int16_t highThreshold, View<A>& dst)
+    {
+        assert(EqualSize(src, dst) && src.format == View<A>::Gray8 && dst.format == View<A>::Gray8);
+
+        SimdCanny(src.data, src.stride, src.width, src.height, lowThreshold, highThreshold, dst.data, dst.stride);
+    }
+
     /*! @ingroup conditional
 
         \fn void ConditionalCount8u(const View<A> & src, uint8_t value, SimdCompareType compareType, uint32_t & count)
@@ -1398,6 +1554,28 @@ namespace Simd
         SimdDeinterleaveBgra(bgra.data, bgra.stride, bgra.width, bgra.height, b.data, b.stride, g.data, g.stride, r.data, r.stride, a.data, a.stride);
     }
 
+    /*! @ingroup distance_transform
+
+        \fn void DistanceTransform(const View<A> & mask, uint8_t index, SimdDistanceType type, View<A> & dst)
+
+        \short Performs distance transform of 8-bit mask image.
+
+        The images must have the same width and height. Output image must have 32-bit float or 16-bit integer format.
+
+        \note This function is a C++ wrapper for function ::SimdDistanceTransform.
+
+        \param [in] mask - an input 8-bit gray mask image.
+        \param [in] index - a mask index of pixels to measure distance from.
+        \param [in] type - a type of distance transform.
+        \param [out] dst - an output distance image.
+    */
+    template<template<class> class A> SIMD_INLINE void DistanceTransform(const View<A> & mask, uint8_t index, SimdDistanceType type, View<A> & dst)
+    {
+        assert(EqualSize(mask, dst) && mask.format == View<A>::Gray8 && (dst.format == View<A>::Float || dst.format == View<A>::Int16));
+
+        SimdDistanceTransform(mask.data, mask.stride, mask.width, mask.height, index, type, dst.data, dst.stride, (SimdPixelFormatType)dst.format);
+    }
+
     /*! @ingroup edge_background
 
         \fn void EdgeBackgroundGrowRangeSlow(const View<A>& value, View<A>& background)
@@ -1913,6 +2091,29 @@ namespace Simd
         SimdNormalizeHistogram(src.data, src.stride, src.width, src.height, dst.data, dst.stride);
     }
 
+    /*! @ingroup histogram
+
+        \fn void Clahe(const View<A> & src, View<A> & dst, size_t tilesX = 8, size_t tilesY = 8, float clipLimit = 40.0f)
+
+        \short Performs contrast limited adaptive histogram equalization (CLAHE) for 8-bit gray image.
+
+        The input and output 8-bit gray images must have the same size.
+
+        \note This function is a C++ wrapper for function ::SimdClahe.
+
+        \param [in] src - an input 8-bit gray image.
+        \param [out] dst - an output 8-bit gray image.
+        \param [in] tilesX - a number of tiles in horizontal direction. By default it is equal to 8.
+        \param [in] tilesY - a number of tiles in vertical direction. By default it is equal to 8.
+        \param [in] clipLimit - a relative clip limit of tile histogram. By default it is equal to 40.
+    */
+    template<template<class> class A> SIMD_INLINE void Clahe(const View<A> & src, View<A> & dst, size_t tilesX = 8, size_t tilesY = 8, float clipLimit = 40.0f)
+    {
+        assert(Compatible(src, dst) && src.format == View<A>::Gray8);
+
+        SimdClahe(src.data, src.stride, src.width, src.height, tilesX, tilesY, clipLimit, dst.data, dst.stride);
+    }
+
     /*! @ingroup hog
 
         \fn void SimdHogDirectionHistograms(const View<A> & src, const Point<ptrdiff_t> & cell, size_t quantization, float * histograms);
@@ -2007,47 +2208,70 @@ namespace Simd
 
         \fn void Integral(const View<A>& src, View<A>& sum)
 
-        \short Calculates integral images for input 8-bit gray image.
+        \short Calculates integral images for input 8-bit gray or 32-bit float image.
 
         The function can calculates sum integral image.
         A integral image must have width and height per unit greater than that of the input image.
 
-        \note This function is a C++ wrapper for function ::SimdIntegral.
+        \note This function is a C++ wrapper for function ::SimdIntegral or ::SimdIntegral32f.
 
-        \param [in] src - an input 8-bit gray image.
-        \param [out] sum - a 32-bit integer sum image.
+        \param [in] src - an input 8-bit gray or 32-bit float image.
+        \param [out] sum - a 32-bit integer sum image (64-bit float point for 32-bit float input image).
     */
     template<template<class> class A> SIMD_INLINE void Integral(const View<A>& src, View<A>& sum)
     {
         assert(src.width + 1 == sum.width && src.height + 1 == sum.height);
-        assert(src.format == View<A>::Gray8 && sum.format == View<A>::Int32);
 
-        SimdIntegral(src.data, src.stride, src.width, src.height, sum.data, sum.stride, NULL, 0, NULL, 0,
-            (SimdPixelFormatType)sum.format, SimdPixelFormatNone);
+        if (src.format == View<A>::Float)
+        {
+            assert(sum.format == View<A>::Double);
+
+            SimdIntegral32f((float*)src.data, src.stride / sizeof(float), src.width, src.height, 
+                (double*)sum.data, sum.stride / sizeof(double), NULL, 0);
+        }
+        else
+        {
+            assert(src.format == View<A>::Gray8 && sum.format == View<A>::Int32);
+
+            SimdIntegral(src.data, src.stride, src.width, src.height, sum.data, sum.stride, NULL, 0, NULL, 0,
+                (SimdPixelFormatType)sum.format, SimdPixelFormatNone);
+        }
     }
 
     /*! @ingroup integral
 
         \fn void Integral(const View<A>& src, View<A>& sum, View<A>& sqsum)
 
-        \short Calculates integral images for input 8-bit gray image.
+        \short Calculates integral images for input 8-bit gray or 32-bit float image.
 
         The function can calculates sum integral image and square sum integral image.
         A integral images must have width and height per unit greater than that of the input image.
 
-        \note This function is a C++ wrapper for function ::SimdIntegral.
+        \note This function is a C++ wrapper for function ::SimdIntegral or ::SimdIntegral32f.
 
-        \param [in] src - an input 8-bit gray image.
-        \param [out] sum - a 32-bit integer sum image.
-        \param [out] sqsum - a 32-bit integer or 64-bit float point square sum image.
+        \param [in] src - an input 8-bit gray or 32-bit float image.
+        \param [out] sum - a 32-bit integer sum image (64-bit float point for 32-bit float input image).
+        \param [out] sqsum - a 32-bit integer, 64-bit integer or 64-bit float point square sum image (64-bit float point for 32-bit float input image).
     */
     template<template<class> class A> SIMD_INLINE void Integral(const View<A>& src, View<A>& sum, View<A>& sqsum)
     {
         assert(src.width + 1 == sum.width && src.height + 1 == sum.height && EqualSize(sum, sqsum));
-        assert(src.format == View<A>::Gray8 && sum.format == View<A>::Int32 && (sqsum.format == View<A>::Int32 || sqsum.format == View<A>::Double));
 
-        SimdIntegral(src.data, src.stride, src.width, src.height, sum.data, sum.stride, sqsum.data, sqsum.stride, NULL, 0,
-            (SimdPixelFormatType)sum.format, (SimdPixelFormatType)sqsum.format);
+        if (src.format == View<A>::Float)
+        {
+            assert(sum.format == View<A>::Double && sqsum.format == View<A>::Double);
+
+            SimdIntegral32f((float*)src.data, src.stride / sizeof(float), src.width, src.height, 
+                (double*)sum.data, sum.stride / sizeof(double), (double*)sqsum.data, sqsum.stride / sizeof(double));
+        }
+        else
+        {
+            assert(src.format == View<A>::Gray8 && sum.format == View<A>::Int32 && 
+                (sqsum.format == View<A>::Int32 || sqsum.format == View<A>::Int64 || sqsum.format == View<A>::Double));
+
+            SimdIntegral(src.data, src.stride, src.width, src.height, sum.data, sum.stride, sqsum.data, sqsum.stride, NULL, 0,
+                (SimdPixelFormatType)sum.format, (SimdPixelFormatType)sqsum.format);
+        }
     }
 
     /*! @ingroup integral
@@ -2063,13 +2287,14 @@ namespace Simd
 
         \param [in] src - an input 8-bit gray image.
         \param [out] sum - a 32-bit integer sum image.
-        \param [out] sqsum - a 32-bit integer or 64-bit float point square sum image.
+        \param [out] sqsum - a 32-bit integer, 64-bit integer or 64-bit float point square sum image.
         \param [out] tilted - a 32-bit integer tilted sum image.
     */
     template<template<class> class A> SIMD_INLINE void Integral(const View<A>& src, View<A>& sum, View<A>& sqsum, View<A>& tilted)
     {
         assert(src.width + 1 == sum.width && src.height + 1 == sum.height && EqualSize(sum, sqsum) && Compatible(sum, tilted));
-        assert(src.format == View<A>::Gray8 && sum.format == View<A>::Int32 && (sqsum.format == View<A>::Int32 || sqsum.format == View<A>::Double));
+        assert(src.format == View<A>::Gray8 && sum.format == View<A>::Int32 && 
+            (sqsum.format == View<A>::Int32 || sqsum.format == View<A>::Int64 || sqsum.format == View<A>::Double));
 
         SimdIntegral(src.data, src.stride, src.width, src.height, sum.data, sum.stride, sqsum.data, sqsum.stride, tilted.data, tilted.stride,
             (SimdPixelFormatType)sum.format, (SimdPixelFormatType)sqsum.format);
@@ -2483,6 +2708,51 @@ namespace Simd
         SimdMedianFilterSquare5x5(src.data, src.stride, src.width, src.height, src.ChannelCount(), dst.data, dst.stride);
     }
 
+    /*! @ingroup median_filter
+
+        \fn void MedianFilterSquare(const View<A>& src, size_t radius, View<A>& dst)
+
+        \short Performs median filtration of input image (filter window is a square (2*radius + 1)x(2*radius + 1)).
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+
+        \note This function is a C++ wrapper for function ::SimdMedianFilterSquare.
+
+        \param [in] src - an original input image.
+        \param [in] radius - a radius of filter window. It must be less than 128.
+        \param [out] dst - a filtered output image.
+    */
+    template<template<class> class A> SIMD_INLINE void MedianFilterSquare(const View<A>& src, size_t radius, View<A>& dst)
+    {
+        assert(Compatible(src, dst) && src.ChannelSize() == 1 && radius < 128);
+
+        SimdMedianFilterSquare(src.data, src.stride, src.width, src.height, src.ChannelCount(), radius, dst.data, dst.stride);
+    }
+
+    /*! @ingroup morphology_filter
+
+        \fn void Morphology(const View<A>& src, size_t radiusX, size_t radiusY, SimdMorphologyType type, View<A>& dst)
+
+        \short Performs morphological operation with rectangular structuring element of size (2*radiusX + 1)x(2*radiusY + 1).
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+        Input and output image can be the same image (in-place mode).
+
+        \note This function is a C++ wrapper for function ::SimdMorphology.
+
+        \param [in] src - an original input image.
+        \param [in] radiusX - a horizontal radius of structuring element.
+        \param [in] radiusY - a vertical radius of structuring element.
+        \param [in] type - a type of morphological operation.
+        \param [out] dst - an output image.
+    */
+    template<template<class> class A> SIMD_INLINE void Morphology(const View<A>& src, size_t radiusX, size_t radiusY, SimdMorphologyType type, View<A>& dst)
+    {
+        assert(Compatible(src, dst) && src.ChannelSize() == 1);
+
+        SimdMorphology(src.data, src.stride, src.width, src.height, src.ChannelCount(), radiusX, radiusY, type, dst.data, dst.stride);
+    }
+
     /*! @ingroup neural
 
         \fn void NeuralConvert(const View<A> & src, float * dst, size_t stride, bool inversion)
@@ -2510,6 +2780,32 @@ namespace Simd
         SimdNeuralConvert(src.data, src.stride, src.width, src.height, dst, stride, inversion ? 1 : 0);
     }
 
+    /*! @ingroup object_detection
+
+        \fn void NonMaxSuppression(const std::vector<Rectangle<float>> & boxes, std::vector<float> & scores, std::vector<size_t> & indices, SimdNonMaxSuppressionType type = SimdNonMaxSuppressionHard, float iouThreshold = 0.5f, float sigma = 0.5f, float scoreThreshold = 0.0f)
+
+        \short Performs non-maximum suppression (hard or soft) of scored boxes.
+
+        \note This function is a C++ wrapper for function ::SimdNonMaxSuppression32f.
+
+        \param [in] boxes - boxes to filter.
+        \param [in, out] scores - scores of boxes. On output scores of removed boxes are set to zero.
+        \param [out] indices - indices of kept boxes in the order of selection.
+        \param [in] type - a type of suppression. By default it is hard suppression.
+        \param [in] iouThreshold - an IoU threshold. By default it is equal to 0.5.
+        \param [in] sigma - a parameter of Gaussian suppression. By default it is equal to 0.5.
+        \param [in] scoreThreshold - a minimal score of kept boxes. By default it is equal to 0.
+    */
+    SIMD_INLINE void NonMaxSuppression(const std::vector<Rectangle<float>> & boxes, std::vector<float> & scores, std::vector<size_t> & indices,
+        SimdNonMaxSuppressionType type = SimdNonMaxSuppressionHard, float iouThreshold = 0.5f, float sigma = 0.5f, float scoreThreshold = 0.0f)
+    {
+        assert(boxes.size() == scores.size());
+
+        indices.resize(boxes.size());
+        size_t kept = SimdNonMaxSuppression32f((const float*)boxes.data(), scores.data(), boxes.size(), type, iouThreshold, sigma, scoreThreshold, indices.data());
+        indices.resize(kept);
+    }
+
     /*! @ingroup operation
 
         \fn void OperationBinary8u(const View<A>& a, const View<A>& b, View<A>& dst, SimdOperationBinary8uType type)
@@ -2727,6 +3023,41 @@ namespace Simd
         }
     }
 
+    /*! @ingroup resizing
+
+        \fn void ReduceGray(const View<A> & src, View<A> & dst, const Rectangle<ptrdiff_t> & rect, ::SimdReduceType reduceType, bool compensation = true)
+
+        \short Performs reducing of 8-bit gray image (in 2 times) in given region of output image.
+
+        Pixels of output image inside the region are equal to the pixels which are computed by reducing of whole image. Other pixels stay unchanged.
+
+        For input and output image must be performed: dst.width = (src.width + 1)/2,  dst.height = (src.height + 1)/2.
+
+        \param [in] src - an original input image.
+        \param [in, out] dst - a reduced output image.
+        \param [in] rect - a region of the output image.
+        \param [in] reduceType - a type of function used for image reducing.
+        \param [in] compensation - a flag of compensation of rounding. It is relevant only for ::SimdReduce3x3 and ::SimdReduce5x5. It is equal to 'true' by default.
+    */
+    template<template<class> class A> SIMD_INLINE void ReduceGray(const View<A> & src, View<A> & dst, const Rectangle<ptrdiff_t> & rect, ::SimdReduceType reduceType, bool compensation = true)
+    {
+        typedef Rectangle<ptrdiff_t> Rect;
+        assert(src.format == View<A>::Gray8 && dst.format == View<A>::Gray8 && Scale(src.Size()) == dst.Size());
+
+        Rect r = rect.Intersection(Rect(dst.Size()));
+        if (r.Empty())
+            return;
+        if (r == Rect(dst.Size()))
+        {
+            ReduceGray(src, dst, reduceType, compensation);
+            return;
+        }
+        Rect e = Rect(r.left - 1, r.top - 1, r.right + 1, r.bottom + 1).Intersection(Rect(dst.Size()));
+        View<A> buffer(e.Size(), View<A>::Gray8);
+        ReduceGray(src.Region(e.left * 2, e.top * 2, std::min<ptrdiff_t>(e.right * 2, src.width), std::min<ptrdiff_t>(e.bottom * 2, src.height)), buffer, reduceType, compensation);
+        Simd::Copy(buffer.Region(r.Shifted(-e.left, -e.top)), dst.Region(r).Ref());
+    }
+
     /*! @ingroup resizing
 
         \fn void Reduce2x2(const View<A> & src, View<A> & dst)
@@ -2886,6 +3217,121 @@ namespace Simd
         }
     }
 
+    /*! @ingroup warping
+
+        \fn void WarpAffine(const View<A> & src, const float * mat, View<A> & dst, ::SimdWarpInterpType interp = ::SimdWarpInterpBilinear, ::SimdWarpBorderType border = ::SimdWarpBorderConstant, const uint8_t * value = NULL)
+
+        \short Performs affine warping of image.
+
+        All images must have the same format (8-bit gray, 16-bit UV, 24-bit BGR, 32-bit BGRA or 32-bit float).
+
+        \note This function is a C++ wrapper for functions ::SimdWarpInit and ::SimdWarpRun.
+
+        \param [in] src - an original input image.
+        \param [in] mat - a pointer to 2x3 matrix which maps output coordinates to input coordinates.
+        \param [out] dst - a warped output image.
+        \param [in] interp - an interpolation method. By default it is equal to ::SimdWarpInterpBilinear.
+        \param [in] border - a type of border processing. By default it is equal to ::SimdWarpBorderConstant.
+        \param [in] value - a pointer to border pixel value. By default it is NULL (zero value).
+    */
+    template<template<class> class A> SIMD_INLINE void WarpAffine(const View<A> & src, const float * mat, View<A> & dst, 
+        ::SimdWarpInterpType interp = ::SimdWarpInterpBilinear, ::SimdWarpBorderType border = ::SimdWarpBorderConstant, const uint8_t * value = NULL)
+    {
+        assert(src.format == dst.format && (src.format == View<A>::Float || src.ChannelSize() == 1));
+
+        SimdResizeChannelType type = src.format == View<A>::Float ? SimdResizeChannelFloat : SimdResizeChannelByte;
+        void * warp = SimdWarpInit(src.width, src.height, dst.width, dst.height, src.ChannelCount(), type, mat, SimdWarpTransformAffine, interp, border, value);
+        if (warp)
+        {
+            SimdWarpRun(warp, src.data, src.stride, dst.data, dst.stride);
+            SimdRelease(warp);
+        }
+        else
+            assert(0);
+    }
+
+    /*! @ingroup warping
+
+        \fn void WarpPerspective(const View<A> & src, const float * mat, View<A> & dst, ::SimdWarpInterpType interp = ::SimdWarpInterpBilinear, ::SimdWarpBorderType border = ::SimdWarpBorderConstant, const uint8_t * value = NULL)
+
+        \short Performs perspective warping of image.
+
+        All images must have the same format (8-bit gray, 16-bit UV, 24-bit BGR, 32-bit BGRA or 32-bit float).
+
+        \note This function is a C++ wrapper for functions ::SimdWarpInit and ::SimdWarpRun.
+
+        \param [in] src - an original input image.
+        \param [in] mat - a pointer to 3x3 matrix which maps output coordinates to input coordinates.
+        \param [out] dst - a warped output image.
+        \param [in] interp - an interpolation method. By default it is equal to ::SimdWarpInterpBilinear.
+        \param [in] border - a type of border processing. By default it is equal to ::SimdWarpBorderConstant.
+        \param [in] value - a pointer to border pixel value. By default it is NULL (zero value).
+    */
+    template<template<class> class A> SIMD_INLINE void WarpPerspective(const View<A> & src, const float * mat, View<A> & dst,
+        ::SimdWarpInterpType interp = ::SimdWarpInterpBilinear, ::SimdWarpBorderType border = ::SimdWarpBorderConstant, const uint8_t * value = NULL)
+    {
+        assert(src.format == dst.format && (src.format == View<A>::Float || src.ChannelSize() == 1));
+
+        SimdResizeChannelType type = src.format == View<A>::Float ? SimdResizeChannelFloat : SimdResizeChannelByte;
+        void * warp = SimdWarpInit(src.width, src.height, dst.width, dst.height, src.ChannelCount(), type, mat, SimdWarpTransformPerspective, interp, border, value);
+        if (warp)
+        {
+            SimdWarpRun(warp, src.data, src.stride, dst.data, dst.stride);
+            SimdRelease(warp);
+        }
+        else
+            assert(0);
+    }
+
+    /*! @ingroup warping
+
+        \fn void RemapConvertMap(const View<A> & mapX, const View<A> & mapY, size_t srcWidth, size_t srcHeight, View<A> & map)
+
+        \short Converts floating point remap tables to compact fixed-point map.
+
+        The tables must have the same size and 32-bit float format. The map must have ::SimdPixelFormatInt16 format and tripled width of the tables.
+
+        \note This function is a C++ wrapper for function ::SimdRemapConvertMap.
+
+        \param [in] mapX - a table of x-coordinates of input image points.
+        \param [in] mapY - a table of y-coordinates of input image points.
+        \param [in] srcWidth - a width of the input image.
+        \param [in] srcHeight - a height of the input image.
+        \param [out] map - an output fixed-point map.
+    */
+    template<template<class> class A> SIMD_INLINE void RemapConvertMap(const View<A> & mapX, const View<A> & mapY, size_t srcWidth, size_t srcHeight, View<A> & map)
+    {
+        assert(EqualSize(mapX, mapY) && mapX.format == View<A>::Float && mapY.format == View<A>::Float);
+        assert(map.format == View<A>::Int16 && map.width == 3 * mapX.width && map.height == mapX.height);
+
+        SimdRemapConvertMap((float*)mapX.data, mapX.stride, (float*)mapY.data, mapY.stride, mapX.width, mapX.height, srcWidth, srcHeight, (int16_t*)map.data, map.stride);
+    }
+
+    /*! @ingroup warping
+
+        \fn void RemapBilinear(const View<A> & src, const View<A> & map, View<A> & dst, ::SimdWarpBorderType border = ::SimdWarpBorderConstant, const uint8_t * value = NULL)
+
+        \short Performs remapping of image with using bilinear interpolation and precomputed fixed-point map.
+
+        All images must have the same format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA). The map must be created by function Simd::RemapConvertMap.
+
+        \note This function is a C++ wrapper for function ::SimdRemapBilinear.
+
+        \param [in] src - an original input image.
+        \param [in] map - a fixed-point map.
+        \param [out] dst - a remapped output image.
+        \param [in] border - a type of border processing. By default it is equal to ::SimdWarpBorderConstant.
+        \param [in] value - a pointer to border pixel value. By default it is NULL (zero value).
+    */
+    template<template<class> class A> SIMD_INLINE void RemapBilinear(const View<A> & src, const View<A> & map, View<A> & dst, 
+        ::SimdWarpBorderType border = ::SimdWarpBorderConstant, const uint8_t * value = NULL)
+    {
+        assert(src.format == dst.format && src.ChannelSize() == 1 && map.format == View<A>::Int16 && map.width == 3 * dst.width && map.height == dst.height);
+
+        SimdRemapBilinear(src.data, src.stride, src.width, src.height, src.ChannelCount(), (int16_t*)map.data, map.stride, 
+            dst.width, dst.height, border, value, dst.data, dst.stride);
+    }
+
     /*! @ingroup rgb_conversion
 
         \fn void RgbToGray(const View<A>& rgb, View<A>& gray)
@@ -3003,6 +3449,43 @@ namespace Simd
             difference.data, difference.stride, currentIndex, invalidIndex, emptyIndex, differenceThreshold);
     }
 
+    /*! @ingroup segmentation
+
+        \fn size_t SegmentationLabelComponents(const View<A> & mask, uint8_t index, SimdConnectivityType connectivity, View<A> & labels, std::vector<SimdConnectedComponent> & components)
+
+        \short Performs connected components labeling of mask image.
+
+        Mask must has 8-bit gray pixel format. Labels image must have the same size and 32-bit integer format or be empty.
+
+        \note This function is a C++ wrapper for function ::SimdSegmentationLabelComponents.
+
+        \param [in] mask - a 8-bit gray mask image.
+        \param [in] index - a mask index of foreground pixels.
+        \param [in] connectivity - a pixel connectivity (4 or 8).
+        \param [out] labels - an output 32-bit labels image. It can be empty.
+        \param [out] components - an output vector with statistics of all connected components.
+        \return a number of connected components.
+    */
+    template<template<class> class A> SIMD_INLINE size_t SegmentationLabelComponents(const View<A> & mask, uint8_t index, SimdConnectivityType connectivity, 
+        View<A> & labels, std::vector<SimdConnectedComponent> & components)
+    {
+        assert(mask.format == View<A>::Gray8);
+        assert(labels.data == NULL || (EqualSize(mask, labels) && labels.format == View<A>::Int32));
+
+        uint32_t * _labels = (uint32_t*)labels.data;
+        size_t labelsStride = labels.stride / sizeof(uint32_t);
+        size_t count = SimdSegmentationLabelComponents(mask.data, mask.stride, mask.width, mask.height, index, connectivity,
+            _labels, labelsStride, components.data(), components.size());
+        if (count > components.size())
+        {
+            components.resize(count);
+            SimdSegmentationLabelComponents(mask.data, mask.stride, mask.width, mask.height, index, connectivity,
+                NULL, 0, components.data(), components.size());
+        }
+        components.resize(count);
+        return count;
+    }
+
     /*! @ingroup segmentation
 
         \fn void SegmentationShrinkRegion(const View<A> & mask, uint8_t index, Rectangle<ptrdiff_t> & rect)
@@ -3691,6 +4174,54 @@ namespace Simd
         SimdSynetSetInput(src.data, src.width, src.height, src.stride, (SimdPixelFormatType)src.format, lower, upper, dst, channels, format);
     }
 
+    /*! @ingroup correlation
+
+        \fn void TemplateMatch(const View<A> & src, const View<A> & tmpl, SimdTemplateMatchType type, View<A> & dst)
+
+        \short Matches template over search region of 8-bit gray image.
+
+        Output map must have 32-bit float format and size (src.width - tmpl.width + 1)x(src.height - tmpl.height + 1).
+
+        \note This function is a C++ wrapper for function ::SimdTemplateMatch.
+
+        \param [in] src - an input 8-bit gray search region.
+        \param [in] tmpl - an input 8-bit gray template.
+        \param [in] type - a type of matching metric.
+        \param [out] dst - an output 32-bit float matching map.
+    */
+    template<template<class> class A> SIMD_INLINE void TemplateMatch(const View<A> & src, const View<A> & tmpl, SimdTemplateMatchType type, View<A> & dst)
+    {
+        assert(src.format == View<A>::Gray8 && tmpl.format == View<A>::Gray8 && dst.format == View<A>::Float);
+        assert(dst.width == src.width - tmpl.width + 1 && dst.height == src.height - tmpl.height + 1);
+
+        SimdTemplateMatch(src.data, src.stride, src.width, src.height, tmpl.data, tmpl.stride, tmpl.width, tmpl.height,
+            type, (float*)dst.data, dst.stride / sizeof(float));
+    }
+
+    /*! @ingroup correlation
+
+        \fn size_t TemplateMatchPeaks(const View<A> & map, SimdTemplateMatchType type, size_t radius, size_t count, std::vector<SimdTemplateMatchPeak> & peaks)
+
+        \short Finds the best peaks of template matching map.
+
+        \note This function is a C++ wrapper for function ::SimdTemplateMatchPeaks.
+
+        \param [in] map - an input 32-bit float matching map.
+        \param [in] type - a type of matching metric.
+        \param [in] radius - a radius of non-maximum suppression.
+        \param [in] count - a maximal number of peaks.
+        \param [out] peaks - an output vector with found peaks.
+        \return a number of found peaks.
+    */
+    template<template<class> class A> SIMD_INLINE size_t TemplateMatchPeaks(const View<A> & map, SimdTemplateMatchType type, size_t radius, size_t count, std::vector<SimdTemplateMatchPeak> & peaks)
+    {
+        assert(map.format == View<A>::Float);
+
+        peaks.resize(count);
+        peaks.resize(SimdTemplateMatchPeaks((float*)map.data, map.stride / sizeof(float), map.width, map.height, type, radius, peaks.data(), count));
+        return peaks.size();
+    }
+
     /*! @ingroup texture_estimation
 
         \fn void TextureBoostedSaturatedGradient(const View<A>& src, uint8_t saturation, uint8_t boost, View<A>& dx, View<A>& dy)
@@ -4333,14 +4864,165 @@ namespace Simd
 
         \short Builds the pyramid (fills upper levels on the base of the lowest level).
 
+        Levels are built in one pass over horizontal strips of the base: rows of every upper level are computed as soon as 
+        the rows of the lower level which they depend on are ready, so that the lower level is read while it is still in cache.
+        Big pyramids are built level by level in parallel (over horizontal bands) if the library uses several threads.
+        If the pyramid is in lazy mode (see Simd::Pyramid::SetLazy) then upper levels are only marked as outdated 
+        and every level will be built at the first access to it.
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
         \param [out] pyramid - a built pyramid.
         \param [in] reduceType - a type of function used for image reducing.
         \param [in] compensation - a flag of compensation of rounding. It is relevant only for ::SimdReduce3x3 and ::SimdReduce5x5. It is equal to 'true' by default.
     */
     template<template<class> class A> SIMD_INLINE void Build(Pyramid<A> & pyramid, ::SimdReduceType reduceType, bool compensation = true)
     {
-        for (size_t level = 1; level < pyramid.Size(); ++level)
-            Simd::ReduceGray(pyramid.At(level - 1), pyramid.At(level), reduceType, compensation);
+        typedef Rectangle<ptrdiff_t> Rect;
+        const size_t levelCount = pyramid.Size(), stripHeight = 32, parallelAreaMin = 512 * 512, parallelBandMin = 64;
+        if (levelCount < 2)
+            return;
+        if (pyramid.Lazy())
+        {
+            pyramid.Defer(reduceType, compensation);
+            return;
+        }
+        const size_t threadNumber = ::SimdGetThreadNumber();
+        if (threadNumber > 1 && pyramid[0].Area() >= parallelAreaMin)
+        {
+            for (size_t level = 1; level < levelCount; ++level)
+            {
+                const View<A> & src = pyramid[level - 1];
+                View<A> & dst = pyramid[level];
+                Parallel(0, dst.height, [&](size_t thread, size_t begin, size_t end)
+                {
+                    Simd::ReduceGray(src, dst, Rect(0, begin, dst.width, std::min(end, dst.height)), reduceType, compensation);
+                }, threadNumber, parallelBandMin);
+            }
+        }
+        else
+        {
+            std::vector<size_t> done(levelCount, 0);
+            std::vector<uint8_t> saved(pyramid[1].width);
+            done[0] = pyramid[0].height;
+            while (done[levelCount - 1] < pyramid[levelCount - 1].height)
+            {
+                for (size_t level = 1; level < levelCount; ++level)
+                {
+                    const View<A> & src = pyramid[level - 1];
+                    View<A> & dst = pyramid[level];
+                    size_t top = done[level], bottom = done[level - 1] == src.height ? dst.height : (done[level - 1] >= 2 ? done[level - 1] / 2 - 1 : 0);
+                    if (level == 1)
+                        bottom = std::min(top + stripHeight, dst.height);
+                    if (bottom <= top)
+                        continue;
+                    size_t extTop = top ? top - 1 : 0, extBottom = std::min(bottom + 1, dst.height);
+                    if (top)
+                        memcpy(saved.data(), dst.data + extTop * dst.stride, dst.width);
+                    Simd::ReduceGray(src.Region(0, extTop * 2, src.width, std::min(extBottom * 2, src.height)),
+                        dst.Region(0, extTop, dst.width, extBottom).Ref(), reduceType, compensation);
+                    if (top)
+                        memcpy(dst.data + extTop * dst.stride, saved.data(), dst.width);
+                    done[level] = bottom;
+                }
+            }
+        }
+    }
+
+    /*! @ingroup cpp_pyramid_functions
+
+        \fn void Build(Pyramid<A> & pyramid, ::SimdReduceType reduceType, bool compensation, const Rectangle<ptrdiff_t> & roi)
+
+        \short Builds the pyramid only in given region of interest.
+
+        At every upper level the pixels which cover the scaled region of interest are computed exactly as by full building of the pyramid.
+        Other pixels of upper levels stay unchanged. The building is always performed immediately (even in lazy mode).
+
+        \param [in, out] pyramid - a pyramid.
+        \param [in] reduceType - a type of function used for image reducing.
+        \param [in] compensation - a flag of compensation of rounding. It is relevant only for ::SimdReduce3x3 and ::SimdReduce5x5.
+        \param [in] roi - a region of interest at the lowest level of the pyramid.
+    */
+    template<template<class> class A> SIMD_INLINE void Build(Pyramid<A> & pyramid, ::SimdReduceType reduceType, bool compensation, const Rectangle<ptrdiff_t> & roi)
+    {
+        typedef Rectangle<ptrdiff_t> Rect;
+        const size_t levelCount = pyramid.Size();
+        if (levelCount < 2)
+            return;
+        std::vector<Rect> rects(levelCount);
+        ptrdiff_t scale = ptrdiff_t(1) << (levelCount - 1);
+        rects[levelCount - 1] = Rect(roi.left / scale, roi.top / scale, (roi.right + scale - 1) / scale, (roi.bottom + scale - 1) / scale);
+        for (size_t level = levelCount - 1; level > 0; --level)
+        {
+            const Rect & r = rects[level];
+            rects[level] = r.Intersection(Rect(pyramid[level].Size()));
+            rects[level - 1] = Rect(r.left * 2 - 2, r.top * 2 - 2, r.right * 2 + 2, r.bottom * 2 + 2);
+        }
+        for (size_t level = 1; level < levelCount; ++level)
+        {
+            if (!rects[level].Empty())
+                Simd::ReduceGray(pyramid[level - 1], pyramid[level], rects[level], reduceType, compensation);
+        }
+    }
+
+    /*! @ingroup cpp_pyramid_functions
+
+        \fn void LucasKanadeTrack(const Pyramid<A> & prev, const Pyramid<A> & next, const std::vector<Point<float>> & prevPoints, std::vector<Point<float>> & nextPoints, std::vector<uint8_t> & status, std::vector<float> * errors = NULL, size_t window = 15, size_t iterations = 20, float epsilon = 0.01f, float minEigen = 0.01f)
+
+        \short Tracks sparse points between two image pyramids with pyramidal Lucas-Kanade method.
+
+        Points are tracked from the top level of the pyramids to the base, the position found at every level is used as initial estimation for the next one.
+        Points which are lost at upper levels keep their estimations, status of points is determined at the base level.
+
+        \note This function is a C++ wrapper for function ::SimdLucasKanadeTrack.
+
+        \param [in] prev - a pyramid of previous image.
+        \param [in] next - a pyramid of next image. It must have the same size as the previous pyramid.
+        \param [in] prevPoints - points in the previous image (coordinates of the pyramid base).
+        \param [out] nextPoints - tracked points in the next image.
+        \param [out] status - statuses of points (1 - point is tracked, 0 - point is lost).
+        \param [out] errors - a pointer to mean absolute differences between windows of tracked points. It can be NULL (by default).
+        \param [in] window - a size of the tracking window. It must be odd. By default it is equal to 15.
+        \param [in] iterations - a maximal number of iterations at every level. By default it is equal to 20.
+        \param [in] epsilon - a minimal shift of point to continue iterations. By default it is equal to 0.01.
+        \param [in] minEigen - a minimal normalized eigen value of gradient matrix. By default it is equal to 0.01.
+    */
+    template<template<class> class A> SIMD_INLINE void LucasKanadeTrack(const Pyramid<A> & prev, const Pyramid<A> & next, 
+        const std::vector<Point<float>> & prevPoints, std::vector<Point<float>> & nextPoints, std::vector<uint8_t> & status,
+        std::vector<float> * errors = NULL, size_t window = 15, size_t iterations = 20, float epsilon = 0.01f, float minEigen = 0.01f)
+    {
+        assert(prev.Size() == next.Size() && prev.Size() > 0 && prev[0].Size() == next[0].Size());
+
+        const size_t count = prevPoints.size(), levels = prev.Size();
+        std::vector<Point<float>> points(count);
+        std::vector<uint8_t> levelStatus(count);
+        nextPoints.resize(count);
+        status.assign(count, 1);
+        if (errors)
+            errors->resize(count);
+        if (count == 0)
+            return;
+
+        float scale = 1.0f / float(1 << (levels - 1));
+        for (size_t i = 0; i < count; ++i)
+            nextPoints[i] = Point<float>(prevPoints[i].x * scale, prevPoints[i].y * scale);
+        for (size_t level = levels - 1; level < levels; --level)
+        {
+            for (size_t i = 0; i < count; ++i)
+                points[i] = Point<float>(prevPoints[i].x * scale, prevPoints[i].y * scale);
+            std::vector<uint8_t> & currStatus = level ? levelStatus : status;
+            if (level)
+                levelStatus.assign(count, 1);
+            const View<A> & p = prev[level], & n = next[level];
+            SimdLucasKanadeTrack(p.data, p.stride, n.data, n.stride, p.width, p.height, (const float*)points.data(), (float*)nextPoints.data(),
+                count, window, iterations, epsilon, minEigen, currStatus.data(), (errors && level == 0) ? errors->data() : NULL);
+            if (level)
+            {
+                for (size_t i = 0; i < count; ++i)
+                    nextPoints[i] = Point<float>(nextPoints[i].x * 2.0f, nextPoints[i].y * 2.0f);
+                scale *= 2.0f;
+            }
+        }
     }
 }
 
@@ -0,0 +1,52 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdLucasKanade_h__
+#define __SimdLucasKanade_h__
+
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        const size_t LUCAS_KANADE_WINDOW_MAX = 63;
+        const size_t LUCAS_KANADE_POINTS_MIN = 16;
+
+        typedef void(*LucasKanadeSamplePtr)(const uint8_t * src, size_t stride, size_t width, size_t height, const float * weights, float * dst);
+        typedef void(*LucasKanadeGradientPtr)(const float * patch, size_t size, float * dx, float * dy, float * hessian);
+        typedef void(*LucasKanadeMismatchPtr)(const float * prev, const float * next, const float * dx, const float * dy, size_t count, float * sums);
+
+        void LucasKanadeSample(const uint8_t * src, size_t stride, size_t width, size_t height, const float * weights, float * dst);
+
+        void LucasKanadeGradient(const float * patch, size_t size, float * dx, float * dy, float * hessian);
+
+        void LucasKanadeMismatch(const float * prev, const float * next, const float * dx, const float * dy, size_t count, float * sums);
+
+        void LucasKanadeTrackRun(const uint8_t * prev, size_t prevStride, const uint8_t * next, size_t nextStride, size_t width, size_t height,
+            const float * prevPoints, float * nextPoints, size_t count, size_t window, size_t iterations, float epsilon, float minEigen,
+            uint8_t * status, float * errors, LucasKanadeSamplePtr sample, LucasKanadeGradientPtr gradient, LucasKanadeMismatchPtr mismatch);
+    }
+}
+
+#endif//__SimdLucasKanade_h__
@@ -0,0 +1,131 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdMappedFile_h__
+#define __SimdMappedFile_h__
+
+#include "Simd/SimdDefs.h"
+
+#if defined(_MSC_VER)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__GNUC__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#else
+#error Platform is not supported!
+#endif
+
+namespace Simd
+{
+    class MappedFile
+    {
+    public:
+        MappedFile()
+            : _data(NULL)
+            , _size(0)
+        {
+        }
+
+        ~MappedFile()
+        {
+            Close();
+        }
+
+        bool Open(const char * path)
+        {
+            Close();
+#if defined(_MSC_VER)
+            HANDLE file = ::CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+            if (file == INVALID_HANDLE_VALUE)
+                return false;
+            LARGE_INTEGER size;
+            if (::GetFileSizeEx(file, &size) && size.QuadPart > 0)
+            {
+                HANDLE mapping = ::CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+                if (mapping)
+                {
+                    _data = (const uint8_t*)::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                    if (_data)
+                        _size = (size_t)size.QuadPart;
+                    ::CloseHandle(mapping);
+                }
+            }
+            ::CloseHandle(file);
+#elif defined(__GNUC__)
+            int file = ::open(path, O_RDONLY);
+            if (file == -1)
+                return false;
+            struct stat info;
+            if (::fstat(file, &info) == 0 && info.st_size > 0)
+            {
+                void * data = ::mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_SHARED, file, 0);
+                if (data != MAP_FAILED)
+                {
+                    _data = (const uint8_t*)data;
+                    _size = (size_t)info.st_size;
+                }
+            }
+            ::close(file);
+#endif
+            return _data != NULL;
+        }
+
+        void Close()
+        {
+            if (_data)
+            {
+#if defined(_MSC_VER)
+                ::UnmapViewOfFile(_data);
+#elif defined(__GNUC__)
+                ::munmap((void*)_data, _size);
+#endif
+                _data = NULL;
+                _size = 0;
+            }
+        }
+
+        const uint8_t * Data() const
+        {
+            return _data;
+        }
+
+        size_t Size() const
+        {
+            return _size;
+        }
+
+    private:
+        MappedFile(const MappedFile &);
+        MappedFile & operator = (const MappedFile &);
+
+        const uint8_t * _data;
+        size_t _size;
+    };
+}
+
+#endif//__SimdMappedFile_h__
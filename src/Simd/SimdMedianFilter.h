@@ -0,0 +1,123 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdMedianFilter_h__
+#define __SimdMedianFilter_h__
+
+#include "Simd/SimdMath.h"
+#include "Simd/SimdArray.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        const size_t MEDIAN_HIST_FINE = 256;
+        const size_t MEDIAN_HIST_COARSE = 16;
+        const size_t MEDIAN_HIST_SIZE = MEDIAN_HIST_FINE + MEDIAN_HIST_COARSE;
+        const size_t MEDIAN_RADIUS_MAX = 127;
+
+        struct MedianHistogram
+        {
+            MedianHistogram(size_t width, size_t channelCount)
+                : size(width*channelCount)
+                , cols(size*MEDIAN_HIST_SIZE, true)
+                , kernel(MEDIAN_HIST_SIZE)
+            {
+            }
+
+            size_t size;
+            Array16u cols, kernel;
+        };
+
+        SIMD_INLINE size_t MedianIndex(ptrdiff_t index, size_t size)
+        {
+            return (size_t)Simd::RestrictRange<ptrdiff_t>(index, 0, (ptrdiff_t)size - 1);
+        }
+
+        SIMD_INLINE void MedianColsAdd(const uint8_t * src, size_t size, uint16_t * cols)
+        {
+            for (size_t i = 0; i < size; ++i, cols += MEDIAN_HIST_SIZE)
+            {
+                cols[src[i]]++;
+                cols[MEDIAN_HIST_FINE + (src[i] >> 4)]++;
+            }
+        }
+
+        SIMD_INLINE void MedianColsUpdate(const uint8_t * add, const uint8_t * sub, size_t size, uint16_t * cols)
+        {
+            for (size_t i = 0; i < size; ++i, cols += MEDIAN_HIST_SIZE)
+            {
+                cols[add[i]]++;
+                cols[MEDIAN_HIST_FINE + (add[i] >> 4)]++;
+                cols[sub[i]]--;
+                cols[MEDIAN_HIST_FINE + (sub[i] >> 4)]--;
+            }
+        }
+
+        SIMD_INLINE uint8_t MedianFind(const uint16_t * kernel, size_t rank)
+        {
+            const uint16_t * coarse = kernel + MEDIAN_HIST_FINE;
+            size_t sum = 0, c = 0;
+            for (; sum + coarse[c] <= rank; ++c)
+                sum += coarse[c];
+            size_t f = c*MEDIAN_HIST_COARSE;
+            for (; sum + kernel[f] <= rank; ++f)
+                sum += kernel[f];
+            return (uint8_t)f;
+        }
+
+        template<class Kernel> void MedianFilterSquareHistogram(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            size_t channelCount, size_t radius, uint8_t * dst, size_t dstStride)
+        {
+            assert(radius <= MEDIAN_RADIUS_MAX);
+
+            MedianHistogram hist(width, channelCount);
+            ptrdiff_t r = (ptrdiff_t)radius;
+            size_t rank = (2 * radius + 1)*(2 * radius + 1) / 2, step = channelCount*MEDIAN_HIST_SIZE;
+            for (ptrdiff_t dy = -r; dy <= r; ++dy)
+                MedianColsAdd(src + MedianIndex(dy, height)*srcStride, hist.size, hist.cols.data);
+            for (size_t row = 0; row < height; ++row, dst += dstStride)
+            {
+                for (size_t c = 0; c < channelCount; ++c)
+                {
+                    const uint16_t * cols = hist.cols.data + c*MEDIAN_HIST_SIZE;
+                    uint16_t * kernel = hist.kernel.data;
+                    hist.kernel.Clear();
+                    for (ptrdiff_t dx = -r; dx <= r; ++dx)
+                        Kernel::Add(cols + MedianIndex(dx, width)*step, kernel);
+                    for (size_t col = 0; col < width; ++col)
+                    {
+                        dst[col*channelCount + c] = MedianFind(kernel, rank);
+                        if (col + 1 < width)
+                            Kernel::Update(cols + MedianIndex(col + radius + 1, width)*step, cols + MedianIndex((ptrdiff_t)col - r, width)*step, kernel);
+                    }
+                }
+                if (row + 1 < height)
+                    MedianColsUpdate(src + MedianIndex(row + radius + 1, height)*srcStride,
+                        src + MedianIndex((ptrdiff_t)row - r, height)*srcStride, hist.size, hist.cols.data);
+            }
+        }
+    }
+}
+
+#endif//__SimdMedianFilter_h__
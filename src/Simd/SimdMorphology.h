@@ -0,0 +1,69 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdMorphology_h__
+#define __SimdMorphology_h__
+
+#include "Simd/SimdMath.h"
+#include "Simd/SimdArray.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        const size_t MORPHOLOGY_STRIP = 256;
+
+        typedef void(*MorphologyRowPtr)(const uint8_t * a, const uint8_t * b, size_t size, uint8_t * dst);
+
+        struct MorphologyBuffer
+        {
+            MorphologyBuffer(size_t width, size_t height, size_t channelCount, size_t radiusX, size_t radiusY, bool inplace)
+            {
+                size_t line = (width + 2 * radiusX)*channelCount;
+                size_t strip = Simd::Min(width*channelCount, MORPHOLOGY_STRIP);
+                buffer.Resize(3 * line + (2 * radiusY + 2)*strip + (inplace ? height*strip : 0));
+                lineSrc = buffer.data;
+                lineFwd = lineSrc + line;
+                lineBwd = lineFwd + line;
+                rowsBwd = lineBwd + line;
+                rowFwd = rowsBwd + (2 * radiusY + 1)*strip;
+                copy = rowFwd + strip;
+            }
+
+            uint8_t * lineSrc, * lineFwd, * lineBwd, * rowsBwd, * rowFwd, * copy;
+        private:
+            Array8u buffer;
+        };
+
+        SIMD_INLINE size_t MorphologyIndex(ptrdiff_t index, size_t size)
+        {
+            return (size_t)Simd::RestrictRange<ptrdiff_t>(index, 0, (ptrdiff_t)size - 1);
+        }
+
+        void Morphology(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, 
+            size_t radiusX, size_t radiusY, SimdMorphologyType type, uint8_t * dst, size_t dstStride, 
+            MorphologyRowPtr rowMin, MorphologyRowPtr rowMax);
+    }
+}
+
+#endif//__SimdMorphology_h__
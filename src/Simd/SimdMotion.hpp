@@ -32,7 +32,14 @@
 
 #include <vector>
 #include <stack>
+#include <deque>
 #include <sstream>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
 
 #ifndef SIMD_CHECK_PERFORMANCE
 #define SIMD_CHECK_PERFORMANCE()
@@ -380,6 +387,59 @@ namespace Simd
         {
             Objects objects; /*!< \brief A list of objects detected by Simd::Motion::Detector at current frame. */
             Events events; /*!< \brief A list of events generated by Simd::Motion::Detector at current frame. */
+
+            /*!
+                \short Statistics structure.
+
+                Contains per-stage timing and counters of processing of current frame by Simd::Motion::Detector.
+                Stage timing is measured only if Options::StatisticsEnable is true, counters are always filled.
+            */
+            struct Statistics
+            {
+                /*!
+                    \enum Stage
+
+                    Describes stages of frame processing.
+                */
+                enum Stage
+                {
+                    Calibrate, /*!< \brief Calibration of detector (only at the first frame or after change of frame size). */
+                    SetFrame, /*!< \brief Conversion and scaling of input frame. */
+                    EstimateTextures, /*!< \brief Estimation of texture features. */
+                    EstimateDifference, /*!< \brief Estimation of difference between features and background. */
+                    PerformSegmentation, /*!< \brief Segmentation of moving regions. */
+                    VerifyStability, /*!< \brief Verification of scene stability (sabotage detection). */
+                    TrackObjects, /*!< \brief Tracking of objects. */
+                    ClassifyObjects, /*!< \brief Classification of objects. */
+                    UpdateBackground, /*!< \brief Update of background model. */
+                    SetMetadata, /*!< \brief Creation of output metadata. */
+                    DebugAnnotation, /*!< \brief Debug annotation of output frame. */
+                    StageSize, /*!< \brief A number of stages. */
+                };
+
+                Time times[StageSize]; /*!< \brief Times (in seconds) of processing stages. */
+                Time total; /*!< \brief Total time (in seconds) of frame processing. */
+                size_t pixels; /*!< \brief A number of pixels of scaled frame used for texture estimation. */
+                size_t movingRegions; /*!< \brief A number of moving regions found by segmentation. */
+                size_t trackedObjects; /*!< \brief A number of tracked objects (including static ones). */
+                size_t objects; /*!< \brief A number of objects in metadata. */
+                size_t events; /*!< \brief A number of events in metadata. */
+
+                /*!
+                    Default constructor of Statistics. It zeroes all values.
+                */
+                Statistics()
+                {
+                    for (size_t i = 0; i < StageSize; ++i)
+                        times[i] = 0;
+                    total = 0;
+                    pixels = 0;
+                    movingRegions = 0;
+                    trackedObjects = 0;
+                    objects = 0;
+                    events = 0;
+                }
+            } statistics; /*!< \brief Statistics of processing of current frame. */
         };
 
         /*! @ingroup cpp_motion
@@ -464,6 +524,8 @@ namespace Simd
             bool DebugAnnotateMovingRegions; /*!< \brief Debug annotation of moving region. By default it is equal to false. */
             bool DebugAnnotateTrackingObjects; /*!< \brief Debug annotation of tracked objects. By default it is equal to false. */
 
+            bool StatisticsEnable; /*!< \brief Enables measurement of time of processing stages (see Metadata::Statistics). By default it is equal to false. */
+
             /*!
                 Default constructor of Options.
             */
@@ -499,6 +561,8 @@ namespace Simd
                 DebugAnnotateModel = false;
                 DebugAnnotateMovingRegions = false;
                 DebugAnnotateTrackingObjects = false;
+
+                StatisticsEnable = false;
             }
         };
 
@@ -553,6 +617,8 @@ namespace Simd
             /*!
                 Processes next frame. You have to successively process all frame of a movie with using of this function.
 
+                \note Frames in Gray8, Nv12 and Yuv420p formats are processed without color conversion: the luma plane is reduced directly.
+
                 \param [in] input - a current input frame.
                 \param [out] metadata - a metadata (sets of detected objects and generated events). It is a result of processing of current frame.
                 \param [out] output - a pointer to output frame with debug annotation. Can be NULL.
@@ -565,31 +631,48 @@ namespace Simd
                 if (output && output->Size() != input.Size())
                     return false;
 
+                metadata.statistics = Metadata::Statistics();
+                _stage = Clock::now();
+                Clock::time_point start = _stage;
+
                 if (!Calibrate(input.Size()))
                     return false;
 
                 _scene.metadata = &metadata;
                 _scene.metadata->events.clear();
+                Measure(Metadata::Statistics::Calibrate);
 
                 SetFrame(input, output);
+                Measure(Metadata::Statistics::SetFrame);
 
                 EstimateTextures();
+                Measure(Metadata::Statistics::EstimateTextures);
 
                 EstimateDifference();
+                Measure(Metadata::Statistics::EstimateDifference);
 
                 PerformSegmentation();
+                Measure(Metadata::Statistics::PerformSegmentation);
 
                 VerifyStability();
+                Measure(Metadata::Statistics::VerifyStability);
 
                 TrackObjects();
+                Measure(Metadata::Statistics::TrackObjects);
 
                 ClassifyObjects();
+                Measure(Metadata::Statistics::ClassifyObjects);
 
                 UpdateBackground();
+                Measure(Metadata::Statistics::UpdateBackground);
 
                 SetMetadata();
+                Measure(Metadata::Statistics::SetMetadata);
 
                 DebugAnnotation();
+                Measure(Metadata::Statistics::DebugAnnotation);
+
+                SetStatistics(start);
 
                 return true;
             }
@@ -597,6 +680,9 @@ namespace Simd
         private:
             Simd::Motion::Model _model;
 
+            typedef std::chrono::steady_clock Clock;
+            Clock::time_point _stage;
+
             struct Options : public Simd::Motion::Options
             {
                 int CalibrationLevelCountMin;
@@ -856,6 +942,7 @@ namespace Simd
             {
                 Frame input, * output;
                 Pyramid scaled;
+                View top;
                 Metadata * metadata;
 
                 Font font;
@@ -901,8 +988,25 @@ namespace Simd
 
                 _scene.input = input;
                 _scene.output = output;
-                Simd::Convert(input, Frame(_scene.scaled[0]).Ref());
-                Simd::Build(_scene.scaled, SimdReduce2x2);
+                Pyramid & scaled = _scene.scaled;
+                if (input.format == Frame::Gray8 || input.format == Frame::Nv12 || input.format == Frame::Yuv420p)
+                {
+                    const View & luma = input.planes[0];
+                    if (scaled.Size() == 1)
+                    {
+                        _scene.top = luma;
+                        return;
+                    }
+                    Simd::ReduceGray2x2(luma, scaled[1]);
+                    for (size_t i = 2; i < scaled.Size(); ++i)
+                        Simd::ReduceGray2x2(scaled[i - 1], scaled[i]);
+                }
+                else
+                {
+                    Simd::Convert(input, Frame(scaled[0]).Ref());
+                    Simd::Build(scaled, SimdReduce2x2);
+                }
+                _scene.top = scaled.Top();
             }
 
             bool Calibrate(const Size & frameSize)
@@ -1021,7 +1125,7 @@ namespace Simd
                 SIMD_CHECK_PERFORMANCE();
 
                 Texture & texture = _scene.texture;
-                Simd::Copy(_scene.scaled.Top(), texture.gray.value[0]);
+                Simd::Copy(_scene.top, texture.gray.value[0]);
                 Simd::Build(texture.gray.value, SimdReduce4x4);
                 for (size_t i = 0; i < texture.gray.value.Size(); ++i)
                 {
@@ -1539,6 +1643,28 @@ namespace Simd
                 AddToMetadata(_scene.tracking.justDeletedObjects);
             }
 
+            void Measure(Metadata::Statistics::Stage stage)
+            {
+                if (_options.StatisticsEnable)
+                {
+                    Clock::time_point current = Clock::now();
+                    _scene.metadata->statistics.times[stage] = std::chrono::duration<double>(current - _stage).count();
+                    _stage = current;
+                }
+            }
+
+            void SetStatistics(const Clock::time_point & start)
+            {
+                Metadata::Statistics & statistics = _scene.metadata->statistics;
+                if (_options.StatisticsEnable)
+                    statistics.total = std::chrono::duration<double>(_stage - start).count();
+                statistics.pixels = _scene.model.frameSize.x * _scene.model.frameSize.y;
+                statistics.movingRegions = _scene.segmentation.movingRegions.size();
+                statistics.trackedObjects = _scene.tracking.objects.size();
+                statistics.objects = _scene.metadata->objects.size();
+                statistics.events = _scene.metadata->events.size();
+            }
+
             void AddToMetadata(const ObjectPtrs & objects)
             {
                 size_t scale = _scene.model.scale;
@@ -1630,6 +1756,324 @@ namespace Simd
                 }
             }
         };
+
+        /*! @ingroup cpp_motion
+
+            \short Class Engine.
+
+            Performs motion detection for many video streams on a shared pool of work threads.
+
+            Every stream has its own Simd::Motion::Detector and a bounded queue of input frames.
+            Frames of one stream are always processed in order of their pushing and never concurrently,
+            while frames of different streams are processed in parallel.
+            Results are returned through callback function which is called from work threads.
+
+            Using example:
+            \code
+            void OnResult(size_t stream, const Simd::Motion::Frame & input, const Simd::Motion::Metadata & metadata)
+            {
+                // handles results of stream.
+            }
+
+            Simd::Motion::Engine engine;
+            engine.Init(64, OnResult);
+            ...
+            engine.Push(stream, frame); // it blocks if the stream queue is full.
+            ...
+            engine.Wait();
+            Simd::Motion::Engine::Statistics statistics = engine.GetStatistics();
+            \endcode
+        */
+        class Engine
+        {
+        public:
+            /*!
+                \short Callback function which receives results of motion detection.
+
+                It is called from work threads. Results of the same stream are passed in order of frames pushing.
+            */
+            typedef std::function<void(size_t stream, const Frame & input, const Metadata & metadata)> Callback;
+
+            /*!
+                \short Statistics structure.
+
+                Contains aggregate throughput metrics of Simd::Motion::Engine.
+            */
+            struct Statistics
+            {
+                size_t threads; /*!< \brief A number of work threads. */
+                size_t pushed; /*!< \brief A number of frames accepted by Engine::Push. */
+                size_t processed; /*!< \brief A number of processed frames. */
+                size_t dropped; /*!< \brief A number of frames rejected by Engine::Push because of full stream queue. */
+                size_t queued; /*!< \brief A number of frames waiting for processing. */
+                Time busy; /*!< \brief A total time (in seconds) spent by work threads for frame processing. */
+                Time elapsed; /*!< \brief A time (in seconds) elapsed since Engine::Init. */
+
+                /*!
+                    Gets average number of processed frames per second.
+
+                    \return frames per second.
+                */
+                double Fps() const
+                {
+                    return elapsed > 0 ? processed / elapsed : 0;
+                }
+
+                /*!
+                    Gets average load of work threads.
+
+                    \return a load in range [0, 1].
+                */
+                double Load() const
+                {
+                    return elapsed > 0 && threads ? busy / elapsed / threads : 0;
+                }
+            };
+
+            /*!
+                Default constructor of Engine.
+            */
+            Engine()
+                : _stop(false)
+                , _queueSizeMax(0)
+                , _statistics()
+            {
+            }
+
+            /*!
+                Destructor of Engine. It stops work threads. Frames which are not processed yet are discarded.
+            */
+            virtual ~Engine()
+            {
+                Stop();
+            }
+
+            /*!
+                Initializes Engine and starts work threads.
+
+                \param [in] streamCount - a number of video streams.
+                \param [in] callback - a callback function to receive results of motion detection.
+                \param [in] threadNumber - a number of work threads. Use value -1 to auto choose of thread number.
+                \param [in] queueSizeMax - a maximal number of queued frames for every stream. By default it is equal to 4.
+                \return a result of the operation.
+            */
+            bool Init(size_t streamCount, const Callback & callback, ptrdiff_t threadNumber = -1, size_t queueSizeMax = 4)
+            {
+                if (streamCount == 0 || queueSizeMax == 0 || !callback)
+                    return false;
+                Stop();
+                _stop = false;
+                _callback = callback;
+                _queueSizeMax = queueSizeMax;
+                _streams.clear();
+                for (size_t i = 0; i < streamCount; ++i)
+                    _streams.push_back(StreamPtr(new Stream()));
+                _ready.clear();
+                _statistics = Statistics();
+                _start = std::chrono::steady_clock::now();
+                ptrdiff_t threadNumberMax = std::max<ptrdiff_t>(std::thread::hardware_concurrency(), 1);
+                threadNumber = (threadNumber <= 0 || threadNumber > threadNumberMax) ? threadNumberMax : threadNumber;
+                threadNumber = std::min<ptrdiff_t>(threadNumber, streamCount);
+                _statistics.threads = threadNumber;
+                for (ptrdiff_t i = 0; i < threadNumber; ++i)
+                    _threads.push_back(std::thread(&Engine::Work, this));
+                return true;
+            }
+
+            /*!
+                Sets options of motion detector of given stream. It waits until current frame of the stream is processed.
+
+                \param [in] stream - an index of the stream.
+                \param [in] options - options of motion detector.
+                \return a result of the operation.
+            */
+            bool SetOptions(size_t stream, const Simd::Motion::Options & options)
+            {
+                if (stream >= _streams.size())
+                    return false;
+                std::unique_lock<std::mutex> lock(_mutex);
+                _space.wait(lock, [&] { return !_streams[stream]->busy; });
+                return _streams[stream]->detector.SetOptions(options);
+            }
+
+            /*!
+                Sets model of scene of given stream. It waits until current frame of the stream is processed.
+
+                \param [in] stream - an index of the stream.
+                \param [in] model - a model of scene.
+                \return a result of the operation.
+            */
+            bool SetModel(size_t stream, const Model & model)
+            {
+                if (stream >= _streams.size())
+                    return false;
+                std::unique_lock<std::mutex> lock(_mutex);
+                _space.wait(lock, [&] { return !_streams[stream]->busy; });
+                return _streams[stream]->detector.SetModel(model);
+            }
+
+            /*!
+                Pushes next frame of given stream to processing. The frame is copied to internal buffer.
+
+                \param [in] stream - an index of the stream.
+                \param [in] input - a next input frame of the stream.
+                \param [in] wait - a flag of back-pressure mode. If it is true then the function blocks while the stream queue is full, 
+                                   otherwise the frame is dropped. By default it is true.
+                \return a result of the operation (false if the frame was dropped).
+            */
+            bool Push(size_t stream, const Frame & input, bool wait = true)
+            {
+                if (stream >= _streams.size() || _threads.empty())
+                    return false;
+                Stream & s = *_streams[stream];
+                FramePtr frame;
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    if (!wait && (s.queue.size() >= _queueSizeMax || _stop))
+                    {
+                        _statistics.dropped++;
+                        return false;
+                    }
+                    if (s.free.size())
+                    {
+                        frame = std::move(s.free.back());
+                        s.free.pop_back();
+                    }
+                }
+                if (!frame)
+                    frame.reset(new Frame());
+                if (frame->width != input.width || frame->height != input.height || frame->format != input.format)
+                    frame->Recreate(input.Size(), input.format);
+                frame->flipped = input.flipped;
+                frame->timestamp = input.timestamp;
+                Simd::Copy(input, *frame);
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    if (wait)
+                        _space.wait(lock, [&] { return s.queue.size() < _queueSizeMax || _stop; });
+                    if (s.queue.size() >= _queueSizeMax || _stop)
+                    {
+                        s.free.push_back(std::move(frame));
+                        _statistics.dropped++;
+                        return false;
+                    }
+                    s.queue.push_back(std::move(frame));
+                    _statistics.pushed++;
+                    if (!s.busy && s.queue.size() == 1)
+                    {
+                        _ready.push_back(stream);
+                        _work.notify_one();
+                    }
+                }
+                return true;
+            }
+
+            /*!
+                Waits until all pushed frames are processed.
+            */
+            void Wait()
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _space.wait(lock, [&] { return _statistics.processed == _statistics.pushed || _stop; });
+            }
+
+            /*!
+                Gets aggregate throughput metrics.
+
+                \return current statistics.
+            */
+            Statistics GetStatistics() const
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                Statistics statistics = _statistics;
+                statistics.queued = _statistics.pushed - _statistics.processed;
+                statistics.elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - _start).count();
+                return statistics;
+            }
+
+            /*!
+                Stops work threads. Frames which are not processed yet are discarded.
+            */
+            void Stop()
+            {
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _stop = true;
+                }
+                _work.notify_all();
+                _space.notify_all();
+                for (size_t i = 0; i < _threads.size(); ++i)
+                    _threads[i].join();
+                _threads.clear();
+            }
+
+        private:
+            typedef std::unique_ptr<Frame> FramePtr;
+            typedef std::vector<FramePtr> FramePtrs;
+
+            struct Stream
+            {
+                Detector detector;
+                std::deque<FramePtr> queue;
+                FramePtrs free;
+                Metadata metadata;
+                bool busy;
+
+                Stream()
+                    : busy(false)
+                {
+                }
+            };
+            typedef std::unique_ptr<Stream> StreamPtr;
+            typedef std::vector<StreamPtr> StreamPtrs;
+
+            StreamPtrs _streams;
+            std::deque<size_t> _ready;
+            std::vector<std::thread> _threads;
+            mutable std::mutex _mutex;
+            std::condition_variable _work, _space;
+            bool _stop;
+            size_t _queueSizeMax;
+            Callback _callback;
+            Statistics _statistics;
+            std::chrono::steady_clock::time_point _start;
+
+            void Work()
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                for (;;)
+                {
+                    _work.wait(lock, [&] { return _ready.size() || _stop; });
+                    if (_stop)
+                        break;
+                    size_t index = _ready.front();
+                    _ready.pop_front();
+                    Stream & stream = *_streams[index];
+                    FramePtr frame = std::move(stream.queue.front());
+                    stream.queue.pop_front();
+                    stream.busy = true;
+                    _space.notify_all();
+                    lock.unlock();
+
+                    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                    stream.detector.NextFrame(*frame, stream.metadata);
+                    _callback(index, *frame, stream.metadata);
+                    Time time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+                    lock.lock();
+                    stream.free.push_back(std::move(frame));
+                    stream.busy = false;
+                    if (stream.queue.size())
+                    {
+                        _ready.push_back(index);
+                        _work.notify_one();
+                    }
+                    _statistics.processed++;
+                    _statistics.busy += time;
+                    _space.notify_all();
+                }
+            }
+        };
     }
 }
 
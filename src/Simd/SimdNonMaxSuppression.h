@@ -0,0 +1,55 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdNonMaxSuppression_h__
+#define __SimdNonMaxSuppression_h__
+
+#include "Simd/SimdMath.h"
+
+#include <algorithm>
+
+namespace Simd
+{
+    namespace Base
+    {
+        typedef void(*NonMaxSuppressionIouPtr)(const float * x1, const float * y1, const float * x2, const float * y2, const float * area, 
+            size_t count, const float * box, float * iou);
+
+        SIMD_INLINE float NonMaxSuppressionIou(float x1, float y1, float x2, float y2, float area, const float * box)
+        {
+            float w = std::max(std::min(box[2], x2) - std::max(box[0], x1), 0.0f);
+            float h = std::max(std::min(box[3], y2) - std::max(box[1], y1), 0.0f);
+            float inter = w * h;
+            float union_ = box[4] + area - inter;
+            return union_ > 0.0f ? inter / union_ : 0.0f;
+        }
+
+        void NonMaxSuppressionIou(const float * x1, const float * y1, const float * x2, const float * y2, const float * area, 
+            size_t count, const float * box, float * iou);
+
+        size_t NonMaxSuppressionRun(const float * boxes, float * scores, size_t count, SimdNonMaxSuppressionType type, 
+            float iouThreshold, float sigma, float scoreThreshold, size_t * indices, NonMaxSuppressionIouPtr iou);
+    }
+}
+
+#endif//__SimdNonMaxSuppression_h__
@@ -143,8 +143,47 @@ namespace Simd
         */
         void Swap(Pyramid<A> & pyramid);
 
+        /*!
+            Sets lazy mode of the pyramid.
+            In lazy mode function Simd::Build(Pyramid<A> & pyramid, ::SimdReduceType reduceType, bool compensation) does not fill upper levels of the pyramid:
+            every upper level is built at the first access to it.
+
+            \note Access to levels of the pyramid in lazy mode is not thread safe.
+
+            \param [in] lazy - a flag of lazy mode.
+        */
+        void SetLazy(bool lazy);
+
+        /*!
+            Gets lazy mode of the pyramid.
+
+            \return - true if the pyramid is in lazy mode.
+        */
+        bool Lazy() const;
+
+        /*!
+            Marks upper levels of the pyramid as outdated. They will be built (on the base of the lower level) at the first access to them.
+
+            \param [in] reduceType - a type of function used for image reducing.
+            \param [in] compensation - a flag of compensation of rounding. It is relevant only for ::SimdReduce3x3 and ::SimdReduce5x5. It is equal to 'true' by default.
+        */
+        void Defer(::SimdReduceType reduceType, bool compensation = true);
+
+        /*!
+            Checks if given level of the pyramid is actual (it does not wait for lazy building).
+
+            \param [in] level - a level of the pyramid.
+            \return - true if the level is actual.
+        */
+        bool Actual(size_t level) const;
+
     private:
+        void Update(size_t level) const;
+
         std::vector< View<A> > _views;
+        mutable std::vector<uint8_t> _outdated;
+        ::SimdReduceType _reduceType;
+        bool _compensation, _lazy;
     };
 
     /*! @ingroup cpp_pyramid_functions
@@ -167,17 +206,26 @@ namespace Simd
 
     template <template<class> class A>
     SIMD_INLINE Pyramid<A>::Pyramid()
+        : _reduceType(::SimdReduce2x2)
+        , _compensation(true)
+        , _lazy(false)
     {
     }
 
     template <template<class> class A>
     SIMD_INLINE Pyramid<A>::Pyramid(const Point<ptrdiff_t> & size, size_t levelCount)
+        : _reduceType(::SimdReduce2x2)
+        , _compensation(true)
+        , _lazy(false)
     {
         Recreate(size, levelCount);
     }
 
     template <template<class> class A>
     SIMD_INLINE Pyramid<A>::Pyramid(size_t width, size_t height, size_t levelCount)
+        : _reduceType(::SimdReduce2x2)
+        , _compensation(true)
+        , _lazy(false)
     {
         Recreate(width, height, levelCount);
     }
@@ -188,6 +236,7 @@ namespace Simd
         if (_views.size() && size == _views[0].Size())
             return;
         _views.resize(levelCount);
+        _outdated.assign(levelCount, 0);
         for (size_t level = 0; level < levelCount; ++level)
         {
             _views[level].Recreate(size, View<A>::Gray8);
@@ -210,36 +259,42 @@ namespace Simd
     template <template<class> class A>
     SIMD_INLINE View<A> & Pyramid<A>::operator [] (size_t level)
     {
+        Update(level);
         return _views[level];
     }
 
     template <template<class> class A>
     SIMD_INLINE const View<A> & Pyramid<A>::operator [] (size_t level) const
     {
+        Update(level);
         return _views[level];
     }
 
     template <template<class> class A>
     SIMD_INLINE View<A> & Pyramid<A>::At(size_t level)
     {
+        Update(level);
         return _views[level];
     }
 
     template <template<class> class A>
     SIMD_INLINE const View<A> & Pyramid<A>::At(size_t level) const
     {
+        Update(level);
         return _views[level];
     }
 
     template <template<class> class A>
     SIMD_INLINE View<A> & Pyramid<A>::Top()
     {
+        Update(_views.size() - 1);
         return _views.back();
     }
 
     template <template<class> class A>
     SIMD_INLINE const View<A> & Pyramid<A>::Top() const
     {
+        Update(_views.size() - 1);
         return _views.back();
     }
 
@@ -247,6 +302,70 @@ namespace Simd
     SIMD_INLINE void Pyramid<A>::Swap(Pyramid & pyramid)
     {
         _views.swap(pyramid._views);
+        _outdated.swap(pyramid._outdated);
+        std::swap(_reduceType, pyramid._reduceType);
+        std::swap(_compensation, pyramid._compensation);
+        std::swap(_lazy, pyramid._lazy);
+    }
+
+    template <template<class> class A>
+    SIMD_INLINE void Pyramid<A>::SetLazy(bool lazy)
+    {
+        _lazy = lazy;
+    }
+
+    template <template<class> class A>
+    SIMD_INLINE bool Pyramid<A>::Lazy() const
+    {
+        return _lazy;
+    }
+
+    template <template<class> class A>
+    SIMD_INLINE void Pyramid<A>::Defer(::SimdReduceType reduceType, bool compensation)
+    {
+        _reduceType = reduceType;
+        _compensation = compensation;
+        for (size_t level = 1; level < _outdated.size(); ++level)
+            _outdated[level] = 1;
+    }
+
+    template <template<class> class A>
+    SIMD_INLINE bool Pyramid<A>::Actual(size_t level) const
+    {
+        return _outdated[level] == 0;
+    }
+
+    template <template<class> class A>
+    SIMD_INLINE void Pyramid<A>::Update(size_t level) const
+    {
+        if (level >= _outdated.size() || _outdated[level] == 0)
+            return;
+        size_t lowest = level;
+        while (_outdated[lowest - 1])
+            lowest--;
+        for (size_t l = lowest; l <= level; ++l)
+        {
+            const View<A> & src = _views[l - 1];
+            View<A> & dst = const_cast<View<A> &>(_views[l]);
+            switch (_reduceType)
+            {
+            case ::SimdReduce2x2:
+                ::SimdReduceGray2x2(src.data, src.width, src.height, src.stride, dst.data, dst.width, dst.height, dst.stride);
+                break;
+            case ::SimdReduce3x3:
+                ::SimdReduceGray3x3(src.data, src.width, src.height, src.stride, dst.data, dst.width, dst.height, dst.stride, _compensation ? 1 : 0);
+                break;
+            case ::SimdReduce4x4:
+                ::SimdReduceGray4x4(src.data, src.width, src.height, src.stride, dst.data, dst.width, dst.height, dst.stride);
+                break;
+            case ::SimdReduce5x5:
+                ::SimdReduceGray5x5(src.data, src.width, src.height, src.stride, dst.data, dst.width, dst.height, dst.stride, _compensation ? 1 : 0);
+                break;
+            default:
+                assert(0);
+            }
+            _outdated[l] = 0;
+        }
     }
 
     // Pyramid utilities implementation:
@@ -33,6 +33,9 @@ namespace Simd
     {
         void Fill32f(float * dst, size_t size, const float * value);
 
+        void BoxFilter32f(const float * src, size_t srcStride, size_t width, size_t height, size_t channelCount,
+            size_t radiusX, size_t radiusY, float * dst, size_t dstStride, SimdBool normalize);
+
         void CosineDistance32f(const float * a, const float * b, size_t size, float * distance);
 
         void Gemm32fNN(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc);
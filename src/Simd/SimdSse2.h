@@ -106,6 +106,14 @@ namespace Simd
             uint8_t value, size_t neighborhood, uint8_t threshold, uint8_t positive, uint8_t negative,
             uint8_t * dst, size_t dstStride, SimdCompareType compareType);
 
+        void BoxFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            size_t channelCount, size_t radiusX, size_t radiusY, uint8_t * dst, size_t dstStride);
+
+        void BoxSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            size_t channelCount, size_t radiusX, size_t radiusY, uint8_t * sum, size_t sumStride);
+
+        void Canny(const uint8_t * src, size_t srcStride, size_t width, size_t height, int16_t lowThreshold, int16_t highThreshold, uint8_t * dst, size_t dstStride);
+
         void ConditionalCount8u(const uint8_t * src, size_t stride, size_t width, size_t height,
             uint8_t value, SimdCompareType compareType, uint32_t * count);
 
@@ -203,6 +211,12 @@ namespace Simd
         void MedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height,
             size_t channelCount, uint8_t * dst, size_t dstStride);
 
+        void MedianFilterSquare(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            size_t channelCount, size_t radius, uint8_t * dst, size_t dstStride);
+
+        void Morphology(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount,
+            size_t radiusX, size_t radiusY, SimdMorphologyType type, uint8_t * dst, size_t dstStride);
+
         void NeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion);
 
         void NeuralPow(const float * src, size_t size, const float * exponent, float * dst);
@@ -230,6 +244,9 @@ namespace Simd
         void ReduceGray5x5(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
             uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, int compensation);
 
+        void RemapConvertMap(const float * mapX, size_t mapXStride, const float * mapY, size_t mapYStride, size_t width, size_t height,
+            size_t srcWidth, size_t srcHeight, int16_t * map, size_t mapStride);
+
         void Reorder16bit(const uint8_t * src, size_t size, uint8_t * dst);
 
         void Reorder32bit(const uint8_t * src, size_t size, uint8_t * dst);
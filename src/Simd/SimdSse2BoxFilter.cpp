@@ -0,0 +1,207 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdBoxFilter.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        SIMD_INLINE void BoxColsAdd(const uint8_t * src, uint32_t * cols)
+        {
+            __m128i _src = _mm_loadu_si128((__m128i*)src);
+            __m128i lo = _mm_unpacklo_epi8(_src, K_ZERO), hi = _mm_unpackhi_epi8(_src, K_ZERO);
+            _mm_storeu_si128((__m128i*)cols + 0, _mm_add_epi32(_mm_loadu_si128((__m128i*)cols + 0), _mm_unpacklo_epi16(lo, K_ZERO)));
+            _mm_storeu_si128((__m128i*)cols + 1, _mm_add_epi32(_mm_loadu_si128((__m128i*)cols + 1), _mm_unpackhi_epi16(lo, K_ZERO)));
+            _mm_storeu_si128((__m128i*)cols + 2, _mm_add_epi32(_mm_loadu_si128((__m128i*)cols + 2), _mm_unpacklo_epi16(hi, K_ZERO)));
+            _mm_storeu_si128((__m128i*)cols + 3, _mm_add_epi32(_mm_loadu_si128((__m128i*)cols + 3), _mm_unpackhi_epi16(hi, K_ZERO)));
+        }
+
+        void BoxColsInit(const uint8_t * src, size_t srcStride, size_t size, size_t height, size_t radius, uint32_t * cols)
+        {
+            size_t sizeA = AlignLo(size, A);
+            memset(cols, 0, size*sizeof(uint32_t));
+            for (ptrdiff_t dy = -(ptrdiff_t)radius; dy <= (ptrdiff_t)radius; ++dy)
+            {
+                const uint8_t * s = src + Base::BoxRow(dy, height)*srcStride;
+                size_t i = 0;
+                for (; i < sizeA; i += A)
+                    BoxColsAdd(s + i, cols + i);
+                for (; i < size; ++i)
+                    cols[i] += s[i];
+            }
+        }
+
+        SIMD_INLINE void BoxColsUpdate(__m128i diff, uint32_t * cols)
+        {
+            __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(diff, diff), 16);
+            __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(diff, diff), 16);
+            _mm_storeu_si128((__m128i*)cols + 0, _mm_add_epi32(_mm_loadu_si128((__m128i*)cols + 0), lo));
+            _mm_storeu_si128((__m128i*)cols + 1, _mm_add_epi32(_mm_loadu_si128((__m128i*)cols + 1), hi));
+        }
+
+        void BoxColsUpdate(const uint8_t * add, const uint8_t * sub, size_t size, uint32_t * cols)
+        {
+            size_t sizeA = AlignLo(size, A), i = 0;
+            for (; i < sizeA; i += A)
+            {
+                __m128i _add = _mm_loadu_si128((__m128i*)(add + i));
+                __m128i _sub = _mm_loadu_si128((__m128i*)(sub + i));
+                BoxColsUpdate(_mm_sub_epi16(_mm_unpacklo_epi8(_add, K_ZERO), _mm_unpacklo_epi8(_sub, K_ZERO)), cols + i + 0);
+                BoxColsUpdate(_mm_sub_epi16(_mm_unpackhi_epi8(_add, K_ZERO), _mm_unpackhi_epi8(_sub, K_ZERO)), cols + i + HA);
+            }
+            for (; i < size; ++i)
+                cols[i] += add[i] - sub[i];
+        }
+
+        template<int channelCount> SIMD_INLINE __m128i BoxPrefixSum(__m128i value);
+
+        template<> SIMD_INLINE __m128i BoxPrefixSum<1>(__m128i value)
+        {
+            value = _mm_add_epi32(value, _mm_slli_si128(value, 4));
+            return _mm_add_epi32(value, _mm_slli_si128(value, 8));
+        }
+
+        template<> SIMD_INLINE __m128i BoxPrefixSum<2>(__m128i value)
+        {
+            return _mm_add_epi32(value, _mm_slli_si128(value, 8));
+        }
+
+        template<> SIMD_INLINE __m128i BoxPrefixSum<4>(__m128i value)
+        {
+            return value;
+        }
+
+        template<int channelCount> SIMD_INLINE __m128i BoxCarry(__m128i value);
+
+        template<> SIMD_INLINE __m128i BoxCarry<1>(__m128i value)
+        {
+            return _mm_shuffle_epi32(value, 0xFF);
+        }
+
+        template<> SIMD_INLINE __m128i BoxCarry<2>(__m128i value)
+        {
+            return _mm_shuffle_epi32(value, 0xEE);
+        }
+
+        template<> SIMD_INLINE __m128i BoxCarry<4>(__m128i value)
+        {
+            return value;
+        }
+
+        template<int channelCount> void BoxPrefixSums(const uint32_t * cols, size_t size, uint32_t * sums)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            __m128i carry = _mm_setzero_si128();
+            for (; i < sizeF; i += F)
+            {
+                __m128i sum = _mm_add_epi32(BoxPrefixSum<channelCount>(_mm_loadu_si128((__m128i*)(cols + i))), carry);
+                _mm_storeu_si128((__m128i*)(sums + channelCount + i), sum);
+                carry = BoxCarry<channelCount>(sum);
+            }
+            for (; i < size; ++i)
+                sums[i + channelCount] = sums[i] + cols[i];
+        }
+
+        void BoxRowSums(const uint32_t * cols, size_t size, size_t channelCount, size_t kernel, uint32_t * sums, uint32_t * dst)
+        {
+            size_t full = size + kernel - channelCount;
+            switch (channelCount)
+            {
+            case 1: BoxPrefixSums<1>(cols, full, sums); break;
+            case 2: BoxPrefixSums<2>(cols, full, sums); break;
+            case 4: BoxPrefixSums<4>(cols, full, sums); break;
+            default:
+                for (size_t i = 0; i < full; ++i)
+                    sums[i + channelCount] = sums[i] + cols[i];
+            }
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+            {
+                __m128i lo = _mm_loadu_si128((__m128i*)(sums + i));
+                __m128i hi = _mm_loadu_si128((__m128i*)(sums + i + kernel));
+                _mm_storeu_si128((__m128i*)(dst + i), _mm_sub_epi32(hi, lo));
+            }
+            for (; i < size; ++i)
+                dst[i] = sums[i + kernel] - sums[i];
+        }
+
+        SIMD_INLINE __m128i BoxMean(const uint32_t * sum, __m128 scale)
+        {
+            return _mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(_mm_loadu_si128((__m128i*)sum)), scale));
+        }
+
+        void BoxMean(const uint32_t * sum, size_t size, float scale, uint8_t * dst)
+        {
+            size_t sizeA = AlignLo(size, A), i = 0;
+            __m128 _scale = _mm_set1_ps(scale);
+            for (; i < sizeA; i += A)
+            {
+                __m128i lo = _mm_packs_epi32(BoxMean(sum + i + 0 * F, _scale), BoxMean(sum + i + 1 * F, _scale));
+                __m128i hi = _mm_packs_epi32(BoxMean(sum + i + 2 * F, _scale), BoxMean(sum + i + 3 * F, _scale));
+                _mm_storeu_si128((__m128i*)(dst + i), _mm_packus_epi16(lo, hi));
+            }
+            for (; i < size; ++i)
+                dst[i] = Round(float(sum[i])*scale);
+        }
+
+        template<bool mean> void BoxFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            size_t channelCount, size_t radiusX, size_t radiusY, uint8_t * dst, size_t dstStride)
+        {
+            Base::BoxBuffer<uint32_t> buffer(width, channelCount, radiusX);
+            uint32_t * cols = buffer.cols.data + buffer.border;
+            float scale = 1.0f / float((2*radiusX + 1)*(2*radiusY + 1));
+            BoxColsInit(src, srcStride, buffer.size, height, radiusY, cols);
+            for (size_t row = 0; row < height; ++row)
+            {
+                Base::BoxSetBorder(cols, width, channelCount, radiusX);
+                if (mean)
+                {
+                    BoxRowSums(buffer.cols.data, buffer.size, channelCount, buffer.kernel, buffer.sums.data, buffer.dst.data);
+                    BoxMean(buffer.dst.data, buffer.size, scale, dst);
+                }
+                else
+                    BoxRowSums(buffer.cols.data, buffer.size, channelCount, buffer.kernel, buffer.sums.data, (uint32_t*)dst);
+                if (row < height - 1)
+                    BoxColsUpdate(src + Base::BoxRow(row + radiusY + 1, height)*srcStride, src + Base::BoxRow(row - radiusY, height)*srcStride, buffer.size, cols);
+                dst += dstStride;
+            }
+        }
+
+        void BoxFilter(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            size_t channelCount, size_t radiusX, size_t radiusY, uint8_t * dst, size_t dstStride)
+        {
+            BoxFilter<true>(src, srcStride, width, height, channelCount, radiusX, radiusY, dst, dstStride);
+        }
+
+        void BoxSum(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            size_t channelCount, size_t radiusX, size_t radiusY, uint8_t * sum, size_t sumStride)
+        {
+            BoxFilter<false>(src, srcStride, width, height, channelCount, radiusX, radiusY, sum, sumStride);
+        }
+    }
+#endif//SIMD_SSE2_ENABLE
+}
@@ -0,0 +1,118 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdCanny.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdLoad.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdSse2.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        SIMD_INLINE __m128i AbsI16(__m128i value)
+        {
+            return _mm_max_epi16(value, _mm_sub_epi16(K_ZERO, value));
+        }
+
+        SIMD_INLINE void CannyMagnitude(const int16_t * dx, const int16_t * dy, int16_t * mag)
+        {
+            __m128i _dx = _mm_loadu_si128((__m128i*)dx);
+            __m128i _dy = _mm_loadu_si128((__m128i*)dy);
+            _mm_storeu_si128((__m128i*)mag, _mm_add_epi16(AbsI16(_dx), AbsI16(_dy)));
+        }
+
+        void CannyMagnitude(const int16_t * dx, const int16_t * dy, size_t width, int16_t * mag)
+        {
+            if (width < HA)
+            {
+                Base::CannyMagnitude(dx, dy, width, mag);
+                return;
+            }
+            size_t widthHA = AlignLo(width, HA);
+            for (size_t col = 0; col < widthHA; col += HA)
+                CannyMagnitude(dx + col, dy + col, mag + col);
+            if (widthHA != width)
+                CannyMagnitude(dx + width - HA, dy + width - HA, mag + width - HA);
+        }
+
+        const __m128i K16_CANNY_NUM = SIMD_MM_SET1_EPI16(Base::CANNY_TAN_NUM);
+        const __m128i K16_CANNY_DEN = SIMD_MM_SET1_EPI16(Base::CANNY_TAN_DEN);
+
+        SIMD_INLINE __m128i CannyNms(const int16_t * dx, const int16_t * dy, const int16_t * mag0, const int16_t * mag1, const int16_t * mag2, __m128i low, __m128i high)
+        {
+            __m128i _dx = _mm_loadu_si128((__m128i*)dx);
+            __m128i _dy = _mm_loadu_si128((__m128i*)dy);
+            __m128i ax = AbsI16(_dx), ay = AbsI16(_dy);
+            __m128i notHor = _mm_cmpgt_epi16(_mm_mullo_epi16(ay, K16_CANNY_DEN), _mm_mullo_epi16(ax, K16_CANNY_NUM));
+            __m128i notVer = _mm_cmpgt_epi16(_mm_mullo_epi16(ax, K16_CANNY_DEN), _mm_mullo_epi16(ay, K16_CANNY_NUM));
+            __m128i same = _mm_cmpgt_epi16(_mm_xor_si128(_dx, _dy), K_INV_ZERO);
+            __m128i n1 = Combine(same, _mm_loadu_si128((__m128i*)(mag0 - 1)), _mm_loadu_si128((__m128i*)(mag0 + 1)));
+            __m128i n2 = Combine(same, _mm_loadu_si128((__m128i*)(mag2 + 1)), _mm_loadu_si128((__m128i*)(mag2 - 1)));
+            n1 = Combine(notVer, n1, _mm_loadu_si128((__m128i*)mag0));
+            n2 = Combine(notVer, n2, _mm_loadu_si128((__m128i*)mag2));
+            n1 = Combine(notHor, n1, _mm_loadu_si128((__m128i*)(mag1 - 1)));
+            n2 = Combine(notHor, n2, _mm_loadu_si128((__m128i*)(mag1 + 1)));
+            __m128i m = _mm_loadu_si128((__m128i*)mag1);
+            __m128i edge = _mm_andnot_si128(_mm_cmpgt_epi16(n2, m), _mm_cmpgt_epi16(m, n1));
+            edge = _mm_and_si128(edge, _mm_cmpgt_epi16(m, low));
+            __m128i strong = _mm_and_si128(edge, _mm_cmpgt_epi16(m, high));
+            return _mm_sub_epi16(K_ZERO, _mm_add_epi16(edge, strong));
+        }
+
+        SIMD_INLINE void CannyNms(const int16_t * dx, const int16_t * dy, const int16_t * mag0, const int16_t * mag1, const int16_t * mag2,
+            size_t col, __m128i low, __m128i high, uint8_t * map)
+        {
+            __m128i lo = CannyNms(dx + col, dy + col, mag0 + col, mag1 + col, mag2 + col, low, high);
+            __m128i hi = CannyNms(dx + col + HA, dy + col + HA, mag0 + col + HA, mag1 + col + HA, mag2 + col + HA, low, high);
+            _mm_storeu_si128((__m128i*)(map + col), _mm_packus_epi16(lo, hi));
+        }
+
+        void CannyNms(const int16_t * dx, const int16_t * dy, const int16_t * mag0, const int16_t * mag1, const int16_t * mag2,
+            size_t width, int16_t lowThreshold, int16_t highThreshold, uint8_t * map)
+        {
+            if (width < A)
+            {
+                Base::CannyNms(dx, dy, mag0, mag1, mag2, width, lowThreshold, highThreshold, map);
+                return;
+            }
+            __m128i low = _mm_set1_epi16(lowThreshold), high = _mm_set1_epi16(highThreshold);
+            size_t widthA = AlignLo(width, A);
+            for (size_t col = 0; col < widthA; col += A)
+                CannyNms(dx, dy, mag0, mag1, mag2, col, low, high, map);
+            if (widthA != width)
+                CannyNms(dx, dy, mag0, mag1, mag2, width - A, low, high, map);
+        }
+
+        void Canny(const uint8_t * src, size_t srcStride, size_t width, size_t height, int16_t lowThreshold, int16_t highThreshold, uint8_t * dst, size_t dstStride)
+        {
+            bool sobel = width > A;
+            Base::Canny(src, srcStride, width, height, lowThreshold, highThreshold, dst, dstStride, 
+                sobel ? SobelDx : Base::SobelDx, sobel ? SobelDy : Base::SobelDy, CannyMagnitude, CannyNms);
+        }
+    }
+#endif// SIMD_SSE2_ENABLE
+}
@@ -0,0 +1,152 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdWarp.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdSse2.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        SIMD_INLINE __m128i WarpFixed(__m128 value, __m128 max)
+        {
+            value = _mm_min_ps(_mm_max_ps(value, _mm_set1_ps(-2.0f)), max);
+            __m128 fixed = _mm_add_ps(_mm_mul_ps(value, _mm_set1_ps(float(WARP_RANGE))), _mm_set1_ps(WARP_OFFSET));
+            return _mm_sub_epi32(_mm_cvttps_epi32(fixed), _mm_set1_epi32((int32_t)WARP_OFFSET));
+        }
+
+        template<bool perspective> SIMD_INLINE void WarpCoords(const float * mx, const float * my, const float * mw, 
+            __m128 rx, __m128 ry, __m128 rw, __m128 maxX, __m128 maxY, size_t x, int32_t * sx, int32_t * sy)
+        {
+            __m128 _x = _mm_add_ps(_mm_loadu_ps(mx + x), rx);
+            __m128 _y = _mm_add_ps(_mm_loadu_ps(my + x), ry);
+            if (perspective)
+            {
+                __m128 _w = _mm_add_ps(_mm_loadu_ps(mw + x), rw);
+                _x = _mm_div_ps(_x, _w);
+                _y = _mm_div_ps(_y, _w);
+            }
+            _mm_storeu_si128((__m128i*)(sx + x), WarpFixed(_x, maxX));
+            _mm_storeu_si128((__m128i*)(sy + x), WarpFixed(_y, maxY));
+        }
+
+        template<bool perspective> void WarpCoords(const float * mx, const float * my, const float * mw, float rx, float ry, float rw,
+            float maxX, float maxY, size_t width, int32_t * sx, int32_t * sy)
+        {
+            if (width < F)
+            {
+                if (perspective)
+                    Base::WarpCoordsPerspective(mx, my, mw, rx, ry, rw, maxX, maxY, width, sx, sy);
+                else
+                    Base::WarpCoordsAffine(mx, my, mw, rx, ry, rw, maxX, maxY, width, sx, sy);
+                return;
+            }
+            __m128 _rx = _mm_set1_ps(rx), _ry = _mm_set1_ps(ry), _rw = _mm_set1_ps(rw);
+            __m128 _maxX = _mm_set1_ps(maxX), _maxY = _mm_set1_ps(maxY);
+            size_t widthF = AlignLo(width, F);
+            for (size_t x = 0; x < widthF; x += F)
+                WarpCoords<perspective>(mx, my, mw, _rx, _ry, _rw, _maxX, _maxY, x, sx, sy);
+            if (widthF != width)
+                WarpCoords<perspective>(mx, my, mw, _rx, _ry, _rw, _maxX, _maxY, width - F, sx, sy);
+        }
+
+        void WarpCoordsAffine(const float * mx, const float * my, const float * mw, float rx, float ry, float rw,
+            float maxX, float maxY, size_t width, int32_t * sx, int32_t * sy)
+        {
+            WarpCoords<false>(mx, my, mw, rx, ry, rw, maxX, maxY, width, sx, sy);
+        }
+
+        void WarpCoordsPerspective(const float * mx, const float * my, const float * mw, float rx, float ry, float rw,
+            float maxX, float maxY, size_t width, int32_t * sx, int32_t * sy)
+        {
+            WarpCoords<true>(mx, my, mw, rx, ry, rw, maxX, maxY, width, sx, sy);
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void RemapPackMap(const int32_t * sx, const int32_t * sy, size_t x, size_t width, int16_t * map)
+        {
+            __m128i _mask = _mm_set1_epi32(WARP_MASK);
+            __m128i sx0 = _mm_loadu_si128((__m128i*)(sx + x + 0));
+            __m128i sx1 = _mm_loadu_si128((__m128i*)(sx + x + F));
+            __m128i sy0 = _mm_loadu_si128((__m128i*)(sy + x + 0));
+            __m128i sy1 = _mm_loadu_si128((__m128i*)(sy + x + F));
+            _mm_storeu_si128((__m128i*)(map + x), _mm_packs_epi32(_mm_srai_epi32(sx0, WARP_BITS), _mm_srai_epi32(sx1, WARP_BITS)));
+            _mm_storeu_si128((__m128i*)(map + width + x), _mm_packs_epi32(_mm_srai_epi32(sy0, WARP_BITS), _mm_srai_epi32(sy1, WARP_BITS)));
+            __m128i fx = _mm_packs_epi32(_mm_and_si128(sx0, _mask), _mm_and_si128(sx1, _mask));
+            __m128i fy = _mm_packs_epi32(_mm_and_si128(sy0, _mask), _mm_and_si128(sy1, _mask));
+            _mm_storeu_si128((__m128i*)(map + 2 * width + x), _mm_or_si128(fx, _mm_slli_epi16(fy, WARP_BITS)));
+        }
+
+        void RemapPackMap(const int32_t * sx, const int32_t * sy, size_t width, int16_t * map)
+        {
+            if (width < DF)
+            {
+                Base::RemapPackMap(sx, sy, width, map);
+                return;
+            }
+            size_t widthDF = AlignLo(width, DF);
+            for (size_t x = 0; x < widthDF; x += DF)
+                RemapPackMap(sx, sy, x, width, map);
+            if (widthDF != width)
+                RemapPackMap(sx, sy, width - DF, width, map);
+        }
+
+        void RemapConvertMap(const float * mapX, size_t mapXStride, const float * mapY, size_t mapYStride, size_t width, size_t height,
+            size_t srcWidth, size_t srcHeight, int16_t * map, size_t mapStride)
+        {
+            assert(srcWidth < INT16_MAX && srcHeight < INT16_MAX);
+            float maxX = float(srcWidth + 1), maxY = float(srcHeight + 1);
+            Array32i sx(width), sy(width);
+            for (size_t y = 0; y < height; ++y)
+            {
+                WarpCoordsAffine(mapX, mapY, NULL, 0.0f, 0.0f, 0.0f, maxX, maxY, width, sx.data, sy.data);
+                RemapPackMap(sx.data, sy.data, width, (int16_t*)((uint8_t*)map + y * mapStride));
+                mapX = (const float*)((const uint8_t*)mapX + mapXStride);
+                mapY = (const float*)((const uint8_t*)mapY + mapYStride);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        WarperCommon::WarperCommon(const WarpParam & param)
+            : Base::WarperCommon(param)
+        {
+            _coords = _param.transform == SimdWarpTransformPerspective ? WarpCoordsPerspective : WarpCoordsAffine;
+        }
+
+        //---------------------------------------------------------------------
+
+        void * WarpInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type,
+            const float * mat, SimdWarpTransformType transform, SimdWarpInterpType interp, SimdWarpBorderType border, const uint8_t * value)
+        {
+            WarpParam param(srcW, srcH, dstW, dstH, channels, type, mat, transform, interp, border, value);
+            if (!param.Valid())
+                return NULL;
+            return new WarperCommon(param);
+        }
+    }
+#endif// SIMD_SSE2_ENABLE
+}
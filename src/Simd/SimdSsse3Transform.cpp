@@ -23,6 +23,7 @@
 */
 #include "Simd/SimdDefs.h"
 #include "Simd/SimdMemory.h"
+#include "Simd/SimdTransform.h"
 
 namespace Simd
 {
@@ -198,7 +199,7 @@ namespace Simd
         template<> void TransformImageTransposeRotate0<3>(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
         {
             size_t width4 = AlignLo(width - 2, 4);
-            size_t height4 = AlignLo(height, 4);
+            size_t height4 = height > 2 ? AlignLo(height - 2, 4) : 0;
             size_t row = 0;
             for (; row < height4; row += 4)
             {
@@ -304,24 +305,25 @@ namespace Simd
             }
         }
 
-        template<size_t N> void TransformImage(const uint8_t * src, size_t srcStride, size_t width, size_t height, SimdTransformType transform, uint8_t * dst, size_t dstStride)
+        template<size_t N> Base::TransformImagePtr GetTransformImage(SimdTransformType transform)
         {
-            typedef void(*TransformImagePtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
-            static const TransformImagePtr transformImage[8] = { TransformImageRotate0<N>, TransformImageRotate90<N>, TransformImageRotate180<N>, TransformImageRotate270<N>,
+            static const Base::TransformImagePtr transformImage[8] = { TransformImageRotate0<N>, TransformImageRotate90<N>, TransformImageRotate180<N>, TransformImageRotate270<N>,
                 TransformImageTransposeRotate0<N>, TransformImageTransposeRotate90<N>, TransformImageTransposeRotate180<N>, TransformImageTransposeRotate270<N> };
-            transformImage[(int)transform](src, srcStride, width, height, dst, dstStride);
+            return transformImage[(int)transform];
         };
 
         void TransformImage(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, SimdTransformType transform, uint8_t * dst, size_t dstStride)
         {
+            Base::TransformImagePtr transformImage = NULL;
             switch (pixelSize)
             {
-            case 1: TransformImage<1>(src, srcStride, width, height, transform, dst, dstStride); break;
-            case 2: TransformImage<2>(src, srcStride, width, height, transform, dst, dstStride); break;
-            case 3: TransformImage<3>(src, srcStride, width, height, transform, dst, dstStride); break;
-            case 4: TransformImage<4>(src, srcStride, width, height, transform, dst, dstStride); break;
-            default: assert(0);
-           }
+            case 1: transformImage = GetTransformImage<1>(transform); break;
+            case 2: transformImage = GetTransformImage<2>(transform); break;
+            case 3: transformImage = GetTransformImage<3>(transform); break;
+            case 4: transformImage = GetTransformImage<4>(transform); break;
+            default: assert(0); return;
+            }
+            Base::TransformImageTiled(src, srcStride, width, height, pixelSize, transform, dst, dstStride, transformImage);
         }
     }
 #endif// SIMD_SSSE3_ENABLE
@@ -0,0 +1,47 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdTemplateMatch_h__
+#define __SimdTemplateMatch_h__
+
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        const size_t TEMPLATE_MATCH_BAND_MIN = 8;
+        const size_t TEMPLATE_MATCH_AREA_MAX = 0x8000;
+
+        typedef void(*TemplateMatchDotPtr)(const uint8_t * src, size_t srcStride, const uint8_t * tmpl, size_t tmplStride,
+            size_t tmplWidth, size_t tmplHeight, size_t width, int32_t * dot);
+
+        void TemplateMatchDot(const uint8_t * src, size_t srcStride, const uint8_t * tmpl, size_t tmplStride,
+            size_t tmplWidth, size_t tmplHeight, size_t width, int32_t * dot);
+
+        void TemplateMatchRun(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const uint8_t * tmpl, size_t tmplStride,
+            size_t tmplWidth, size_t tmplHeight, SimdTemplateMatchType type, float * dst, size_t dstStride, TemplateMatchDotPtr templateMatchDot);
+    }
+}
+
+#endif//__SimdTemplateMatch_h__
@@ -0,0 +1,307 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdWarp_h__
+#define __SimdWarp_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    const int WARP_BITS = 8;
+    const int WARP_RANGE = 1 << WARP_BITS;
+    const int WARP_MASK = WARP_RANGE - 1;
+    const int WARP_HALF = 1 << (WARP_BITS - 1);
+    const int WARP_ROUND = 1 << (2 * WARP_BITS - 1);
+    const int WARP_MARGIN = 4;
+    const float WARP_OFFSET = float(WARP_MARGIN * WARP_RANGE);
+    const size_t WARP_BAND_MIN = 16;
+
+    struct WarpParam
+    {
+        size_t srcW, srcH, dstW, dstH, channels;
+        SimdResizeChannelType type;
+        SimdWarpTransformType transform;
+        SimdWarpInterpType interp;
+        SimdWarpBorderType border;
+        double mat[9];
+        uint8_t value[4 * sizeof(float)];
+
+        WarpParam(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, 
+            SimdWarpInterpType interp, SimdWarpBorderType border, const uint8_t * value)
+        {
+            this->srcW = srcW;
+            this->srcH = srcH;
+            this->dstW = dstW;
+            this->dstH = dstH;
+            this->channels = channels;
+            this->type = type;
+            this->transform = SimdWarpTransformAffine;
+            this->interp = interp;
+            this->border = border;
+            for (size_t i = 0; i < 9; ++i)
+                this->mat[i] = i % 4 == 0 ? 1.0 : 0.0;
+            for (size_t i = 0; i < sizeof(this->value); ++i)
+                this->value[i] = value && i < PixelSize() ? value[i] : 0;
+        }
+
+        WarpParam(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type, 
+            const float * mat, SimdWarpTransformType transform, SimdWarpInterpType interp, SimdWarpBorderType border, const uint8_t * value)
+            : WarpParam(srcW, srcH, dstW, dstH, channels, type, interp, border, value)
+        {
+            this->transform = transform;
+            for (size_t i = 0; i < 6; ++i)
+                this->mat[i] = mat[i];
+            if (transform == SimdWarpTransformPerspective)
+            {
+                for (size_t i = 6; i < 9; ++i)
+                    this->mat[i] = mat[i];
+            }
+        }
+
+        SIMD_INLINE size_t PixelSize() const
+        {
+            return channels * (type == SimdResizeChannelFloat ? sizeof(float) : 1);
+        }
+
+        SIMD_INLINE bool Valid() const
+        {
+            return srcW > 0 && srcH > 0 && dstW > 0 && dstH > 0 && channels >= 1 && channels <= 4 &&
+                (type == SimdResizeChannelByte || type == SimdResizeChannelFloat);
+        }
+    };
+
+    class Warper : Deletable
+    {
+    public:
+        Warper(const WarpParam & param)
+            : _param(param)
+        {
+        }
+
+        virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride) = 0;
+
+    protected:
+        WarpParam _param;
+    };
+
+    namespace Base
+    {
+        typedef void(*WarpCoordsPtr)(const float * mx, const float * my, const float * mw, float rx, float ry, float rw, 
+            float maxX, float maxY, size_t width, int32_t * sx, int32_t * sy);
+
+        typedef void(*WarpKernelPtr)(const WarpParam & p, const uint8_t * src, size_t srcStride, const int32_t * sx, const int32_t * sy, uint8_t * dst);
+
+        SIMD_INLINE int32_t WarpFixed(float value, float max)
+        {
+            value = Simd::Min(Simd::Max(value, -2.0f), max);
+            return (int32_t)(value * WARP_RANGE + WARP_OFFSET) - (int32_t)WARP_OFFSET;
+        }
+
+        template<class T> SIMD_INLINE const T * WarpPixel(const WarpParam & p, const T * src, size_t srcStride, ptrdiff_t x, ptrdiff_t y)
+        {
+            if (p.border == SimdWarpBorderConstant && (x < 0 || y < 0 || x >= (ptrdiff_t)p.srcW || y >= (ptrdiff_t)p.srcH))
+                return (const T*)p.value;
+            x = Simd::RestrictRange<ptrdiff_t>(x, 0, p.srcW - 1);
+            y = Simd::RestrictRange<ptrdiff_t>(y, 0, p.srcH - 1);
+            return src + y * srcStride + x * p.channels;
+        }
+
+        SIMD_INLINE bool WarpTransparent(const WarpParam & p, int32_t sx, int32_t sy)
+        {
+            return p.border == SimdWarpBorderTransparent && (sx < 0 || sy < 0 || 
+                sx > int32_t(p.srcW - 1) * WARP_RANGE || sy > int32_t(p.srcH - 1) * WARP_RANGE);
+        }
+
+        SIMD_INLINE int WarpBilinear(int p00, int p01, int p10, int p11, int fx, int fy)
+        {
+            int r0 = p00 * (WARP_RANGE - fx) + p01 * fx;
+            int r1 = p10 * (WARP_RANGE - fx) + p11 * fx;
+            return (r0 * (WARP_RANGE - fy) + r1 * fy + WARP_ROUND) >> (2 * WARP_BITS);
+        }
+
+        SIMD_INLINE float WarpBilinear(float p00, float p01, float p10, float p11, float fx, float fy)
+        {
+            float r0 = p00 * (1.0f - fx) + p01 * fx;
+            float r1 = p10 * (1.0f - fx) + p11 * fx;
+            return r0 * (1.0f - fy) + r1 * fy;
+        }
+
+        struct WarpBilinearInterp
+        {
+            static SIMD_INLINE int Run(int p00, int p01, int p10, int p11, int fx, int fy)
+            {
+                return WarpBilinear(p00, p01, p10, p11, fx, fy);
+            }
+
+            static SIMD_INLINE float Run(float p00, float p01, float p10, float p11, float fx, float fy)
+            {
+                return WarpBilinear(p00, p01, p10, p11, fx, fy);
+            }
+        };
+
+        template<class T, size_t N, class Interp = WarpBilinearInterp> SIMD_INLINE void WarpBilinearPixel(const WarpParam & p, const T * src, size_t srcStride, int32_t sx, int32_t sy, T * dst)
+        {
+            if (WarpTransparent(p, sx, sy))
+                return;
+            ptrdiff_t ix = sx >> WARP_BITS, iy = sy >> WARP_BITS;
+            const T * p00, *p01, *p10, *p11;
+            if (size_t(ix) < p.srcW - 1 && size_t(iy) < p.srcH - 1)
+            {
+                p00 = src + iy * srcStride + ix * N;
+                p01 = p00 + N;
+                p10 = p00 + srcStride;
+                p11 = p10 + N;
+            }
+            else
+            {
+                p00 = WarpPixel(p, src, srcStride, ix + 0, iy + 0);
+                p01 = WarpPixel(p, src, srcStride, ix + 1, iy + 0);
+                p10 = WarpPixel(p, src, srcStride, ix + 0, iy + 1);
+                p11 = WarpPixel(p, src, srcStride, ix + 1, iy + 1);
+            }
+            int fx = sx & WARP_MASK, fy = sy & WARP_MASK;
+            for (size_t c = 0; c < N; ++c)
+            {
+                if (sizeof(T) == 1)
+                    dst[c] = (T)Interp::Run((int)p00[c], (int)p01[c], (int)p10[c], (int)p11[c], fx, fy);
+                else
+                    dst[c] = (T)Interp::Run((float)p00[c], (float)p01[c], (float)p10[c], (float)p11[c], fx * (1.0f / WARP_RANGE), fy * (1.0f / WARP_RANGE));
+            }
+        }
+
+        template<class T, size_t N> SIMD_INLINE void WarpNearestPixel(const WarpParam & p, const T * src, size_t srcStride, int32_t sx, int32_t sy, T * dst)
+        {
+            ptrdiff_t ix = (sx + WARP_HALF) >> WARP_BITS, iy = (sy + WARP_HALF) >> WARP_BITS;
+            if (size_t(ix) >= p.srcW || size_t(iy) >= p.srcH)
+            {
+                if (p.border == SimdWarpBorderTransparent)
+                    return;
+                src = WarpPixel(p, src, srcStride, ix, iy);
+            }
+            else
+                src += iy * srcStride + ix * N;
+            for (size_t c = 0; c < N; ++c)
+                dst[c] = src[c];
+        }
+
+        void WarpCoordsAffine(const float * mx, const float * my, const float * mw, float rx, float ry, float rw,
+            float maxX, float maxY, size_t width, int32_t * sx, int32_t * sy);
+
+        void WarpCoordsPerspective(const float * mx, const float * my, const float * mw, float rx, float ry, float rw,
+            float maxX, float maxY, size_t width, int32_t * sx, int32_t * sy);
+
+        WarpKernelPtr GetWarpKernel(const WarpParam & p);
+
+        SIMD_INLINE void RemapPackMap(const int32_t * sx, const int32_t * sy, size_t width, int16_t * map)
+        {
+            int16_t * ix = map, * iy = map + width;
+            uint16_t * f = (uint16_t*)(map + 2 * width);
+            for (size_t x = 0; x < width; ++x)
+            {
+                ix[x] = int16_t(sx[x] >> WARP_BITS);
+                iy[x] = int16_t(sy[x] >> WARP_BITS);
+                f[x] = uint16_t((sx[x] & WARP_MASK) | ((sy[x] & WARP_MASK) << WARP_BITS));
+            }
+        }
+
+        SIMD_INLINE void RemapUnpackMap(const int16_t * map, size_t width, int32_t * sx, int32_t * sy)
+        {
+            const int16_t * ix = map, * iy = map + width;
+            const uint16_t * f = (const uint16_t*)(map + 2 * width);
+            for (size_t x = 0; x < width; ++x)
+            {
+                sx[x] = int32_t(ix[x]) * WARP_RANGE + (f[x] & WARP_MASK);
+                sy[x] = int32_t(iy[x]) * WARP_RANGE + (f[x] >> WARP_BITS);
+            }
+        }
+
+        void Remap(const WarpParam & p, const uint8_t * src, size_t srcStride, const int16_t * map, size_t mapStride, 
+            uint8_t * dst, size_t dstStride, WarpKernelPtr kernel);
+
+        void RemapYuv420p(const uint8_t * srcY, size_t srcYStride, const uint8_t * srcU, size_t srcUStride, const uint8_t * srcV, size_t srcVStride,
+            size_t srcWidth, size_t srcHeight, const int16_t * map, size_t mapStride, size_t width, size_t height, SimdWarpBorderType border, const uint8_t * value,
+            uint8_t * dstY, size_t dstYStride, uint8_t * dstU, size_t dstUStride, uint8_t * dstV, size_t dstVStride, WarpKernelPtr kernelY, WarpKernelPtr kernelUV);
+
+        class WarperCommon : public Warper
+        {
+        public:
+            WarperCommon(const WarpParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        protected:
+            Array32f _mx, _my, _mw;
+            WarpCoordsPtr _coords;
+            WarpKernelPtr _kernel;
+        };
+
+        void * WarpInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type,
+            const float * mat, SimdWarpTransformType transform, SimdWarpInterpType interp, SimdWarpBorderType border, const uint8_t * value);
+    }
+
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        void WarpCoordsAffine(const float * mx, const float * my, const float * mw, float rx, float ry, float rw,
+            float maxX, float maxY, size_t width, int32_t * sx, int32_t * sy);
+
+        void WarpCoordsPerspective(const float * mx, const float * my, const float * mw, float rx, float ry, float rw,
+            float maxX, float maxY, size_t width, int32_t * sx, int32_t * sy);
+
+        class WarperCommon : public Base::WarperCommon
+        {
+        public:
+            WarperCommon(const WarpParam & param);
+        };
+
+        void * WarpInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type,
+            const float * mat, SimdWarpTransformType transform, SimdWarpInterpType interp, SimdWarpBorderType border, const uint8_t * value);
+    }
+#endif //SIMD_SSE2_ENABLE 
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        void WarpCoordsAffine(const float * mx, const float * my, const float * mw, float rx, float ry, float rw,
+            float maxX, float maxY, size_t width, int32_t * sx, int32_t * sy);
+
+        void WarpCoordsPerspective(const float * mx, const float * my, const float * mw, float rx, float ry, float rw,
+            float maxX, float maxY, size_t width, int32_t * sx, int32_t * sy);
+
+        Base::WarpKernelPtr GetWarpKernel(const WarpParam & p);
+
+        class WarperCommon : public Sse2::WarperCommon
+        {
+        public:
+            WarperCommon(const WarpParam & param);
+        };
+
+        void * WarpInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type,
+            const float * mat, SimdWarpTransformType transform, SimdWarpInterpType interp, SimdWarpBorderType border, const uint8_t * value);
+    }
+#endif //SIMD_AVX2_ENABLE 
+}
+
+#endif//__SimdWarp_h__
@@ -121,6 +121,7 @@ namespace Test
     TEST_ADD_GROUP_AD0(BackgroundShiftRange);
     TEST_ADD_GROUP_AD0(BackgroundShiftRangeMasked);
     TEST_ADD_GROUP_AD0(BackgroundInitMask);
+    TEST_ADD_GROUP_A00(BackgroundMixture);
 
     TEST_ADD_GROUP_AD0(BayerToBgr);
 
@@ -140,6 +141,7 @@ namespace Test
 
     TEST_ADD_GROUP_AD0(ContourMetricsMasked);
     TEST_ADD_GROUP_AD0(ContourAnchors);
+    TEST_ADD_GROUP_A00(Canny);
     TEST_ADD_GROUP_00S(ContourDetector);
 
     TEST_ADD_GROUP_AD0(Copy);
@@ -157,6 +159,8 @@ namespace Test
     TEST_ADD_GROUP_AD0(DetectionLbpDetect32fi);
     TEST_ADD_GROUP_AD0(DetectionLbpDetect16ip);
     TEST_ADD_GROUP_AD0(DetectionLbpDetect16ii);
+    TEST_ADD_GROUP_A00(DetectionSaveLoad);
+    TEST_ADD_GROUP_A00(NonMaxSuppression32f);
     TEST_ADD_GROUP_00S(Detection);
 
     TEST_ADD_GROUP_AD0(AlphaBlending);
@@ -198,15 +202,24 @@ namespace Test
     TEST_ADD_GROUP_A00(Gemm32fNN);
     TEST_ADD_GROUP_A00(Gemm32fNT);
 
+    TEST_ADD_GROUP_A00(BoxFilter);
+    TEST_ADD_GROUP_A00(BoxSum);
+    TEST_ADD_GROUP_A00(BoxFilter32f);
+
     TEST_ADD_GROUP_AD0(MeanFilter3x3);
     TEST_ADD_GROUP_AD0(MedianFilterRhomb3x3);
     TEST_ADD_GROUP_AD0(MedianFilterRhomb5x5);
     TEST_ADD_GROUP_AD0(MedianFilterSquare3x3);
     TEST_ADD_GROUP_AD0(MedianFilterSquare5x5);
+    TEST_ADD_GROUP_A00(MedianFilterSquare);
+    TEST_ADD_GROUP_A00(Morphology);
+    TEST_ADD_GROUP_A00(DistanceTransform);
     TEST_ADD_GROUP_AD0(GaussianBlur3x3);
     TEST_ADD_GROUP_AD0(AbsGradientSaturatedSum);
     TEST_ADD_GROUP_AD0(LbpEstimate);
     TEST_ADD_GROUP_AD0(NormalizeHistogram);
+    TEST_ADD_GROUP_A00(Clahe);
+
     TEST_ADD_GROUP_AD0(SobelDx);
     TEST_ADD_GROUP_AD0(SobelDxAbs);
     TEST_ADD_GROUP_AD0(SobelDy);
@@ -225,6 +238,7 @@ namespace Test
     TEST_ADD_GROUP_AD0(HogExtractFeatures);
     TEST_ADD_GROUP_AD0(HogDeinterleave);
     TEST_ADD_GROUP_AD0(HogFilterSeparable);
+    TEST_ADD_GROUP_00S(HogDetector);
 
     TEST_ADD_GROUP_AD0(HogLiteExtractFeatures);
     TEST_ADD_GROUP_AD0(HogLiteFilterFeatures);
@@ -233,10 +247,12 @@ namespace Test
     TEST_ADD_GROUP_AD0(HogLiteFilterSeparable);
     TEST_ADD_GROUP_AD0(HogLiteFindMax7x7);
     TEST_ADD_GROUP_AD0(HogLiteCreateMask);
+    TEST_ADD_GROUP_00S(HogLite);
 
     TEST_ADD_GROUP_00S(ImageMatcher);
 
     TEST_ADD_GROUP_AD0(Integral);
+    TEST_ADD_GROUP_A00(Integral32f);
 
     TEST_ADD_GROUP_AD0(InterferenceIncrement);
     TEST_ADD_GROUP_AD0(InterferenceIncrementMasked);
@@ -248,6 +264,9 @@ namespace Test
     TEST_ADD_GROUP_AD0(InterleaveBgra);
 
     TEST_ADD_GROUP_00S(Motion);
+    TEST_ADD_GROUP_00S(MotionEngine);
+    TEST_ADD_GROUP_00S(MotionYuv);
+    TEST_ADD_GROUP_00S(MotionStatistics);
 
     TEST_ADD_GROUP_AD0(NeuralConvert);
     TEST_ADD_GROUP_AD0(NeuralProductSum);
@@ -291,6 +310,9 @@ namespace Test
     TEST_ADD_GROUP_AD0(ReduceGray3x3);
     TEST_ADD_GROUP_AD0(ReduceGray4x4);
     TEST_ADD_GROUP_AD0(ReduceGray5x5);
+    TEST_ADD_GROUP_A00(PyramidBuild);
+
+    TEST_ADD_GROUP_A00(LucasKanadeTrack);
 
     TEST_ADD_GROUP_AD0(Reorder16bit);
     TEST_ADD_GROUP_AD0(Reorder32bit);
@@ -298,11 +320,16 @@ namespace Test
 
     TEST_ADD_GROUP_ADS(ResizeBilinear);
     TEST_ADD_GROUP_A00(Resizer);
+    TEST_ADD_GROUP_A00(Warp);
+    TEST_ADD_GROUP_A00(RemapConvertMap);
+    TEST_ADD_GROUP_A00(RemapBilinear);
+    TEST_ADD_GROUP_A00(RemapBilinearYuv420p);
 
     TEST_ADD_GROUP_AD0(SegmentationShrinkRegion);
     TEST_ADD_GROUP_AD0(SegmentationFillSingleHoles);
     TEST_ADD_GROUP_AD0(SegmentationChangeIndex);
     TEST_ADD_GROUP_AD0(SegmentationPropagate2x2);
+    TEST_ADD_GROUP_A00(SegmentationLabelComponents);
 
     TEST_ADD_GROUP_AD0(ShiftBilinear);
     TEST_ADD_GROUP_00S(ShiftDetectorRand);
@@ -322,6 +349,7 @@ namespace Test
     TEST_ADD_GROUP_AD0(LaplaceAbsSum);
     TEST_ADD_GROUP_AD0(ValueSquareSum);
     TEST_ADD_GROUP_AD0(CorrelationSum);
+    TEST_ADD_GROUP_A00(TemplateMatch);
 
     TEST_ADD_GROUP_AD0(StretchGray2x2);
 
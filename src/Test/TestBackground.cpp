@@ -25,6 +25,8 @@
 #include "Test/TestPerformance.h"
 #include "Test/TestData.h"
 
+#include "Simd/SimdBackgroundMixture.h"
+
 namespace Test
 {
     namespace
@@ -1138,4 +1140,127 @@ namespace Test
 
         return result;
     }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncBM
+        {
+            typedef void*(*FuncPtr)(size_t width, size_t height, size_t channels, size_t gaussians, size_t scale,
+                float learningRate, float varianceThreshold, float backgroundRatio);
+
+            FuncPtr func;
+            String description;
+
+            FuncBM(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(size_t channels, size_t gaussians, size_t scale)
+            {
+                std::stringstream ss;
+                ss << description << "[" << channels << "-" << gaussians << "-" << scale << "]";
+                description = ss.str();
+            }
+
+            void * Init(const View & src, size_t gaussians, size_t scale) const
+            {
+                return func(src.width, src.height, src.ChannelCount(), gaussians, scale, 0.05f, 6.25f, 0.7f);
+            }
+
+            void Call(void * mixture, const View & src, View & mask) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                SimdBackgroundMixtureRun(mixture, src.data, src.stride, mask.data, mask.stride);
+            }
+        };
+    }
+
+#define FUNC_BM(function) FuncBM(function, std::string(#function))
+
+    bool BackgroundMixtureAutoTest(View::Format format, size_t gaussians, size_t scale, int width, int height, FuncBM f1, FuncBM f2)
+    {
+        bool result = true;
+
+        f1.Update(View::ChannelCount(format), gaussians, scale);
+        f2.Update(View::ChannelCount(format), gaussians, scale);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View background(width, height, format, NULL, TEST_ALIGN(width)), src(width, height, format, NULL, TEST_ALIGN(width));
+        FillRandom(background, 0, 127);
+        View mask1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View mask2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        void * mixture1 = f1.Init(src, gaussians, scale);
+        void * mixture2 = f2.Init(src, gaussians, scale);
+        const size_t frames = 16, size = height / 8, steps = width / size - 1;
+        Rect block;
+        for (size_t f = 0; f < frames && result; ++f)
+        {
+            Simd::Copy(background, src);
+            if (f)
+            {
+                size_t left = f % steps * size;
+                block = Rect(left, size, left + size, size * 2);
+                Simd::Fill(src.Region(block).Ref(), 255);
+            }
+
+            f1.Call(mixture1, src, mask1);
+            f2.Call(mixture2, src, mask2);
+
+            result = result && Compare(mask1, mask2, 0, true, 32, 0, "mask");
+        }
+
+        if (result && scale == 1)
+        {
+            uint32_t inside = 0, outside = 0;
+            for (ptrdiff_t y = 0; y < height; ++y)
+            {
+                for (ptrdiff_t x = 0; x < width; ++x)
+                {
+                    if (block.Contains(x, y))
+                        inside += mask1.At<uint8_t>(x, y) ? 1 : 0;
+                    else
+                        outside += mask1.At<uint8_t>(x, y) ? 1 : 0;
+                }
+            }
+            if (inside * 10 < block.Area() * 9 || outside * 100 > width * height - block.Area())
+            {
+                TEST_LOG_SS(Error, "Wrong foreground mask: " << inside << " of " << block.Area() << " pixels inside and " << outside << " pixels outside of moving block!");
+                result = false;
+            }
+        }
+
+        SimdRelease(mixture1);
+        SimdRelease(mixture2);
+
+        return result;
+    }
+
+    bool BackgroundMixtureAutoTest(const FuncBM & f1, const FuncBM & f2)
+    {
+        bool result = true;
+
+        result = result && BackgroundMixtureAutoTest(View::Gray8, 3, 1, W, H, f1, f2);
+        result = result && BackgroundMixtureAutoTest(View::Gray8, 5, 2, W + O, H - O, f1, f2);
+        result = result && BackgroundMixtureAutoTest(View::Bgr24, 3, 1, W + O, H - O, f1, f2);
+        result = result && BackgroundMixtureAutoTest(View::Bgr24, 4, 2, W, H, f1, f2);
+        result = result && BackgroundMixtureAutoTest(View::Gray8, 1, 3, W - O, H + O, f1, f2);
+
+        return result;
+    }
+
+    bool BackgroundMixtureAutoTest()
+    {
+        bool result = true;
+
+        result = result && BackgroundMixtureAutoTest(FUNC_BM(Simd::Base::BackgroundMixtureInit), FUNC_BM(SimdBackgroundMixtureInit));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && BackgroundMixtureAutoTest(FUNC_BM(Simd::Avx2::BackgroundMixtureInit), FUNC_BM(SimdBackgroundMixtureInit));
+#endif 
+
+        return result;
+    }
 }
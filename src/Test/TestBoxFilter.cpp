@@ -0,0 +1,213 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestData.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct Func8u
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+                size_t channelCount, size_t radiusX, size_t radiusY, uint8_t * dst, size_t dstStride);
+
+            FuncPtr func;
+            String description;
+
+            Func8u(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & src, size_t channelCount, size_t radiusX, size_t radiusY, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.stride, src.width, src.height, channelCount, radiusX, radiusY, dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_8U(function) Func8u(function, #function)
+
+    bool BoxFilterAutoTest(View::Format format, int width, int height, size_t radiusX, size_t radiusY, bool sum, const Func8u & f1, const Func8u & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "]" 
+            << ColorDescription(format) << " r=[" << radiusX << ", " << radiusY << "].");
+
+        size_t channelCount = View::PixelSize(format);
+        View s(width, height, format, NULL, TEST_ALIGN(width));
+        FillRandom(s);
+
+        View d1, d2;
+        if (sum)
+        {
+            d1.Recreate(width*channelCount, height, View::Int32, NULL, TEST_ALIGN(width));
+            d2.Recreate(width*channelCount, height, View::Int32, NULL, TEST_ALIGN(width));
+        }
+        else
+        {
+            d1.Recreate(width, height, format, NULL, TEST_ALIGN(width));
+            d2.Recreate(width, height, format, NULL, TEST_ALIGN(width));
+        }
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, channelCount, radiusX, radiusY, d1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, channelCount, radiusX, radiusY, d2));
+
+        result = result && Compare(d1, d2, 0, true, 64);
+
+        return result;
+    }
+
+    bool BoxFilterAutoTest(bool sum, const Func8u & f1, const Func8u & f2)
+    {
+        bool result = true;
+
+        for (View::Format format = View::Gray8; format <= View::Bgra32; format = View::Format(format + 1))
+        {
+            result = result && BoxFilterAutoTest(format, W, H, 7, 7, sum, f1, f2);
+            result = result && BoxFilterAutoTest(format, W + O, H - O, 15, 4, sum, f1, f2);
+        }
+        result = result && BoxFilterAutoTest(View::Gray8, W, H, 30, 30, sum, f1, f2);
+
+        return result;
+    }
+
+    bool BoxFilterAutoTest()
+    {
+        bool result = true;
+
+        result = result && BoxFilterAutoTest(false, FUNC_8U(Simd::Base::BoxFilter), FUNC_8U(SimdBoxFilter));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && BoxFilterAutoTest(false, FUNC_8U(Simd::Sse2::BoxFilter), FUNC_8U(SimdBoxFilter));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && BoxFilterAutoTest(false, FUNC_8U(Simd::Avx2::BoxFilter), FUNC_8U(SimdBoxFilter));
+#endif 
+
+        return result;
+    }
+
+    bool BoxSumAutoTest()
+    {
+        bool result = true;
+
+        result = result && BoxFilterAutoTest(true, FUNC_8U(Simd::Base::BoxSum), FUNC_8U(SimdBoxSum));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && BoxFilterAutoTest(true, FUNC_8U(Simd::Sse2::BoxSum), FUNC_8U(SimdBoxSum));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && BoxFilterAutoTest(true, FUNC_8U(Simd::Avx2::BoxSum), FUNC_8U(SimdBoxSum));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct Func32f
+        {
+            typedef void(*FuncPtr)(const float * src, size_t srcStride, size_t width, size_t height, size_t channelCount,
+                size_t radiusX, size_t radiusY, float * dst, size_t dstStride, SimdBool normalize);
+
+            FuncPtr func;
+            String description;
+
+            Func32f(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & src, size_t channelCount, size_t radiusX, size_t radiusY, View & dst, SimdBool normalize) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func((float*)src.data, src.stride / sizeof(float), src.width / channelCount, src.height, channelCount, 
+                    radiusX, radiusY, (float*)dst.data, dst.stride / sizeof(float), normalize);
+            }
+        };
+    }
+
+#define FUNC_32F(function) Func32f(function, #function)
+
+    bool BoxFilter32fAutoTest(int width, int height, size_t channelCount, size_t radiusX, size_t radiusY, SimdBool normalize, const Func32f & f1, const Func32f & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "]"
+            << " c=" << channelCount << " r=[" << radiusX << ", " << radiusY << "] n=" << normalize << ".");
+
+        View s(width*channelCount, height, View::Float, NULL, TEST_ALIGN(width));
+        FillRandom32f(s, -1.0f, 1.0f);
+
+        View d1(width*channelCount, height, View::Float, NULL, TEST_ALIGN(width));
+        View d2(width*channelCount, height, View::Float, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, channelCount, radiusX, radiusY, d1, normalize));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, channelCount, radiusX, radiusY, d2, normalize));
+
+        result = result && Compare(d1, d2, EPS, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool BoxFilter32fAutoTest(const Func32f & f1, const Func32f & f2)
+    {
+        bool result = true;
+
+        result = result && BoxFilter32fAutoTest(W, H, 1, 7, 7, SimdTrue, f1, f2);
+        result = result && BoxFilter32fAutoTest(W + O, H - O, 1, 15, 4, SimdFalse, f1, f2);
+        result = result && BoxFilter32fAutoTest(W, H, 3, 3, 5, SimdTrue, f1, f2);
+        result = result && BoxFilter32fAutoTest(W - O, H + O, 2, 30, 30, SimdTrue, f1, f2);
+
+        return result;
+    }
+
+    bool BoxFilter32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && BoxFilter32fAutoTest(FUNC_32F(Simd::Base::BoxFilter32f), FUNC_32F(SimdBoxFilter32f));
+
+#ifdef SIMD_SSE_ENABLE
+        if (Simd::Sse::Enable)
+            result = result && BoxFilter32fAutoTest(FUNC_32F(Simd::Sse::BoxFilter32f), FUNC_32F(SimdBoxFilter32f));
+#endif 
+
+#ifdef SIMD_AVX_ENABLE
+        if (Simd::Avx::Enable)
+            result = result && BoxFilter32fAutoTest(FUNC_32F(Simd::Avx::BoxFilter32f), FUNC_32F(SimdBoxFilter32f));
+#endif 
+
+        return result;
+    }
+}
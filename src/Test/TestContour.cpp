@@ -208,6 +208,112 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncC
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+                int16_t lowThreshold, int16_t highThreshold, uint8_t * dst, size_t dstStride);
+
+            FuncPtr func;
+            String description;
+
+            FuncC(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & src, int16_t lowThreshold, int16_t highThreshold, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.stride, src.width, src.height, lowThreshold, highThreshold, dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_C(function) \
+    FuncC(function, std::string(#function))
+
+    bool CannyAutoTest(int width, int height, int16_t lowThreshold, int16_t highThreshold, const FuncC & f1, const FuncC & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "] <" 
+            << lowThreshold << ", " << highThreshold << ">.");
+
+        View noise(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(noise);
+        View s(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        Simd::GaussianBlur3x3(noise, s);
+
+        View d1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View d2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, lowThreshold, highThreshold, d1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, lowThreshold, highThreshold, d2));
+
+        result = result && Compare(d1, d2, 0, true, 64);
+
+        return result;
+    }
+
+    bool CannyThreadsAutoTest(int width, int height, int16_t lowThreshold, int16_t highThreshold, size_t threads, const FuncC & f)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f.description << " for 1 & " << threads << " threads [" << width << ", " << height << "] <"
+            << lowThreshold << ", " << highThreshold << ">.");
+
+        View noise(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(noise);
+        View s(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        Simd::GaussianBlur3x3(noise, s);
+
+        View d1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View d2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        size_t threadNumber = ::SimdGetThreadNumber();
+        ::SimdSetThreadNumber(1);
+        f.func(s.data, s.stride, width, height, lowThreshold, highThreshold, d1.data, d1.stride);
+        ::SimdSetThreadNumber(threads);
+        f.func(s.data, s.stride, width, height, lowThreshold, highThreshold, d2.data, d2.stride);
+        ::SimdSetThreadNumber(threadNumber);
+
+        result = result && Compare(d1, d2, 0, true, 64, 0, "threads");
+
+        return result;
+    }
+
+    bool CannyAutoTest(const FuncC & f1, const FuncC & f2)
+    {
+        bool result = true;
+
+        result = result && CannyAutoTest(W, H, 100, 300, f1, f2);
+        result = result && CannyAutoTest(W + O, H - O, 50, 150, f1, f2);
+
+        result = result && CannyThreadsAutoTest(W, H, 50, 150, 4, f1);
+        result = result && CannyThreadsAutoTest(W - O, 67, 20, 60, 7, f1);
+
+        return result;
+    }
+
+    bool CannyAutoTest()
+    {
+        bool result = true;
+
+        result = result && CannyAutoTest(FUNC_C(Simd::Base::Canny), FUNC_C(SimdCanny));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && CannyAutoTest(FUNC_C(Simd::Sse2::Canny), FUNC_C(SimdCanny));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && CannyAutoTest(FUNC_C(Simd::Avx2::Canny), FUNC_C(SimdCanny));
+#endif 
+
+        return result;
+    }
+
     //-----------------------------------------------------------------------
 
     bool ContourMetricsMaskedDataTest(bool create, int width, int height, const FuncM & f)
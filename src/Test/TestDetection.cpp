@@ -427,6 +427,120 @@ namespace Test
 
     //-----------------------------------------------------------------------
 
+    namespace
+    {
+        struct FuncL
+        {
+            typedef void * (*FuncPtr)(const char * path);
+
+            FuncPtr func;
+            String description;
+
+            FuncL(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void * Call(const String & path, const String & type) const
+            {
+                TEST_PERFORMANCE_TEST(description + "[" + type + "]");
+                return func(path.c_str());
+            }
+        };
+    }
+
+#define FUNC_L(function) FuncL(function, #function)
+
+    static void DetectionDetect(const void * data, const View & src, View & dst)
+    {
+        View sum(src.width + 1, src.height + 1, View::Int32);
+        View sqsum(src.width + 1, src.height + 1, View::Int32);
+        View tilted(src.width + 1, src.height + 1, View::Int32);
+
+        size_t w, h;
+        SimdDetectionInfoFlags flags;
+        SimdDetectionInfo(data, &w, &h, &flags);
+        bool lbp = (flags & SimdDetectionInfoFeatureMask) == SimdDetectionInfoFeatureLbp;
+
+        void * hid = SimdDetectionInit(data, sum.data, sum.stride, sum.width, sum.height,
+            sqsum.data, sqsum.stride, tilted.data, tilted.stride, 0, 0);
+        Simd::Integral(src, sum, sqsum, tilted);
+        SimdDetectionPrepare(hid);
+
+        View mask(src.Size(), View::Gray8);
+        Simd::Fill(mask, 255);
+        Simd::Fill(dst, 0);
+        (lbp ? SimdDetectionLbpDetect32fp : SimdDetectionHaarDetect32fp)(hid, mask.data, mask.stride, 
+            0, 0, src.width - w, src.height - h, dst.data, dst.stride);
+
+        SimdRelease(hid);
+    }
+
+    bool DetectionSaveLoadAutoTest(const String & path, const FuncL & f1, const FuncL & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for binary copy of cascade '" << path << "'.");
+
+        const String binary = "detection_cascade.bin";
+
+        void * xml = f1.Call(path, "xml");
+        f2.Call(path, "xml");
+        if (xml == NULL || SimdDetectionSave(xml, binary.c_str()) != SimdTrue)
+        {
+            TEST_LOG_SS(Error, "Can't save cascade '" << path << "' to '" << binary << "' !");
+            SimdRelease(xml);
+            return false;
+        }
+
+        void * bin1 = f1.Call(binary, "bin");
+        void * bin2 = f2.Call(binary, "bin");
+        if (bin1 == NULL || bin2 == NULL)
+        {
+            TEST_LOG_SS(Error, "Can't load binary cascade '" << binary << "' !");
+            result = false;
+        }
+        else
+        {
+            size_t w0, h0, w1, h1;
+            SimdDetectionInfoFlags flags0, flags1;
+            SimdDetectionInfo(xml, &w0, &h0, &flags0);
+            SimdDetectionInfo(bin1, &w1, &h1, &flags1);
+            if (w0 != w1 || h0 != h1 || flags0 != flags1)
+            {
+                TEST_LOG_SS(Error, "Binary cascade has different info: (" << w1 << ", " << h1 << ", " << flags1 << ") != (" 
+                    << w0 << ", " << h0 << ", " << flags0 << ") !");
+                result = false;
+            }
+
+            View src = GetSample(Size(W, H), false);
+            View dst0(src.Size(), View::Gray8), dst1(src.Size(), View::Gray8), dst2(src.Size(), View::Gray8);
+            DetectionDetect(xml, src, dst0);
+            DetectionDetect(bin1, src, dst1);
+            DetectionDetect(bin2, src, dst2);
+
+            result = result && Compare(dst0, dst1, 0, true, 32);
+            result = result && Compare(dst0, dst2, 0, true, 32);
+        }
+
+        SimdRelease(bin2);
+        SimdRelease(bin1);
+        SimdRelease(xml);
+        ::remove(binary.c_str());
+
+        return result;
+    }
+
+    bool DetectionSaveLoadAutoTest()
+    {
+        bool result = true;
+
+        const String cascades[3] = { "haar_face_0.xml", "haar_face_1.xml", "lbp_face.xml" };
+        for (size_t i = 0; i < 3; ++i)
+            result = result && DetectionSaveLoadAutoTest(ROOT_PATH + "/data/cascade/" + cascades[i], FUNC_L(Simd::Base::DetectionLoadA), FUNC_L(SimdDetectionLoadA));
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
     bool DetectionDetectDataTest(bool create, const String & path, int width, int height, int throughColumn, int int16, const FuncD & f)
     {
         bool result = true;
@@ -601,6 +715,136 @@ namespace Test
 #endif
     }
 
+    static bool DetectionStable(const Objects & objects, const Objects & control, const Rect & changed)
+    {
+        Objects a, b;
+        for (size_t i = 0; i < objects.size(); ++i)
+            if (!objects[i].rect.Overlaps(changed))
+                a.push_back(objects[i]);
+        for (size_t i = 0; i < control.size(); ++i)
+            if (!control[i].rect.Overlaps(changed))
+                b.push_back(control[i]);
+        if (a.size() != b.size())
+            return false;
+        for (size_t i = 0; i < a.size(); ++i)
+            if (a[i].rect != b[i].rect || a[i].weight != b[i].weight)
+                return false;
+        return true;
+    }
+
+    static bool DetectionIncrementalSpecialTest(Detection & detection)
+    {
+        bool result = true;
+
+        View src = GetSample(Size(W, H), true);
+        detection.Init(src.Size());
+
+        Objects control;
+        detection.SetIncremental(0);
+        double time = GetTime();
+        detection.Detect(src, control);
+        TEST_LOG_SS(Info, "Detect full : " << (GetTime() - time) * 1000 << " ms ");
+        if (control.empty())
+        {
+            TEST_LOG_SS(Error, "There are no detected objects at test image!");
+            return false;
+        }
+
+        Rect face = control[0].rect.Intersection(Rect(src.Size())), moved;
+        for (ptrdiff_t y = 0; y + face.Height() <= (ptrdiff_t)src.height && moved.Empty(); y += face.Height())
+        {
+            for (ptrdiff_t x = 0; x + face.Width() <= (ptrdiff_t)src.width && moved.Empty(); x += face.Width())
+            {
+                Rect r(x, y, x + face.Width(), y + face.Height());
+                bool free = true;
+                for (size_t i = 0; i < control.size() && free; ++i)
+                    free = !r.Overlaps(control[i].rect);
+                if (free)
+                    moved = r;
+            }
+        }
+        if (moved.Empty())
+        {
+            TEST_LOG_SS(Error, "There is no free place at test image to move an object!");
+            return false;
+        }
+        View changed(src.Size(), View::Gray8);
+        Simd::Copy(src, changed);
+        Simd::Copy(src.Region(face), changed.Region(moved).Ref());
+        Detection::Rects regions(1, moved);
+
+        // Cascade responses slightly depend on the whole integral image, so unchanged objects are compared with full detection of changed frame.
+        Objects reference;
+        detection.Detect(changed, reference);
+
+        const size_t slices = 4;
+        detection.SetIncremental(slices);
+        Objects objects;
+        detection.Detect(src, objects);
+        result = DetectionStable(objects, control, Rect());
+        if (!result)
+            TEST_LOG_SS(Error, "Incremental detection at first frame differs from full detection: "
+                << objects.size() << " != " << control.size() << " objects.");
+
+        bool found = false;
+        for (size_t frame = 1; frame <= slices && result; ++frame)
+        {
+            time = GetTime();
+            detection.Detect(changed, objects, 3, 0.2, true, regions);
+            TEST_LOG_SS(Info, "Detect incremental (frame " << frame << ") : " << (GetTime() - time) * 1000 << " ms ");
+
+            for (size_t i = 0; i < objects.size() && !found; ++i)
+                found = moved.Contains(objects[i].rect.Center());
+            result = DetectionStable(objects, reference, moved);
+            if (!result)
+                TEST_LOG_SS(Error, "Incremental detection at frame " << frame << " changes objects outside of motion region!");
+        }
+        if (result && !found)
+        {
+            TEST_LOG_SS(Error, "Incremental detection does not find moved object in " << slices << " frames!");
+            result = false;
+        }
+        detection.SetIncremental(0);
+
+        return result;
+    }
+
+    static bool DetectionBatchSpecialTest(Detection & detection)
+    {
+        bool result = true;
+
+        View sample = GetSample(Size(W, H), true);
+        Detection::Views src(3);
+        src[0] = sample;
+        View blurred(sample.Size(), View::Gray8), bgra(sample.Size(), View::Bgra32);
+        Simd::GaussianBlur3x3(sample, blurred);
+        Simd::GrayToBgra(sample, bgra);
+        src[1] = blurred;
+        src[2] = bgra;
+
+        std::vector<Objects> control(src.size()), objects;
+        double time = GetTime();
+        for (size_t i = 0; i < src.size(); ++i)
+            detection.Detect(src[i], control[i]);
+        TEST_LOG_SS(Info, "Detect " << src.size() << " images one by one : " << (GetTime() - time) * 1000 << " ms ");
+
+        time = GetTime();
+        detection.Detect(src, objects);
+        TEST_LOG_SS(Info, "Detect " << src.size() << " images in batch : " << (GetTime() - time) * 1000 << " ms ");
+
+        for (size_t i = 0; i < src.size() && result; ++i)
+        {
+            result = objects[i].size() == control[i].size();
+            for (size_t j = 0; j < objects[i].size() && result; ++j)
+                result = objects[i][j].rect == control[i][j].rect && objects[i][j].weight == control[i][j].weight;
+            if (!result)
+                TEST_LOG_SS(Error, "Batch detection of image " << i << " differs from single detection: "
+                    << objects[i].size() << " != " << control[i].size() << " objects.");
+        }
+
+        return result;
+    }
+
     bool DetectionSpecialTest()
     {
         Detection detection;
@@ -656,6 +900,9 @@ namespace Test
             }
         }
 
+        result = DetectionIncrementalSpecialTest(detection) && result;
+        result = DetectionBatchSpecialTest(detection) && result;
+
         return result;
     }
 }
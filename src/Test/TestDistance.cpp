@@ -0,0 +1,151 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestData.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncDT
+        {
+            typedef void(*FuncPtr)(const uint8_t * mask, size_t maskStride, size_t width, size_t height, uint8_t index, SimdDistanceType type,
+                uint8_t * dst, size_t dstStride, SimdPixelFormatType dstFormat);
+
+            FuncPtr func;
+            String description;
+
+            FuncDT(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(SimdDistanceType type, View::Format format)
+            {
+                const char * names[] = { "Euclidean", "Chamfer3x3", "Chamfer5x5" };
+                description = description + "[" + names[type] + (format == View::Float ? "-32f" : "-16u") + "]";
+            }
+
+            void Call(const View & mask, uint8_t index, SimdDistanceType type, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(mask.data, mask.stride, mask.width, mask.height, index, type, dst.data, dst.stride, (SimdPixelFormatType)dst.format);
+            }
+        };
+    }
+
+#define FUNC_DT(function) FuncDT(function, #function)
+
+    static void FillSparseMask(View & mask, uint8_t index, int density)
+    {
+        for (size_t y = 0; y < mask.height; ++y)
+            for (size_t x = 0; x < mask.width; ++x)
+                mask.At<uint8_t>(x, y) = Random(1000) < density ? index : 0;
+    }
+
+    static bool DistanceEuclideanReferenceCheck(const View & mask, uint8_t index, const View & dst)
+    {
+        std::vector<Point> features;
+        for (ptrdiff_t y = 0; y < (ptrdiff_t)mask.height; ++y)
+            for (ptrdiff_t x = 0; x < (ptrdiff_t)mask.width; ++x)
+                if (mask.At<uint8_t>(x, y) == index)
+                    features.push_back(Point(x, y));
+        for (ptrdiff_t y = 0; y < (ptrdiff_t)mask.height; ++y)
+        {
+            for (ptrdiff_t x = 0; x < (ptrdiff_t)mask.width; ++x)
+            {
+                ptrdiff_t best = PTRDIFF_MAX;
+                for (size_t i = 0; i < features.size(); ++i)
+                    best = Simd::Min(best, Simd::Square(features[i].x - x) + Simd::Square(features[i].y - y));
+                float value = dst.At<float>(x, y);
+                if (features.empty() ? value != FLT_MAX : value != (float)::sqrt(double(best)))
+                {
+                    TEST_LOG_SS(Error, "Wrong Euclidean distance at [" << x << ", " << y << "]: " << value << ".");
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    bool DistanceTransformAutoTest(int width, int height, SimdDistanceType type, View::Format format, int density, FuncDT f1, FuncDT f2)
+    {
+        bool result = true;
+
+        f1.Update(type, format);
+        f2.Update(type, format);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        const uint8_t index = 1;
+        View mask(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillSparseMask(mask, index, density);
+
+        View d1(width, height, format, NULL, TEST_ALIGN(width));
+        View d2(width, height, format, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(mask, index, type, d1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(mask, index, type, d2));
+
+        result = result && Compare(d1, d2, 0, true, 64);
+
+        if (result && type == SimdDistanceEuclidean && format == View::Float)
+        {
+            View m(W / 8, H / 8, View::Gray8, NULL, TEST_ALIGN(W));
+            View d(m.width, m.height, View::Float, NULL, TEST_ALIGN(W));
+            FillSparseMask(m, index, density);
+            f1.Call(m, index, type, d);
+            result = result && DistanceEuclideanReferenceCheck(m, index, d);
+        }
+
+        return result;
+    }
+
+    bool DistanceTransformAutoTest(const FuncDT & f1, const FuncDT & f2)
+    {
+        bool result = true;
+
+        for (int type = SimdDistanceEuclidean; type <= SimdDistanceChamfer5x5; ++type)
+        {
+            result = result && DistanceTransformAutoTest(W, H, (SimdDistanceType)type, View::Float, 2, f1, f2);
+            result = result && DistanceTransformAutoTest(W + O, H - O, (SimdDistanceType)type, View::Int16, 20, f1, f2);
+        }
+        result = result && DistanceTransformAutoTest(W - O, H + O, SimdDistanceEuclidean, View::Float, 0, f1, f2);
+
+        return result;
+    }
+
+    bool DistanceTransformAutoTest()
+    {
+        bool result = true;
+
+        result = result && DistanceTransformAutoTest(FUNC_DT(Simd::Base::DistanceTransform), FUNC_DT(SimdDistanceTransform));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && DistanceTransformAutoTest(FUNC_DT(Simd::Avx2::DistanceTransform), FUNC_DT(SimdDistanceTransform));
+#endif 
+
+        return result;
+    }
+}
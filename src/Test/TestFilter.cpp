@@ -263,6 +263,140 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncR
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t radius, uint8_t * dst, size_t dstStride);
+
+            FuncPtr func;
+            String description;
+
+            FuncR(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & src, size_t radius, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.stride, src.width, src.height, View::PixelSize(src.format), radius, dst.data, dst.stride);
+            }
+        };
+    }
+
+#define ARGS_R(format, width, height, radius, function1, function2) \
+    format, width, height, radius, \
+    FuncR(function1.func, function1.description + ColorDescription(format) + "[" + ToString(radius) + "]"), \
+    FuncR(function2.func, function2.description + ColorDescription(format) + "[" + ToString(radius) + "]")
+
+#define FUNC_R(function) \
+    FuncR(function, std::string(#function))
+
+    uint8_t MedianFilterSquareReference(const View & src, size_t x, size_t y, size_t c, size_t radius)
+    {
+        std::vector<uint8_t> window;
+        ptrdiff_t r = (ptrdiff_t)radius, w = (ptrdiff_t)src.width, h = (ptrdiff_t)src.height, channels = View::PixelSize(src.format);
+        for (ptrdiff_t dy = -r; dy <= r; ++dy)
+        {
+            ptrdiff_t sy = Simd::RestrictRange<ptrdiff_t>((ptrdiff_t)y + dy, 0, h - 1);
+            for (ptrdiff_t dx = -r; dx <= r; ++dx)
+            {
+                ptrdiff_t sx = Simd::RestrictRange<ptrdiff_t>((ptrdiff_t)x + dx, 0, w - 1);
+                window.push_back(src.data[sy*src.stride + sx*channels + c]);
+            }
+        }
+        std::nth_element(window.begin(), window.begin() + window.size() / 2, window.end());
+        return window[window.size() / 2];
+    }
+
+    bool MedianFilterSquareCheck(const View & src, size_t radius, const View & dst)
+    {
+        std::vector<size_t> xs, ys;
+        size_t r = radius, w = src.width, h = src.height, channels = View::PixelSize(src.format);
+        size_t points[] = { 0, 1, r, r + 1, w / 2, w - r - 1, w - r, w - 2, w - 1 };
+        for (size_t i = 0; i < sizeof(points) / sizeof(points[0]); ++i)
+            if (points[i] < w)
+                xs.push_back(points[i]);
+        size_t rows[] = { 0, 1, r, r + 1, h / 2, h - r - 1, h - r, h - 2, h - 1 };
+        for (size_t i = 0; i < sizeof(rows) / sizeof(rows[0]); ++i)
+            if (rows[i] < h)
+                ys.push_back(rows[i]);
+        for (size_t iy = 0; iy < ys.size(); ++iy)
+        {
+            for (size_t ix = 0; ix < xs.size(); ++ix)
+            {
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    size_t x = xs[ix], y = ys[iy];
+                    uint8_t expected = MedianFilterSquareReference(src, x, y, c, radius);
+                    uint8_t actual = dst.data[y*dst.stride + x*channels + c];
+                    if (actual != expected)
+                    {
+                        TEST_LOG_SS(Error, "Wrong median at [" << x << ", " << y << ", " << c << "]: " << (int)actual << " != " << (int)expected << " (brute force)!");
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    bool RadiusFilterAutoTest(View::Format format, int width, int height, size_t radius, const FuncR & f1, const FuncR & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View s(width, height, format, NULL, TEST_ALIGN(width));
+        FillRandom(s);
+
+        View d1(width, height, format, NULL, TEST_ALIGN(width));
+        View d2(width, height, format, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, radius, d1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, radius, d2));
+
+        result = result && Compare(d1, d2, 0, true, 64);
+
+        result = result && MedianFilterSquareCheck(s, radius, d1);
+
+        return result;
+    }
+
+    bool RadiusFilterAutoTest(const FuncR & f1, const FuncR & f2)
+    {
+        bool result = true;
+
+        for (View::Format format = View::Gray8; format <= View::Bgra32; format = View::Format(format + 1))
+        {
+            result = result && RadiusFilterAutoTest(ARGS_R(format, W, H, 1, f1, f2));
+            result = result && RadiusFilterAutoTest(ARGS_R(format, W, H, 3, f1, f2));
+            result = result && RadiusFilterAutoTest(ARGS_R(format, W + O, H - O, 7, f1, f2));
+            result = result && RadiusFilterAutoTest(ARGS_R(format, 19, 15, 10, f1, f2));
+            result = result && RadiusFilterAutoTest(ARGS_R(format, W - O, 7, 127, f1, f2));
+        }
+
+        return result;
+    }
+
+    bool MedianFilterSquareAutoTest()
+    {
+        bool result = true;
+
+        result = result && RadiusFilterAutoTest(FUNC_R(Simd::Base::MedianFilterSquare), FUNC_R(SimdMedianFilterSquare));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && RadiusFilterAutoTest(FUNC_R(Simd::Sse2::MedianFilterSquare), FUNC_R(SimdMedianFilterSquare));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && RadiusFilterAutoTest(FUNC_R(Simd::Avx2::MedianFilterSquare), FUNC_R(SimdMedianFilterSquare));
+#endif 
+
+        return result;
+    }
+
     bool GaussianBlur3x3AutoTest()
     {
         bool result = true;
@@ -437,6 +571,199 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncCl
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t tilesX, size_t tilesY, float clipLimit, uint8_t * dst, size_t dstStride);
+
+            FuncPtr func;
+            String description;
+
+            FuncCl(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & src, size_t tilesX, size_t tilesY, float clipLimit, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.stride, src.width, src.height, tilesX, tilesY, clipLimit, dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_CL(function) \
+    FuncCl(function, std::string(#function))
+
+    static void ClaheReferenceAxis(size_t pos, size_t size, size_t tiles, size_t & i0, size_t & i1, double & w)
+    {
+        std::vector<double> centers(tiles);
+        for (size_t t = 0; t < tiles; ++t)
+            centers[t] = double(t * size / tiles + (t + 1) * size / tiles - 1) / 2.0;
+        i0 = 0, i1 = 0, w = 0.0;
+        if (pos <= centers[0])
+            return;
+        if (pos >= centers[tiles - 1])
+        {
+            i0 = i1 = tiles - 1;
+            return;
+        }
+        while (i0 + 1 < tiles && centers[i0 + 1] <= pos)
+            i0++;
+        i1 = i0 + 1;
+        w = (pos - centers[i0]) / (centers[i1] - centers[i0]);
+    }
+
+    void ClaheReference(const View & src, size_t tilesX, size_t tilesY, float clipLimit, View & dst)
+    {
+        size_t width = src.width, height = src.height;
+        std::vector<double> luts(tilesX * tilesY * 256);
+        for (size_t ty = 0; ty < tilesY; ++ty)
+        {
+            for (size_t tx = 0; tx < tilesX; ++tx)
+            {
+                size_t x0 = tx * width / tilesX, x1 = (tx + 1) * width / tilesX;
+                size_t y0 = ty * height / tilesY, y1 = (ty + 1) * height / tilesY;
+                double histogram[256] = { 0 }, area = double((x1 - x0) * (y1 - y0));
+                for (size_t y = y0; y < y1; ++y)
+                    for (size_t x = x0; x < x1; ++x)
+                        histogram[src.At<uint8_t>(x, y)] += 1.0;
+                double clip = clipLimit > 0.0f ? std::max(1.0, ::floor(clipLimit * area / 256)) : area, excess = 0.0;
+                for (size_t i = 0; i < 256; ++i)
+                {
+                    excess += std::max(histogram[i] - clip, 0.0);
+                    histogram[i] = std::min(histogram[i], clip);
+                }
+                double * lut = luts.data() + (ty * tilesX + tx) * 256, sum = 0.0;
+                for (size_t i = 0; i < 256; ++i)
+                {
+                    sum += histogram[i] + excess / 256;
+                    lut[i] = std::min(::floor(sum * 255.0 / area + 0.5), 255.0);
+                }
+            }
+        }
+        for (size_t y = 0; y < height; ++y)
+        {
+            size_t j0, j1;
+            double wy;
+            ClaheReferenceAxis(y, height, tilesY, j0, j1, wy);
+            for (size_t x = 0; x < width; ++x)
+            {
+                size_t i0, i1;
+                double wx;
+                ClaheReferenceAxis(x, width, tilesX, i0, i1, wx);
+                size_t v = src.At<uint8_t>(x, y);
+                double top = luts[(j0 * tilesX + i0) * 256 + v] * (1.0 - wx) + luts[(j0 * tilesX + i1) * 256 + v] * wx;
+                double bottom = luts[(j1 * tilesX + i0) * 256 + v] * (1.0 - wx) + luts[(j1 * tilesX + i1) * 256 + v] * wx;
+                dst.At<uint8_t>(x, y) = (uint8_t)::floor(top * (1.0 - wy) + bottom * wy + 0.5);
+            }
+        }
+    }
+
+    void HistogramEqualizationReference(const View & src, View & dst)
+    {
+        uint64_t histogram[256] = { 0 }, area = src.width * src.height, sum = 0;
+        for (size_t y = 0; y < src.height; ++y)
+            for (size_t x = 0; x < src.width; ++x)
+                histogram[src.At<uint8_t>(x, y)]++;
+        uint8_t lut[256];
+        for (size_t i = 0; i < 256; ++i)
+        {
+            sum += histogram[i];
+            lut[i] = uint8_t((sum * 255 + area / 2) / area);
+        }
+        for (size_t y = 0; y < src.height; ++y)
+            for (size_t x = 0; x < src.width; ++x)
+                dst.At<uint8_t>(x, y) = lut[src.At<uint8_t>(x, y)];
+    }
+
+    bool ClaheAutoTest(int width, int height, size_t tilesX, size_t tilesY, float clipLimit, const FuncCl & f1, const FuncCl & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "] tiles: " 
+            << tilesX << "x" << tilesY << ", clip: " << clipLimit << ".");
+
+        View s(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(s);
+
+        View d1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View d2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, tilesX, tilesY, clipLimit, d1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, tilesX, tilesY, clipLimit, d2));
+
+        result = result && Compare(d1, d2, 0, true, 64);
+
+        View d3(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        ClaheReference(s, tilesX, tilesY, clipLimit, d3);
+        result = result && Compare(d1, d3, 2, true, 64, 0, "reference");
+
+        return result;
+    }
+
+    bool ClaheSpecialCasesAutoTest(int width, int height, const FuncCl & f)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f.description << " special cases [" << width << ", " << height << "].");
+
+        View s(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View d1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View d2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        FillRandom(s);
+        f.Call(s, 1, 1, 0.0f, d1);
+        HistogramEqualizationReference(s, d2);
+        result = result && Compare(d1, d2, 0, true, 64, 0, "global equalization");
+
+        size_t tiles = 8, w = width / tiles * tiles, h = height / tiles * tiles;
+        View c(w, h, View::Gray8, NULL, TEST_ALIGN(w));
+        View d3(w, h, View::Gray8, NULL, TEST_ALIGN(w));
+        Simd::Fill(c, 77);
+        f.Call(c, tiles, tiles, 2.0f, d3);
+        for (size_t y = 0; y < h && result; ++y)
+        {
+            for (size_t x = 0; x < w && result; ++x)
+            {
+                if (d3.At<uint8_t>(x, y) != d3.At<uint8_t>(0, 0))
+                {
+                    TEST_LOG_SS(Error, "Constant image is mapped to non constant at [" << x << ", " << y << "]: " 
+                        << (int)d3.At<uint8_t>(x, y) << " != " << (int)d3.At<uint8_t>(0, 0) << " !");
+                    result = false;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    bool ClaheAutoTest(const FuncCl & f1, const FuncCl & f2)
+    {
+        bool result = true;
+
+        result = result && ClaheAutoTest(W, H, 8, 8, 40.0f, f1, f2);
+        result = result && ClaheAutoTest(W + O, H - O, 5, 3, 2.0f, f1, f2);
+        result = result && ClaheAutoTest(W - O, H + O, 1, 1, 0.0f, f1, f2);
+
+        result = result && ClaheSpecialCasesAutoTest(W + O, H - O, f1);
+
+        return result;
+    }
+
+    bool ClaheAutoTest()
+    {
+        bool result = true;
+
+        result = result && ClaheAutoTest(FUNC_CL(Simd::Base::Clahe), FUNC_CL(SimdClahe));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && ClaheAutoTest(FUNC_CL(Simd::Avx2::Clahe), FUNC_CL(SimdClahe));
+#endif 
+
+        return result;
+    }
+
     bool SobelDxAutoTest()
     {
         bool result = true;
@@ -615,3 +615,102 @@ namespace Test
         return result;
     }
 }
+
+//-----------------------------------------------------------------------
+
+#include "Simd/SimdHog.hpp"
+
+namespace Test
+{
+    bool HogDetectorSpecialTest()
+    {
+        typedef Simd::HogDetector<Simd::Allocator> HogDetector;
+
+        bool result = true;
+
+        View image;
+        String path = ROOT_PATH + "/data/image/face/lena.pgm";
+        if (!image.Load(path))
+        {
+            TEST_LOG_SS(Error, "Can't load test image '" << path << "' !");
+            return false;
+        }
+
+        const HogDetector::Size window(8, 16);
+        const size_t length = window.x * window.y * HogDetector::FEATURES;
+        const float bias = -0.5f, one = 1.0f;
+        Buffer32f weights(length);
+        FillRandom(weights, -1.0f, 1.0f);
+
+        HogDetector detector;
+        if (!detector.SetModel(weights.data(), window, bias) || !detector.Init(image.Size(), 1.2))
+        {
+            TEST_LOG_SS(Error, "Can't initialize HogDetector!");
+            return false;
+        }
+
+        HogDetector::Objects objects;
+        double time = GetTime();
+        detector.Detect(image, objects, -FLT_MAX, 1.0f);
+        TEST_LOG_SS(Info, "Detect (all windows) : " << objects.size() << " windows, " << (GetTime() - time) * 1000 << " ms ");
+
+        const size_t cellsX = image.width / HogDetector::CELL, cellsY = image.height / HogDetector::CELL;
+        const size_t mapX = cellsX - window.x + 1, mapY = cellsY - window.y + 1;
+        if (objects.size() < mapX * mapY)
+        {
+            TEST_LOG_SS(Error, "There are only " << objects.size() << " windows instead of " << mapX * mapY << " at the first level!");
+            return false;
+        }
+
+        Buffer32f features(cellsX * cellsY * HogDetector::FEATURES), buffer(length);
+        Simd::HogExtractFeatures(image.Region(0, 0, cellsX * HogDetector::CELL, cellsY * HogDetector::CELL), features.data());
+        time = GetTime();
+        size_t errors = 0;
+        for (size_t y = 0; y < mapY; ++y)
+        {
+            for (size_t x = 0; x < mapX; ++x)
+            {
+                for (ptrdiff_t row = 0; row < window.y; ++row)
+                {
+                    const float * src = features.data() + ((y + row) * cellsX + x) * HogDetector::FEATURES;
+                    std::copy(src, src + window.x * HogDetector::FEATURES, buffer.data() + row * window.x * HogDetector::FEATURES);
+                }
+                float sum;
+                SimdSvmSumLinear(buffer.data(), weights.data(), &one, length, 1, &sum);
+                sum += bias;
+
+                const HogDetector::Object & object = objects[y * mapX + x];
+                Rect rect(x * HogDetector::CELL, y * HogDetector::CELL, (x + window.x) * HogDetector::CELL, (y + window.y) * HogDetector::CELL);
+                if (object.rect != rect || ::fabs(object.score - sum) > 0.001f * std::max(1.0f, ::fabs(sum)))
+                {
+                    if (errors++ < 8)
+                        TEST_LOG_SS(Error, "Window [" << x << ", " << y << "]: score " << object.score << " instead of " << sum << " !");
+                }
+            }
+        }
+        TEST_LOG_SS(Info, "Window by window evaluation of the first level : " << (GetTime() - time) * 1000 << " ms ");
+        if (errors)
+        {
+            TEST_LOG_SS(Error, "There are " << errors << " windows with wrong score!");
+            result = false;
+        }
+
+        time = GetTime();
+        detector.Detect(image, objects, 0.0f, 0.5f);
+        TEST_LOG_SS(Info, "Detect (grouped) : " << objects.size() << " objects, " << (GetTime() - time) * 1000 << " ms ");
+        for (size_t i = 0; i < objects.size() && result; ++i)
+        {
+            for (size_t j = 0; j < i && result; ++j)
+            {
+                Rect a = objects[i].rect, b = objects[j].rect, c = a.Intersection(b);
+                if (c.Area() * 3 > a.Area() + b.Area())
+                {
+                    TEST_LOG_SS(Error, "Grouped objects " << j << " and " << i << " overlap!");
+                    result = false;
+                }
+            }
+        }
+
+        return result;
+    }
+}
@@ -1132,3 +1132,188 @@ namespace Test
         return HogLiteCreateMaskDataTest(create, DW, DH, 7, 2, 0.5f, FUNC_HLCM(SimdHogLiteCreateMask));
     }
 }
+
+//-----------------------------------------------------------------------
+
+#include "Simd/SimdHogLite.hpp"
+
+namespace Test
+{
+    typedef Simd::HogLite<Simd::Allocator> HogLite;
+
+    static void RandomFilter(HogLite::Filter & filter, ptrdiff_t width, ptrdiff_t height, size_t featureSize)
+    {
+        filter.size = HogLite::Size(width, height);
+        filter.weights.resize(width * height * featureSize);
+        for (size_t i = 0; i < filter.weights.size(); ++i)
+            filter.weights[i] = float(Random(2001) - 1000) / 10000.0f;
+    }
+
+    static float Response(const HogLite::Features & features, size_t featureSize, const HogLite::Filter & filter, ptrdiff_t x, ptrdiff_t y)
+    {
+        float sum = 0;
+        for (ptrdiff_t dy = 0; dy < filter.size.y; ++dy)
+        {
+            for (ptrdiff_t dx = 0; dx < filter.size.x; ++dx)
+            {
+                ptrdiff_t sx = x + dx, sy = y + dy;
+                if (sx < 0 || sx >= features.size.x || sy < 0 || sy >= features.size.y)
+                    continue;
+                const float * src = features.data + sy * features.stride + sx * featureSize;
+                const float * weights = filter.weights.data() + (dy * filter.size.x + dx) * featureSize;
+                for (size_t i = 0; i < featureSize; ++i)
+                    sum += src[i] * weights[i];
+            }
+        }
+        return sum;
+    }
+
+    static float PartScore(const HogLite::Features & parts, size_t featureSize, const HogLite::Part & part, ptrdiff_t x, ptrdiff_t y, ptrdiff_t dx, ptrdiff_t dy)
+    {
+        const ptrdiff_t half = HogLite::CELL / 2, D = HogLite::DISPLACEMENT;
+        // Root cell x starts at pixel (x + 1) * CELL, part cell p starts at pixel (p + 1) * CELL / 2.
+        ptrdiff_t px = ((x + 1) * HogLite::CELL + (part.anchor.x + dx) * half) / half - 1;
+        ptrdiff_t py = ((y + 1) * HogLite::CELL + (part.anchor.y + dy) * half) / half - 1;
+        return Response(parts, featureSize, part.filter, px, py) - part.deformation[(dy + D) * 7 + dx + D];
+    }
+
+    static float PartBest(const HogLite::Features & parts, size_t featureSize, const HogLite::Part & part, ptrdiff_t x, ptrdiff_t y)
+    {
+        float best = -FLT_MAX;
+        for (ptrdiff_t dy = -HogLite::DISPLACEMENT; dy <= HogLite::DISPLACEMENT; ++dy)
+            for (ptrdiff_t dx = -HogLite::DISPLACEMENT; dx <= HogLite::DISPLACEMENT; ++dx)
+                best = std::max(best, PartScore(parts, featureSize, part, x, y, dx, dy));
+        return best;
+    }
+
+    static float Score(const HogLite & hogLite, const HogLite::Model & model, size_t level, ptrdiff_t x, ptrdiff_t y)
+    {
+        size_t featureSize = model.pca.empty() ? HogLite::FEATURES : HogLite::COMPRESSED;
+        float score = Response(hogLite.RootFeatures(level), featureSize, model.root, x, y) + model.bias;
+        HogLite::Features parts = hogLite.PartFeatures(level);
+        for (size_t i = 0; i < model.parts.size(); ++i)
+            score += PartBest(parts, featureSize, model.parts[i], x, y);
+        return score;
+    }
+
+    static bool PartPlaced(const HogLite & hogLite, const HogLite::Model & model, const HogLite::Peak & peak, ptrdiff_t x, ptrdiff_t y, size_t i)
+    {
+        size_t featureSize = model.pca.empty() ? HogLite::FEATURES : HogLite::COMPRESSED;
+        HogLite::Features parts = hogLite.PartFeatures(peak.level);
+        const HogLite::Part & part = model.parts[i];
+        const ptrdiff_t half = HogLite::CELL / 2;
+        ptrdiff_t dx = Simd::Round((peak.parts[i].left / peak.scale - (x + 1) * HogLite::CELL) / half) - part.anchor.x;
+        ptrdiff_t dy = Simd::Round((peak.parts[i].top / peak.scale - (y + 1) * HogLite::CELL) / half) - part.anchor.y;
+        if (std::abs(dx) > HogLite::DISPLACEMENT || std::abs(dy) > HogLite::DISPLACEMENT)
+            return false;
+        float best = PartBest(parts, featureSize, part, x, y);
+        return PartScore(parts, featureSize, part, x, y, dx, dy) >= best - 0.001f * std::max(1.0f, ::fabs(best));
+    }
+
+    bool HogLiteSpecialTest(bool pca, float rootThreshold)
+    {
+        bool result = true;
+
+        View image;
+        String path = ROOT_PATH + "/data/image/face/lena.pgm";
+        if (!image.Load(path))
+        {
+            TEST_LOG_SS(Error, "Can't load test image '" << path << "' !");
+            return false;
+        }
+
+        HogLite::Model model;
+        size_t featureSize = HogLite::FEATURES;
+        if (pca)
+        {
+            model.pca.resize(HogLite::FEATURES * HogLite::COMPRESSED);
+            for (size_t i = 0; i < model.pca.size(); ++i)
+                model.pca[i] = float(Random(2001) - 1000) / 1000.0f;
+            featureSize = HogLite::COMPRESSED;
+        }
+        RandomFilter(model.root, 6, 6, featureSize);
+        for (size_t i = 0; i < 4; ++i)
+        {
+            HogLite::Part part;
+            RandomFilter(part.filter, 4, 4, featureSize);
+            part.anchor = HogLite::Point(i % 2 * 6 + 1, i / 2 * 6 + 1);
+            for (size_t j = 0; j < 49; ++j)
+            {
+                ptrdiff_t dx = ptrdiff_t(j % 7) - 3, dy = ptrdiff_t(j / 7) - 3;
+                part.deformation[j] = float(dx * dx + dy * dy) * 0.01f;
+            }
+            model.parts.push_back(part);
+        }
+        model.bias = -0.5f;
+
+        HogLite hogLite;
+        if (!hogLite.SetModel(model) || !hogLite.Init(image.Size(), 4))
+        {
+            TEST_LOG_SS(Error, "Can't initialize HogLite!");
+            return false;
+        }
+
+        HogLite::Peaks peaks;
+        double time = GetTime();
+        hogLite.Detect(image, peaks, -FLT_MAX, rootThreshold);
+        TEST_LOG_SS(Info, "HogLite (pca = " << pca << ", rootThreshold = " << rootThreshold << ") : " << hogLite.Levels() << " levels, " 
+            << peaks.size() << " peaks, " << (GetTime() - time) * 1000 << " ms ");
+        if (peaks.empty())
+        {
+            TEST_LOG_SS(Error, "There are no peaks!");
+            return false;
+        }
+
+        size_t errors = 0;
+        for (size_t i = 0; i < peaks.size(); ++i)
+        {
+            const HogLite::Peak & peak = peaks[i];
+            if (i && peak.score > peaks[i - 1].score)
+            {
+                TEST_LOG_SS(Error, "Peaks are not sorted by score!");
+                result = false;
+                break;
+            }
+            if (peak.scale != hogLite.Scale(peak.level) || peak.parts.size() != model.parts.size())
+            {
+                TEST_LOG_SS(Error, "Peak " << i << " has wrong scale or parts!");
+                result = false;
+                break;
+            }
+            ptrdiff_t x = Simd::Round(peak.rect.left / peak.scale / HogLite::CELL) - 1;
+            ptrdiff_t y = Simd::Round(peak.rect.top / peak.scale / HogLite::CELL) - 1;
+            float score = Score(hogLite, model, peak.level, x, y);
+            if (::fabs(peak.score - score) > 0.001f * std::max(1.0f, ::fabs(score)))
+            {
+                if (errors++ < 8)
+                    TEST_LOG_SS(Error, "Peak " << i << " at level " << peak.level << " [" << x << ", " << y << "]: score " << peak.score << " instead of " << score << " !");
+            }
+            for (size_t j = 0; j < model.parts.size(); ++j)
+            {
+                if (!PartPlaced(hogLite, model, peak, x, y, j))
+                {
+                    if (errors++ < 8)
+                        TEST_LOG_SS(Error, "Peak " << i << " at level " << peak.level << " [" << x << ", " << y << "]: part " << j << " is misplaced!");
+                }
+            }
+        }
+        if (errors)
+        {
+            TEST_LOG_SS(Error, "There are " << errors << " errors in peak scores or part positions!");
+            result = false;
+        }
+
+        return result;
+    }
+
+    bool HogLiteSpecialTest()
+    {
+        bool result = true;
+
+        result = result && HogLiteSpecialTest(false, -FLT_MAX);
+        result = result && HogLiteSpecialTest(true, -FLT_MAX);
+        result = result && HogLiteSpecialTest(false, 0.0f);
+
+        return result;
+    }
+}
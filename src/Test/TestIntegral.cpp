@@ -111,13 +111,46 @@ namespace Test
         return result;
     }
 
+    bool IntegralThreadsAutoTest(int width, int height, View::Format sqsumFormat, size_t threads, const Func & f)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f.description << ColorDescription(sqsumFormat) << " for 1 & " << threads << " threads [" << width << ", " << height << "].");
+
+        View src(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View sum1(width + 1, height + 1, View::Int32, NULL, TEST_ALIGN(width));
+        View sum2(width + 1, height + 1, View::Int32, NULL, TEST_ALIGN(width));
+        View sqsum1(width + 1, height + 1, sqsumFormat, NULL, TEST_ALIGN(width));
+        View sqsum2(width + 1, height + 1, sqsumFormat, NULL, TEST_ALIGN(width));
+        View tilted;
+
+        size_t threadNumber = ::SimdGetThreadNumber();
+        ::SimdSetThreadNumber(1);
+        f.Call(src, sum1, sqsum1, tilted);
+        ::SimdSetThreadNumber(threads);
+        f.Call(src, sum2, sqsum2, tilted);
+        ::SimdSetThreadNumber(threadNumber);
+
+        result = result && Compare(sum1, sum2, 0, true, 32, 0, "sum");
+        result = result && Compare(sqsum1, sqsum2, 0, true, 32, 0, "sqsum");
+
+        return result;
+    }
+
     bool IntegralAutoTest(const Func & f1, const Func & f2)
     {
         bool result = true;
 
         result = result && IntegralAutoTest(View::Int32, View::Int32, f1, f2);
+        result = result && IntegralAutoTest(View::Int32, View::Int64, f1, f2);
         result = result && IntegralAutoTest(View::Int32, View::Double, f1, f2);
 
+        result = result && IntegralThreadsAutoTest(W, H, View::Int32, 4, f1);
+        result = result && IntegralThreadsAutoTest(W + O, H - O, View::Int64, 3, f1);
+        result = result && IntegralThreadsAutoTest(W - O, H + O, View::Double, 7, f1);
+
         return result;
     }
 
@@ -142,6 +175,168 @@ namespace Test
 
     //-----------------------------------------------------------------------
 
+    namespace
+    {
+        struct Func32f
+        {
+            typedef void(*FuncPtr)(const float * src, size_t srcStride, size_t width, size_t height, 
+                double * sum, size_t sumStride, double * sqsum, size_t sqsumStride);
+
+            FuncPtr func;
+            String description;
+
+            Func32f(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & src, View & sum, View & sqsum) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func((float*)src.data, src.stride / sizeof(float), src.width, src.height, (double*)sum.data, sum.stride / sizeof(double), 
+                    (double*)sqsum.data, sqsum.stride / sizeof(double));
+            }
+        };
+    }
+
+#define FUNC32F(function) Func32f(function, #function)
+
+    bool Integral32fReferenceCheck(const View & src, const View & sum, const View & sqsum, const String & description)
+    {
+        size_t width = src.width, height = src.height;
+        std::vector<double> prevSum(width + 1, 0.0), prevSqsum(width + 1, 0.0);
+        for (size_t y = 0; y < height; ++y)
+        {
+            double rowSum = 0, rowSqsum = 0;
+            for (size_t x = 0; x < width; ++x)
+            {
+                double value = src.At<float>(x, y);
+                rowSum += value;
+                rowSqsum += value * value;
+                prevSum[x + 1] += rowSum;
+                prevSqsum[x + 1] += rowSqsum;
+                double s = sum.At<double>(x + 1, y + 1);
+                if (::fabs(s - prevSum[x + 1]) > 1.0e-9 * (1.0 + ::fabs(prevSum[x + 1])))
+                {
+                    TEST_LOG_SS(Error, description << " : wrong sum at [" << x + 1 << ", " << y + 1 << "]: " << s << " != " << prevSum[x + 1] << ".");
+                    return false;
+                }
+                if (sqsum.format == View::Double)
+                {
+                    double q = sqsum.At<double>(x + 1, y + 1);
+                    if (::fabs(q - prevSqsum[x + 1]) > 1.0e-9 * (1.0 + prevSqsum[x + 1]))
+                    {
+                        TEST_LOG_SS(Error, description << " : wrong sqsum at [" << x + 1 << ", " << y + 1 << "]: " << q << " != " << prevSqsum[x + 1] << ".");
+                        return false;
+                    }
+                }
+            }
+        }
+        for (size_t x = 0; x <= width; ++x)
+        {
+            if (sum.At<double>(x, 0) != 0.0 || (sqsum.format == View::Double && sqsum.At<double>(x, 0) != 0.0))
+            {
+                TEST_LOG_SS(Error, description << " : nonzero first row at " << x << ".");
+                return false;
+            }
+        }
+        for (size_t y = 0; y <= height; ++y)
+        {
+            if (sum.At<double>(0, y) != 0.0 || (sqsum.format == View::Double && sqsum.At<double>(0, y) != 0.0))
+            {
+                TEST_LOG_SS(Error, description << " : nonzero first column at " << y << ".");
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool Integral32fAutoTest(int width, int height, bool sqsumEnable, const Func32f & f1, const Func32f & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View src(width, height, View::Float, NULL, TEST_ALIGN(width));
+        FillRandom32f(src, -1.0f, 1.0f);
+
+        View sum1(width + 1, height + 1, View::Double, NULL, TEST_ALIGN(width));
+        View sum2(width + 1, height + 1, View::Double, NULL, TEST_ALIGN(width));
+        View sqsum1, sqsum2;
+        if (sqsumEnable)
+        {
+            sqsum1.Recreate(width + 1, height + 1, View::Double, NULL, TEST_ALIGN(width));
+            sqsum2.Recreate(width + 1, height + 1, View::Double, NULL, TEST_ALIGN(width));
+        }
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, sum1, sqsum1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, sum2, sqsum2));
+
+        result = result && Compare(sum1, sum2, 0, true, 32, 0, "sum");
+        if (sqsumEnable)
+            result = result && Compare(sqsum1, sqsum2, 0, true, 32, 0, "sqsum");
+
+        result = result && Integral32fReferenceCheck(src, sum1, sqsum1, f1.description);
+        result = result && Integral32fReferenceCheck(src, sum2, sqsum2, f2.description);
+
+        return result;
+    }
+
+    bool Integral32fThreadsAutoTest(int width, int height, size_t threads, const Func32f & f)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f.description << " for 1 & " << threads << " threads [" << width << ", " << height << "].");
+
+        View src(width, height, View::Float, NULL, TEST_ALIGN(width));
+        FillRandom32f(src, -1.0f, 1.0f);
+
+        View sum1(width + 1, height + 1, View::Double, NULL, TEST_ALIGN(width));
+        View sum2(width + 1, height + 1, View::Double, NULL, TEST_ALIGN(width));
+        View sqsum1(width + 1, height + 1, View::Double, NULL, TEST_ALIGN(width));
+        View sqsum2(width + 1, height + 1, View::Double, NULL, TEST_ALIGN(width));
+
+        size_t threadNumber = ::SimdGetThreadNumber();
+        ::SimdSetThreadNumber(1);
+        f.Call(src, sum1, sqsum1);
+        ::SimdSetThreadNumber(threads);
+        f.Call(src, sum2, sqsum2);
+        ::SimdSetThreadNumber(threadNumber);
+
+        result = result && Compare(sum1, sum2, 0, true, 32, 0, "sum");
+        result = result && Compare(sqsum1, sqsum2, 0, true, 32, 0, "sqsum");
+        result = result && Integral32fReferenceCheck(src, sum2, sqsum2, f.description);
+
+        return result;
+    }
+
+    bool Integral32fAutoTest(const Func32f & f1, const Func32f & f2)
+    {
+        bool result = true;
+
+        for (int sqsumEnable = 0; sqsumEnable <= 1; ++sqsumEnable)
+        {
+            Func32f f1d = Func32f(f1.func, f1.description + (sqsumEnable ? "[11]" : "[10]"));
+            Func32f f2d = Func32f(f2.func, f2.description + (sqsumEnable ? "[11]" : "[10]"));
+            result = result && Integral32fAutoTest(W, H, sqsumEnable != 0, f1d, f2d);
+            result = result && Integral32fAutoTest(W + O, H - O, sqsumEnable != 0, f1d, f2d);
+        }
+
+        result = result && Integral32fThreadsAutoTest(W, H, 4, f1);
+        result = result && Integral32fThreadsAutoTest(W + O, H - O, 7, f1);
+
+        return result;
+    }
+
+    bool Integral32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && Integral32fAutoTest(FUNC32F(Simd::Base::Integral32f), FUNC32F(SimdIntegral32f));
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
     bool IntegralDataTest(bool create, int width, int height, const Func & f)
     {
         bool result = true;
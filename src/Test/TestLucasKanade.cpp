@@ -0,0 +1,184 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestData.h"
+
+namespace Test
+{
+    typedef Simd::Point<float> Point32f;
+    typedef std::vector<Point32f> Points32f;
+    typedef std::vector<uint8_t> Statuses;
+
+    namespace
+    {
+        struct FuncLK
+        {
+            typedef void(*FuncPtr)(const uint8_t * prev, size_t prevStride, const uint8_t * next, size_t nextStride, size_t width, size_t height,
+                const float * prevPoints, float * nextPoints, size_t count, size_t window, size_t iterations, float epsilon, float minEigen,
+                uint8_t * status, float * errors);
+
+            FuncPtr func;
+            String description;
+
+            FuncLK(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(size_t window)
+            {
+                description = description + "[" + ToString(window) + "]";
+            }
+
+            void Call(const View & prev, const View & next, const Points32f & prevPoints, size_t window, 
+                Points32f & nextPoints, Statuses & status, Buffer32f & errors) const
+            {
+                nextPoints = prevPoints;
+                status.assign(prevPoints.size(), 1);
+                TEST_PERFORMANCE_TEST(description);
+                func(prev.data, prev.stride, next.data, next.stride, prev.width, prev.height, (const float*)prevPoints.data(),
+                    (float*)nextPoints.data(), prevPoints.size(), window, 20, 0.01f, 0.01f, status.data(), errors.data());
+            }
+        };
+    }
+
+#define FUNC_LK(function) FuncLK(function, #function)
+
+    static void LucasKanadeInit(View & prev, View & next, Point shift, Points32f & points, size_t step)
+    {
+        View texture(prev.width / 16 + 2, prev.height / 16 + 2, View::Gray8), buffer(prev.Size(), View::Gray8);
+        FillRandom(texture);
+        Simd::ResizeBilinear(texture, buffer);
+        Simd::GaussianBlur3x3(buffer, prev);
+
+        Simd::Copy(prev, next);
+        Rect rect = Rect(prev.Size()).Intersection(Rect(prev.Size()).Shifted(-shift.x, -shift.y));
+        View region = next.Region(rect.Shifted(shift));
+        Simd::Copy(prev.Region(rect), region);
+
+        points.clear();
+        size_t margin = step * 2 + size_t(std::max(std::abs(shift.x), std::abs(shift.y)));
+        for (size_t y = margin; y + margin < prev.height; y += step)
+            for (size_t x = margin; x + margin < prev.width; x += step)
+                points.push_back(Point32f(float(x) + 0.25f, float(y) + 0.5f));
+    }
+
+    static bool LucasKanadeCheck(const Points32f & prevPoints, const Points32f & nextPoints, const Statuses & status, Point shift, const String & description)
+    {
+        size_t tracked = 0;
+        for (size_t i = 0; i < prevPoints.size(); ++i)
+        {
+            if (status[i] && ::fabs(nextPoints[i].x - prevPoints[i].x - shift.x) < 0.1f && ::fabs(nextPoints[i].y - prevPoints[i].y - shift.y) < 0.1f)
+                tracked++;
+        }
+        if (tracked * 10 < prevPoints.size() * 9)
+        {
+            TEST_LOG_SS(Error, description << ": only " << tracked << " from " << prevPoints.size() << " points are tracked correctly!");
+            return false;
+        }
+        return true;
+    }
+
+    bool LucasKanadeTrackAutoTest(int width, int height, size_t window, FuncLK f1, FuncLK f2)
+    {
+        bool result = true;
+
+        f1.Update(window);
+        f2.Update(window);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        const Point shift(3, -2);
+        View prev(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View next(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        Points32f points;
+        LucasKanadeInit(prev, next, shift, points, 8);
+
+        Points32f n1, n2;
+        Statuses s1, s2;
+        Buffer32f e1(points.size()), e2(points.size());
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(prev, next, points, window, n1, s1, e1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(prev, next, points, window, n2, s2, e2));
+
+        size_t differences = 0;
+        for (size_t i = 0; i < points.size(); ++i)
+        {
+            if (s1[i] != s2[i] || (s1[i] && (::fabs(n1[i].x - n2[i].x) > 0.02f || ::fabs(n1[i].y - n2[i].y) > 0.02f)))
+                differences++;
+        }
+        if (differences * 100 > points.size())
+        {
+            TEST_LOG_SS(Error, "There are " << differences << " from " << points.size() << " points with different results!");
+            result = false;
+        }
+
+        result = result && LucasKanadeCheck(points, n1, s1, shift, f1.description);
+        result = result && LucasKanadeCheck(points, n2, s2, shift, f2.description);
+
+        return result;
+    }
+
+    bool LucasKanadeTrackAutoTest(const FuncLK & f1, const FuncLK & f2)
+    {
+        bool result = true;
+
+        result = result && LucasKanadeTrackAutoTest(W, H, 15, f1, f2);
+        result = result && LucasKanadeTrackAutoTest(W + O, H - O, 9, f1, f2);
+
+        return result;
+    }
+
+    bool LucasKanadePyramidAutoTest(int width, int height)
+    {
+        TEST_LOG_SS(Info, "Test Simd::LucasKanadeTrack (pyramid) [" << width << ", " << height << "].");
+
+        const Point shift(13, -9);
+        Simd::Pyramid<Simd::Allocator> prev(width, height, 3), next(width, height, 3);
+        Points32f prevPoints, nextPoints;
+        LucasKanadeInit(prev[0], next[0], shift, prevPoints, 8);
+        Simd::Build(prev, SimdReduce2x2);
+        Simd::Build(next, SimdReduce2x2);
+
+        Statuses status;
+        Simd::LucasKanadeTrack(prev, next, prevPoints, nextPoints, status);
+
+        return LucasKanadeCheck(prevPoints, nextPoints, status, shift, "Simd::LucasKanadeTrack");
+    }
+
+    bool LucasKanadeTrackAutoTest()
+    {
+        bool result = true;
+
+        result = result && LucasKanadeTrackAutoTest(FUNC_LK(Simd::Base::LucasKanadeTrack), FUNC_LK(SimdLucasKanadeTrack));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && LucasKanadeTrackAutoTest(FUNC_LK(Simd::Avx2::LucasKanadeTrack), FUNC_LK(SimdLucasKanadeTrack));
+#endif 
+
+        result = result && LucasKanadePyramidAutoTest(W, H);
+
+        return result;
+    }
+}
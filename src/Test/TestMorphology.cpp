@@ -0,0 +1,201 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestData.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncM
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount,
+                size_t radiusX, size_t radiusY, SimdMorphologyType type, uint8_t * dst, size_t dstStride);
+
+            FuncPtr func;
+            String description;
+
+            FuncM(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(View::Format format, size_t radiusX, size_t radiusY, SimdMorphologyType type, bool inplace)
+            {
+                const char * names[] = { "Erode", "Dilate", "Open", "Close", "Gradient" };
+                description = description + ColorDescription(format) + "[" + ToString(radiusX) + "x" + ToString(radiusY) 
+                    + "-" + names[type] + (inplace ? "-i" : "") + "]";
+            }
+
+            void Call(const View & src, size_t radiusX, size_t radiusY, SimdMorphologyType type, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.stride, src.width, src.height, View::PixelSize(src.format), radiusX, radiusY, type, dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_M(function) FuncM(function, #function)
+
+    void MorphologyReference(const View & src, ptrdiff_t radiusX, ptrdiff_t radiusY, bool max, View & dst)
+    {
+        ptrdiff_t w = src.width, h = src.height, channels = View::PixelSize(src.format);
+        View buf(src.width, src.height, src.format);
+        for (ptrdiff_t y = 0; y < h; ++y)
+        {
+            for (ptrdiff_t x = 0; x < w; ++x)
+            {
+                for (ptrdiff_t c = 0; c < channels; ++c)
+                {
+                    uint8_t value = max ? 0 : 255;
+                    for (ptrdiff_t dy = -radiusY; dy <= radiusY; ++dy)
+                    {
+                        uint8_t s = src.data[Simd::RestrictRange<ptrdiff_t>(y + dy, 0, h - 1)*src.stride + x*channels + c];
+                        value = max ? Simd::Max(value, s) : Simd::Min(value, s);
+                    }
+                    buf.data[y*buf.stride + x*channels + c] = value;
+                }
+            }
+        }
+        for (ptrdiff_t y = 0; y < h; ++y)
+        {
+            for (ptrdiff_t x = 0; x < w; ++x)
+            {
+                for (ptrdiff_t c = 0; c < channels; ++c)
+                {
+                    uint8_t value = max ? 0 : 255;
+                    for (ptrdiff_t dx = -radiusX; dx <= radiusX; ++dx)
+                    {
+                        uint8_t s = buf.data[y*buf.stride + Simd::RestrictRange<ptrdiff_t>(x + dx, 0, w - 1)*channels + c];
+                        value = max ? Simd::Max(value, s) : Simd::Min(value, s);
+                    }
+                    dst.data[y*dst.stride + x*channels + c] = value;
+                }
+            }
+        }
+    }
+
+    void MorphologyReference(const View & src, size_t radiusX, size_t radiusY, SimdMorphologyType type, View & dst)
+    {
+        View tmp(src.width, src.height, src.format);
+        switch (type)
+        {
+        case SimdMorphologyErode:
+            MorphologyReference(src, radiusX, radiusY, false, dst);
+            break;
+        case SimdMorphologyDilate:
+            MorphologyReference(src, radiusX, radiusY, true, dst);
+            break;
+        case SimdMorphologyOpen:
+            MorphologyReference(src, radiusX, radiusY, false, tmp);
+            MorphologyReference(tmp, radiusX, radiusY, true, dst);
+            break;
+        case SimdMorphologyClose:
+            MorphologyReference(src, radiusX, radiusY, true, tmp);
+            MorphologyReference(tmp, radiusX, radiusY, false, dst);
+            break;
+        case SimdMorphologyGradient:
+            MorphologyReference(src, radiusX, radiusY, false, tmp);
+            MorphologyReference(src, radiusX, radiusY, true, dst);
+            for (size_t y = 0; y < dst.height; ++y)
+                for (size_t i = 0, size = dst.width*View::PixelSize(dst.format); i < size; ++i)
+                    dst.data[y*dst.stride + i] -= tmp.data[y*tmp.stride + i];
+            break;
+        default:
+            assert(0);
+        }
+    }
+
+    bool MorphologyAutoTest(View::Format format, int width, int height, size_t radiusX, size_t radiusY, SimdMorphologyType type, bool inplace, FuncM f1, FuncM f2)
+    {
+        bool result = true;
+
+        f1.Update(format, radiusX, radiusY, type, inplace);
+        f2.Update(format, radiusX, radiusY, type, inplace);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View s(width, height, format, NULL, TEST_ALIGN(width));
+        FillRandom(s);
+
+        View d1(width, height, format, NULL, TEST_ALIGN(width));
+        View d2(width, height, format, NULL, TEST_ALIGN(width));
+
+        if (inplace)
+        {
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(Simd::Copy(s, d1); f1.Call(d1, radiusX, radiusY, type, d1));
+
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(Simd::Copy(s, d2); f2.Call(d2, radiusX, radiusY, type, d2));
+        }
+        else
+        {
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, radiusX, radiusY, type, d1));
+
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, radiusX, radiusY, type, d2));
+        }
+
+        result = result && Compare(d1, d2, 0, true, 64);
+
+        View r(width, height, format, NULL, TEST_ALIGN(width));
+        MorphologyReference(s, radiusX, radiusY, type, r);
+        result = result && Compare(d1, r, 0, true, 64, 0, "reference");
+
+        return result;
+    }
+
+    bool MorphologyAutoTest(const FuncM & f1, const FuncM & f2)
+    {
+        bool result = true;
+
+        for (View::Format format = View::Gray8; format <= View::Bgra32; format = View::Format(format + 1))
+        {
+            result = result && MorphologyAutoTest(format, W, H, 3, 3, SimdMorphologyErode, false, f1, f2);
+            result = result && MorphologyAutoTest(format, W + O, H - O, 7, 4, SimdMorphologyDilate, false, f1, f2);
+        }
+        result = result && MorphologyAutoTest(View::Gray8, W, H, 15, 15, SimdMorphologyErode, true, f1, f2);
+        result = result && MorphologyAutoTest(View::Gray8, W + O, H - O, 5, 0, SimdMorphologyOpen, false, f1, f2);
+        result = result && MorphologyAutoTest(View::Gray8, W - O, H + O, 0, 5, SimdMorphologyClose, true, f1, f2);
+        result = result && MorphologyAutoTest(View::Gray8, W, H, 2, 3, SimdMorphologyGradient, true, f1, f2);
+        result = result && MorphologyAutoTest(View::Bgr24, 5, 4, 9, 6, SimdMorphologyDilate, false, f1, f2);
+
+        return result;
+    }
+
+    bool MorphologyAutoTest()
+    {
+        bool result = true;
+
+        result = result && MorphologyAutoTest(FUNC_M(Simd::Base::Morphology), FUNC_M(SimdMorphology));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && MorphologyAutoTest(FUNC_M(Simd::Sse2::Morphology), FUNC_M(SimdMorphology));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && MorphologyAutoTest(FUNC_M(Simd::Avx2::Morphology), FUNC_M(SimdMorphology));
+#endif 
+
+        return result;
+    }
+}
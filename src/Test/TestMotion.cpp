@@ -148,4 +148,224 @@ namespace Test
 
         return true;
     }
+
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        struct EngineResult
+        {
+            Simd::Motion::Time time;
+            Simd::Motion::Metadata metadata;
+        };
+        typedef std::vector<EngineResult> EngineResults;
+
+        void GenerateFrame(const View & background, size_t stream, size_t index, View & frame)
+        {
+            Simd::Copy(background, frame);
+            ptrdiff_t size = frame.height / 4, shift = (index * (stream + 2)) % (frame.width - size);
+            Simd::Fill(frame.Region(shift, frame.height / 2 - size / 2, shift + size, frame.height / 2 + size / 2).Ref(), 255);
+        }
+
+        bool Compare(const Simd::Motion::Metadata & a, const Simd::Motion::Metadata & b)
+        {
+            if (a.objects.size() != b.objects.size() || a.events.size() != b.events.size())
+                return false;
+            for (size_t i = 0; i < a.objects.size(); ++i)
+                if (a.objects[i].id != b.objects[i].id || a.objects[i].rect != b.objects[i].rect)
+                    return false;
+            for (size_t i = 0; i < a.events.size(); ++i)
+                if (a.events[i].type != b.events[i].type || a.events[i].objectId != b.events[i].objectId)
+                    return false;
+            return true;
+        }
+    }
+
+    bool MotionEngineSpecialTest()
+    {
+        const size_t streams = 8, frames = 100, width = 320, height = 240;
+        const double period = 0.040;
+
+        std::vector<View> backgrounds(streams);
+        for (size_t s = 0; s < streams; ++s)
+        {
+            backgrounds[s].Recreate(width, height, View::Gray8);
+            FillRandom(backgrounds[s], 64, 96);
+        }
+
+        std::vector<EngineResults> control(streams), results(streams);
+        View image(width, height, View::Gray8);
+        double time = GetTime();
+        for (size_t s = 0; s < streams; ++s)
+        {
+            Simd::Motion::Detector detector;
+            for (size_t f = 0; f < frames; ++f)
+            {
+                GenerateFrame(backgrounds[s], s, f, image);
+                EngineResult result;
+                result.time = f * period;
+                detector.NextFrame(Simd::Motion::Frame(image, false, result.time), result.metadata);
+                control[s].push_back(result);
+            }
+        }
+        TEST_LOG_SS(Info, "Sequential detectors : " << streams * frames / (GetTime() - time) << " fps.");
+
+        std::mutex mutex;
+        Simd::Motion::Engine engine;
+        if (!engine.Init(streams, [&](size_t stream, const Simd::Motion::Frame & input, const Simd::Motion::Metadata & metadata)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                EngineResult result;
+                result.time = input.timestamp;
+                result.metadata = metadata;
+                results[stream].push_back(result);
+            }, -1, 2))
+        {
+            TEST_LOG_SS(Error, "Can't initialize Simd::Motion::Engine!");
+            return false;
+        }
+        for (size_t f = 0; f < frames; ++f)
+        {
+            for (size_t s = 0; s < streams; ++s)
+            {
+                GenerateFrame(backgrounds[s], s, f, image);
+                engine.Push(s, Simd::Motion::Frame(image, false, f * period));
+            }
+        }
+        engine.Wait();
+        Simd::Motion::Engine::Statistics statistics = engine.GetStatistics();
+        engine.Stop();
+        TEST_LOG_SS(Info, "Engine : " << statistics.threads << " threads, " << statistics.processed << " frames, "
+            << statistics.Fps() << " fps, load " << statistics.Load() * 100 << " %.");
+
+        if (statistics.pushed != streams * frames || statistics.processed != streams * frames || statistics.dropped || statistics.queued)
+        {
+            TEST_LOG_SS(Error, "Wrong Simd::Motion::Engine statistics!");
+            return false;
+        }
+        for (size_t s = 0; s < streams; ++s)
+        {
+            if (results[s].size() != frames)
+            {
+                TEST_LOG_SS(Error, "Stream " << s << " has " << results[s].size() << " results instead of " << frames << " !");
+                return false;
+            }
+            for (size_t f = 0; f < frames; ++f)
+            {
+                if (results[s][f].time != control[s][f].time)
+                {
+                    TEST_LOG_SS(Error, "Stream " << s << " : wrong order of frame " << f << " !");
+                    return false;
+                }
+                if (!Compare(results[s][f].metadata, control[s][f].metadata))
+                {
+                    TEST_LOG_SS(Error, "Stream " << s << " : metadata of frame " << f << " differs from single detector!");
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool MotionYuvSpecialTest()
+    {
+        const size_t frames = 100, width = 640, height = 480;
+        const double period = 0.040;
+
+        View background(width, height, View::Gray8), gray(width, height, View::Gray8);
+        FillRandom(background, 64, 96);
+        Simd::Motion::Frame bgra(width, height, Simd::Motion::Frame::Bgra32), yuv(width, height, Simd::Motion::Frame::Yuv420p);
+        Simd::Fill(yuv.planes[1], 128);
+        Simd::Fill(yuv.planes[2], 128);
+
+        Simd::Motion::Detector bgraDetector, yuvDetector;
+        double bgraTime = 0, yuvTime = 0;
+        size_t objects = 0;
+        for (size_t f = 0; f < frames; ++f)
+        {
+            GenerateFrame(background, 0, f, gray);
+            Simd::GrayToBgra(gray, bgra.planes[0]);
+            Simd::Copy(gray, yuv.planes[0]);
+            bgra.timestamp = yuv.timestamp = f * period;
+
+            Simd::Motion::Metadata bgraMetadata, yuvMetadata;
+            double time = GetTime();
+            bgraDetector.NextFrame(bgra, bgraMetadata);
+            bgraTime += GetTime() - time;
+            time = GetTime();
+            yuvDetector.NextFrame(yuv, yuvMetadata);
+            yuvTime += GetTime() - time;
+
+            if (!Compare(bgraMetadata, yuvMetadata))
+            {
+                TEST_LOG_SS(Error, "Metadata of Yuv420p and Bgra32 frame " << f << " are different!");
+                return false;
+            }
+            objects += yuvMetadata.objects.size();
+        }
+        TEST_LOG_SS(Info, "Motion::Detector : " << objects << " objects, Bgra32 input " << bgraTime * 1000 / frames << " ms, Yuv420p input " << yuvTime * 1000 / frames << " ms.");
+
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool MotionStatisticsSpecialTest()
+    {
+        typedef Simd::Motion::Metadata::Statistics Statistics;
+        const size_t frames = 100, width = 640, height = 480;
+        const double period = 0.040;
+        const char * names[Statistics::StageSize] = { "Calibrate", "SetFrame", "EstimateTextures", "EstimateDifference", 
+            "PerformSegmentation", "VerifyStability", "TrackObjects", "ClassifyObjects", "UpdateBackground", "SetMetadata", "DebugAnnotation" };
+
+        View background(width, height, View::Gray8), image(width, height, View::Gray8);
+        FillRandom(background, 64, 96);
+
+        Simd::Motion::Options options;
+        options.StatisticsEnable = true;
+        Simd::Motion::Detector detector;
+        detector.SetOptions(options);
+
+        Statistics sum;
+        for (size_t f = 0; f < frames; ++f)
+        {
+            GenerateFrame(background, 0, f, image);
+            Simd::Motion::Metadata metadata;
+            detector.NextFrame(Simd::Motion::Frame(image, false, f * period), metadata);
+            const Statistics & statistics = metadata.statistics;
+
+            Simd::Motion::Time stages = 0;
+            for (size_t i = 0; i < Statistics::StageSize; ++i)
+            {
+                stages += statistics.times[i];
+                sum.times[i] += statistics.times[i];
+            }
+            if (statistics.total <= 0 || ::fabs(stages - statistics.total) > 0.000001 + statistics.total * 0.001)
+            {
+                TEST_LOG_SS(Error, "Frame " << f << " : wrong stage times (total " << statistics.total << ", sum of stages " << stages << ") !");
+                return false;
+            }
+            if (statistics.pixels == 0 || statistics.objects != metadata.objects.size() || statistics.events != metadata.events.size() || statistics.objects > statistics.trackedObjects)
+            {
+                TEST_LOG_SS(Error, "Frame " << f << " : wrong statistics counters!");
+                return false;
+            }
+            sum.total += statistics.total;
+            sum.pixels += statistics.pixels;
+            sum.movingRegions += statistics.movingRegions;
+            sum.objects += statistics.objects;
+        }
+
+        std::stringstream ss;
+        ss << "Motion::Detector statistics (average of " << frames << " frames): total " << sum.total * 1000 / frames << " ms";
+        for (size_t i = 0; i < Statistics::StageSize; ++i)
+            ss << ", " << names[i] << " " << sum.times[i] * 1000 / frames << " ms";
+        ss << "; " << sum.pixels / frames << " pixels, " << double(sum.movingRegions) / frames << " regions, " << double(sum.objects) / frames << " objects.";
+        TEST_LOG_SS(Info, ss.str());
+
+        return true;
+    }
 }
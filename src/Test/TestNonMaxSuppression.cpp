@@ -0,0 +1,180 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestData.h"
+
+namespace Test
+{
+    typedef std::vector<size_t> Indices;
+
+    namespace
+    {
+        struct FuncNms
+        {
+            typedef size_t(*FuncPtr)(const float * boxes, float * scores, size_t count, SimdNonMaxSuppressionType type,
+                float iouThreshold, float sigma, float scoreThreshold, size_t * indices);
+
+            FuncPtr func;
+            String description;
+
+            FuncNms(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(SimdNonMaxSuppressionType type)
+            {
+                const char * names[] = { "Hard", "Linear", "Gaussian" };
+                description = description + "[" + names[type] + "]";
+            }
+
+            void Call(const Buffer32f & boxes, const Buffer32f & src, SimdNonMaxSuppressionType type, float scoreThreshold, Buffer32f & dst, Indices & indices) const
+            {
+                dst = src;
+                indices.resize(src.size());
+                TEST_PERFORMANCE_TEST(description);
+                size_t kept = func(boxes.data(), dst.data(), src.size(), type, 0.5f, 0.5f, scoreThreshold, indices.data());
+                indices.resize(kept);
+            }
+        };
+    }
+
+#define FUNC_NMS(function) FuncNms(function, #function)
+
+    static void NonMaxSuppressionInit(size_t count, Buffer32f & boxes, Buffer32f & scores)
+    {
+        const size_t clusters = count / 16 + 1;
+        Buffer32f centers(clusters * 3);
+        for (size_t c = 0; c < clusters; ++c)
+        {
+            centers[c * 3 + 0] = float(Random(W));
+            centers[c * 3 + 1] = float(Random(H));
+            centers[c * 3 + 2] = float(16 + Random(64));
+        }
+        boxes.resize(count * 4);
+        scores.resize(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const float * c = centers.data() + Random((int)clusters) * 3;
+            float x = c[0] + c[2] * float(Random() - 0.5) * 0.5f;
+            float y = c[1] + c[2] * float(Random() - 0.5) * 0.5f;
+            float half = c[2] * float(0.4 + Random() * 0.2);
+            boxes[i * 4 + 0] = x - half;
+            boxes[i * 4 + 1] = y - half;
+            boxes[i * 4 + 2] = x + half;
+            boxes[i * 4 + 3] = y + half;
+            scores[i] = float(Random());
+        }
+    }
+
+    static bool NonMaxSuppressionCheck(const Buffer32f & boxes, const Indices & indices, const String & description)
+    {
+        for (size_t i = 0; i < indices.size(); ++i)
+        {
+            const float * a = boxes.data() + indices[i] * 4;
+            for (size_t j = 0; j < i; ++j)
+            {
+                const float * b = boxes.data() + indices[j] * 4;
+                float w = std::max(std::min(a[2], b[2]) - std::max(a[0], b[0]), 0.0f);
+                float h = std::max(std::min(a[3], b[3]) - std::max(a[1], b[1]), 0.0f);
+                float inter = w * h, area = (a[2] - a[0]) * (a[3] - a[1]) + (b[2] - b[0]) * (b[3] - b[1]);
+                if (inter > 0.5f * (area - inter) + 0.001f * area)
+                {
+                    TEST_LOG_SS(Error, description << ": kept boxes " << indices[j] << " and " << indices[i] << " overlap!");
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    bool NonMaxSuppression32fAutoTest(size_t count, SimdNonMaxSuppressionType type, FuncNms f1, FuncNms f2)
+    {
+        bool result = true;
+
+        f1.Update(type);
+        f2.Update(type);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << count << "].");
+
+        Buffer32f boxes, scores;
+        NonMaxSuppressionInit(count, boxes, scores);
+        const float scoreThreshold = type == SimdNonMaxSuppressionHard ? 0.1f : 0.05f;
+
+        Buffer32f s1, s2;
+        Indices i1, i2;
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(boxes, scores, type, scoreThreshold, s1, i1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(boxes, scores, type, scoreThreshold, s2, i2));
+
+        if (i1 != i2)
+        {
+            TEST_LOG_SS(Error, "Kept boxes are different: " << i1.size() << " and " << i2.size() << "!");
+            return false;
+        }
+
+        result = result && Compare(s1, s2, EPS, true, 32);
+
+        if (type == SimdNonMaxSuppressionHard)
+        {
+            result = result && NonMaxSuppressionCheck(boxes, i1, f1.description);
+            for (size_t i = 1; i < i1.size() && result; ++i)
+            {
+                if (scores[i1[i]] > scores[i1[i - 1]])
+                {
+                    TEST_LOG_SS(Error, f1.description << ": kept boxes are not sorted by score!");
+                    result = false;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    bool NonMaxSuppression32fAutoTest(const FuncNms & f1, const FuncNms & f2)
+    {
+        bool result = true;
+
+        for (int type = SimdNonMaxSuppressionHard; type <= SimdNonMaxSuppressionGaussian; ++type)
+        {
+            result = result && NonMaxSuppression32fAutoTest(W, (SimdNonMaxSuppressionType)type, f1, f2);
+            result = result && NonMaxSuppression32fAutoTest(W + O, (SimdNonMaxSuppressionType)type, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool NonMaxSuppression32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && NonMaxSuppression32fAutoTest(FUNC_NMS(Simd::Base::NonMaxSuppression32f), FUNC_NMS(SimdNonMaxSuppression32f));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && NonMaxSuppression32fAutoTest(FUNC_NMS(Simd::Avx2::NonMaxSuppression32f), FUNC_NMS(SimdNonMaxSuppression32f));
+#endif 
+
+        return result;
+    }
+}
@@ -387,6 +387,86 @@ namespace Test
 
     //-----------------------------------------------------------------------
 
+    static void PyramidBuildBase(Simd::Pyramid<Simd::Allocator> & pyramid, ::SimdReduceType reduceType)
+    {
+        TEST_PERFORMANCE_TEST(String("Simd::Base::PyramidBuild[") + ToString(reduceType) + "]");
+        for (size_t level = 1; level < pyramid.Size(); ++level)
+        {
+            const View & src = pyramid[level - 1];
+            View & dst = pyramid[level];
+            switch (reduceType)
+            {
+            case SimdReduce2x2: Simd::Base::ReduceGray2x2(src.data, src.width, src.height, src.stride, dst.data, dst.width, dst.height, dst.stride); break;
+            case SimdReduce3x3: Simd::Base::ReduceGray3x3(src.data, src.width, src.height, src.stride, dst.data, dst.width, dst.height, dst.stride, 1); break;
+            case SimdReduce4x4: Simd::Base::ReduceGray4x4(src.data, src.width, src.height, src.stride, dst.data, dst.width, dst.height, dst.stride); break;
+            case SimdReduce5x5: Simd::Base::ReduceGray5x5(src.data, src.width, src.height, src.stride, dst.data, dst.width, dst.height, dst.stride, 1); break;
+            default: assert(0);
+            }
+        }
+    }
+
+    bool PyramidBuildAutoTest(int width, int height, ::SimdReduceType reduceType)
+    {
+        bool result = true;
+
+        typedef Simd::Pyramid<Simd::Allocator> Pyramid;
+        const size_t levelCount = 5;
+
+        TEST_LOG_SS(Info, "Test Simd::Build(Pyramid) with reduce type " << reduceType << " [" << width << ", " << height << "].");
+
+        Pyramid control(width, height, levelCount), fused(width, height, levelCount), lazy(width, height, levelCount), roi(width, height, levelCount);
+        FillRandom(control[0]);
+        Simd::Copy(control[0], fused[0]);
+        Simd::Copy(control[0], lazy[0]);
+        Simd::Copy(control[0], roi[0]);
+        PyramidBuildBase(control, reduceType);
+
+        {
+            TEST_PERFORMANCE_TEST(String("SimdPyramidBuild[") + ToString(reduceType) + "]");
+            Simd::Build(fused, reduceType);
+        }
+        for (size_t level = 1; level < levelCount && result; ++level)
+            result = result && Compare(control[level], fused[level], 0, true, 64, 0, "fused level " + ToString(level));
+
+        lazy.SetLazy(true);
+        Simd::Build(lazy, reduceType);
+        if (lazy.Actual(levelCount - 1))
+        {
+            TEST_LOG_SS(Error, "The top level of lazy pyramid is built before the first access!");
+            result = false;
+        }
+        for (size_t level = 1; level < levelCount && result; ++level)
+            result = result && Compare(control[level], lazy[level], 0, true, 64, 0, "lazy level " + ToString(level));
+
+        const Rect rect(width / 5, height / 3, width / 2 + 1, height * 3 / 4);
+        Simd::Fill(roi, 0);
+        Simd::Copy(control[0], roi[0]);
+        Simd::Build(roi, reduceType, true, rect);
+        for (size_t level = 1; level < levelCount && result; ++level)
+        {
+            ptrdiff_t scale = ptrdiff_t(1) << level;
+            Rect r = Rect(rect.left / scale, rect.top / scale, (rect.right + scale - 1) / scale, (rect.bottom + scale - 1) / scale);
+            result = result && Compare(control[level].Region(r), roi[level].Region(r), 0, true, 64, 0, "roi level " + ToString(level));
+        }
+
+        return result;
+    }
+
+    bool PyramidBuildAutoTest()
+    {
+        bool result = true;
+
+        for (int type = SimdReduce2x2; type <= SimdReduce5x5; ++type)
+        {
+            result = result && PyramidBuildAutoTest(W, H, (::SimdReduceType)type);
+            result = result && PyramidBuildAutoTest(W + O, H - O, (::SimdReduceType)type);
+        }
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
     bool ReduceColorDataTest(bool create, int width, int height, View::Format format, FuncRC f)
     {
         bool result = true;
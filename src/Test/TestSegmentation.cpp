@@ -383,6 +383,180 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncLC
+        {
+            typedef size_t(*FuncPtr)(const uint8_t * mask, size_t maskStride, size_t width, size_t height, uint8_t index, SimdConnectivityType connectivity,
+                uint32_t * labels, size_t labelsStride, SimdConnectedComponent * components, size_t capacity);
+            FuncPtr func;
+            String description;
+
+            FuncLC(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & mask, uint8_t index, SimdConnectivityType connectivity, View & labels, std::vector<SimdConnectedComponent> & components, size_t & count) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                count = func(mask.data, mask.stride, mask.width, mask.height, index, connectivity, 
+                    (uint32_t*)labels.data, labels.stride / 4, components.data(), components.size());
+            }
+        };
+    }
+
+#define FUNC_LC(func) FuncLC(func, #func)
+
+    static size_t SegmentationLabelComponentsReference(const View & mask, uint8_t index, SimdConnectivityType connectivity, View & labels)
+    {
+        const ptrdiff_t dx[8] = { -1, 0, 1, 0, -1, 1, 1, -1 }, dy[8] = { 0, -1, 0, 1, -1, -1, 1, 1 };
+        size_t neighbors = connectivity == SimdConnectivity8 ? 8 : 4, count = 0;
+        Simd::Fill(labels, 0);
+        std::vector<Point> stack;
+        for (ptrdiff_t y = 0; y < (ptrdiff_t)mask.height; ++y)
+        {
+            for (ptrdiff_t x = 0; x < (ptrdiff_t)mask.width; ++x)
+            {
+                if (mask.At<uint8_t>(x, y) != index || labels.At<uint32_t>(x, y))
+                    continue;
+                uint32_t label = (uint32_t)++count;
+                labels.At<uint32_t>(x, y) = label;
+                stack.push_back(Point(x, y));
+                while (stack.size())
+                {
+                    Point p = stack.back();
+                    stack.pop_back();
+                    for (size_t n = 0; n < neighbors; ++n)
+                    {
+                        ptrdiff_t nx = p.x + dx[n], ny = p.y + dy[n];
+                        if (nx < 0 || ny < 0 || nx >= (ptrdiff_t)mask.width || ny >= (ptrdiff_t)mask.height)
+                            continue;
+                        if (mask.At<uint8_t>(nx, ny) == index && labels.At<uint32_t>(nx, ny) == 0)
+                        {
+                            labels.At<uint32_t>(nx, ny) = label;
+                            stack.push_back(Point(nx, ny));
+                        }
+                    }
+                }
+            }
+        }
+        return count;
+    }
+
+    static void SegmentationComponentsReference(const View & labels, size_t count, std::vector<SimdConnectedComponent> & components)
+    {
+        std::vector<uint64_t> sumX(count, 0), sumY(count, 0);
+        components.assign(count, SimdConnectedComponent());
+        for (size_t i = 0; i < count; ++i)
+        {
+            SimdConnectedComponent & c = components[i];
+            c.area = 0, c.left = labels.width, c.top = labels.height, c.right = 0, c.bottom = 0;
+        }
+        for (size_t y = 0; y < labels.height; ++y)
+        {
+            for (size_t x = 0; x < labels.width; ++x)
+            {
+                uint32_t label = labels.At<uint32_t>(x, y);
+                if (label == 0)
+                    continue;
+                SimdConnectedComponent & c = components[label - 1];
+                c.area++;
+                c.left = std::min<ptrdiff_t>(c.left, x);
+                c.top = std::min<ptrdiff_t>(c.top, y);
+                c.right = std::max<ptrdiff_t>(c.right, x + 1);
+                c.bottom = std::max<ptrdiff_t>(c.bottom, y + 1);
+                sumX[label - 1] += x;
+                sumY[label - 1] += y;
+            }
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            components[i].x = double(sumX[i]) / double(components[i].area);
+            components[i].y = double(sumY[i]) / double(components[i].area);
+        }
+    }
+
+    bool SegmentationLabelComponentsAutoTest(int width, int height, SimdConnectivityType connectivity, const FuncLC & f1, const FuncLC & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height 
+            << "] and connectivity " << (connectivity == SimdConnectivity8 ? 8 : 4) << ".");
+
+        const uint8_t index = 3;
+        View mask(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandomMask(mask, index);
+        FillRhombMask(mask, Rect(width * 1 / 15, height * 2 / 15, width * 11 / 15, height * 12 / 15), index);
+
+        View l1(width, height, View::Int32, NULL, TEST_ALIGN(width));
+        View l2(width, height, View::Int32, NULL, TEST_ALIGN(width));
+        View l3(width, height, View::Int32, NULL, TEST_ALIGN(width));
+        size_t n1 = 0, n2 = 0, n3 = SegmentationLabelComponentsReference(mask, index, connectivity, l3);
+        std::vector<SimdConnectedComponent> c1(n3), c2(n3);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(mask, index, connectivity, l1, c1, n1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(mask, index, connectivity, l2, c2, n2));
+
+        if (n1 != n2 || n1 != n3)
+        {
+            TEST_LOG_SS(Error, "There are different component numbers: " << n1 << ", " << n2 << ", " << n3 << ".");
+            return false;
+        }
+
+        result = result && Compare(l1, l2, 0, true, 32, 0, "labels");
+        result = result && Compare(l1, l3, 0, true, 32, 0, "reference");
+
+        std::vector<SimdConnectedComponent> c3;
+        SegmentationComponentsReference(l3, n3, c3);
+        for (size_t i = 0; i < n1 && result; ++i)
+        {
+            const SimdConnectedComponent & a = c1[i], & b = c2[i], & r = c3[i];
+            if (a.area != b.area || a.left != b.left || a.top != b.top || a.right != b.right || a.bottom != b.bottom || a.x != b.x || a.y != b.y)
+            {
+                TEST_LOG_SS(Error, "There is an error in statistics of component " << i << ".");
+                result = false;
+            }
+            if (a.area != r.area || a.left != r.left || a.top != r.top || a.right != r.right || a.bottom != r.bottom || 
+                ::fabs(a.x - r.x) > 1.0e-9 || ::fabs(a.y - r.y) > 1.0e-9)
+            {
+                TEST_LOG_SS(Error, "Statistics of component " << i << " differ from reference: area " << a.area << " vs " << r.area 
+                    << ", box [" << a.left << ", " << a.top << ", " << a.right << ", " << a.bottom << "] vs [" << r.left << ", " << r.top << ", " << r.right << ", " << r.bottom 
+                    << "], centroid (" << a.x << ", " << a.y << ") vs (" << r.x << ", " << r.y << ").");
+                result = false;
+            }
+        }
+
+        return result;
+    }
+
+    bool SegmentationLabelComponentsAutoTest(const FuncLC & f1, const FuncLC & f2)
+    {
+        bool result = true;
+
+        for (int c = 0; c < 2; ++c)
+        {
+            SimdConnectivityType connectivity = c ? SimdConnectivity8 : SimdConnectivity4;
+            result = result && SegmentationLabelComponentsAutoTest(W, H, connectivity, f1, f2);
+            result = result && SegmentationLabelComponentsAutoTest(W + O, H - O, connectivity, f1, f2);
+            result = result && SegmentationLabelComponentsAutoTest(W - O, H + O, connectivity, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool SegmentationLabelComponentsAutoTest()
+    {
+        bool result = true;
+
+        result = result && SegmentationLabelComponentsAutoTest(FUNC_LC(Simd::Base::SegmentationLabelComponents), FUNC_LC(SimdSegmentationLabelComponents));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SegmentationLabelComponentsAutoTest(FUNC_LC(Simd::Avx2::SegmentationLabelComponents), FUNC_LC(SimdSegmentationLabelComponents));
+#endif
+
+        return result;
+    }
+
     //-----------------------------------------------------------------------
 
     bool SegmentationShrinkRegionDataTest(bool create, int width, int height, const FuncSR & f)
@@ -0,0 +1,124 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestData.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncTM
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight, const uint8_t * tmpl, size_t tmplStride,
+                size_t tmplWidth, size_t tmplHeight, SimdTemplateMatchType type, float * dst, size_t dstStride);
+
+            FuncPtr func;
+            String description;
+
+            FuncTM(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(SimdTemplateMatchType type, const View & tmpl)
+            {
+                description = description + "[" + (type == SimdTemplateMatchSsd ? "Ssd" : "Ncc") + "-" 
+                    + ToString(tmpl.width) + "x" + ToString(tmpl.height) + "]";
+            }
+
+            void Call(const View & src, const View & tmpl, SimdTemplateMatchType type, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.stride, src.width, src.height, tmpl.data, tmpl.stride, tmpl.width, tmpl.height, 
+                    type, (float*)dst.data, dst.stride / sizeof(float));
+            }
+        };
+    }
+
+#define FUNC_TM(function) FuncTM(function, #function)
+
+    bool TemplateMatchAutoTest(int width, int height, int tmplWidth, int tmplHeight, SimdTemplateMatchType type, FuncTM f1, FuncTM f2)
+    {
+        bool result = true;
+
+        View src(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        const Point position(width / 3, height / 2);
+        View tmpl(tmplWidth, tmplHeight, View::Gray8, NULL, TEST_ALIGN(tmplWidth));
+        Simd::Copy(src.Region(position, position + tmpl.Size()), tmpl);
+
+        f1.Update(type, tmpl);
+        f2.Update(type, tmpl);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View d1(width - tmplWidth + 1, height - tmplHeight + 1, View::Float, NULL, TEST_ALIGN(width));
+        View d2(width - tmplWidth + 1, height - tmplHeight + 1, View::Float, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, tmpl, type, d1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, tmpl, type, d2));
+
+        result = result && Compare(d1, d2, 0, true, 64);
+
+        if (result)
+        {
+            SimdTemplateMatchPeak peaks[4];
+            size_t count = SimdTemplateMatchPeaks((float*)d2.data, d2.stride / sizeof(float), d2.width, d2.height, type, tmplWidth / 2, peaks, 4);
+            if (count == 0 || peaks[0].x != position.x || peaks[0].y != position.y)
+            {
+                TEST_LOG_SS(Error, "The best peak is not found at [" << position.x << ", " << position.y << "]!");
+                result = false;
+            }
+        }
+
+        return result;
+    }
+
+    bool TemplateMatchAutoTest(const FuncTM & f1, const FuncTM & f2)
+    {
+        bool result = true;
+
+        for (int type = SimdTemplateMatchSsd; type <= SimdTemplateMatchNcc; ++type)
+        {
+            result = result && TemplateMatchAutoTest(W / 2, H / 2, 16, 16, (SimdTemplateMatchType)type, f1, f2);
+            result = result && TemplateMatchAutoTest(W / 2 + O, H / 2 - O, 23, 9, (SimdTemplateMatchType)type, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool TemplateMatchAutoTest()
+    {
+        bool result = true;
+
+        result = result && TemplateMatchAutoTest(FUNC_TM(Simd::Base::TemplateMatch), FUNC_TM(SimdTemplateMatch));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && TemplateMatchAutoTest(FUNC_TM(Simd::Avx2::TemplateMatch), FUNC_TM(SimdTemplateMatch));
+#endif 
+
+        return result;
+    }
+}
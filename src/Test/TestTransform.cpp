@@ -25,6 +25,8 @@
 #include "Test/TestPerformance.h"
 #include "Test/TestData.h"
 
+#include "Simd/SimdFrame.hpp"
+
 namespace Test
 {
     namespace
@@ -71,6 +73,31 @@ namespace Test
 #define FUNC_TI(function) \
     FuncTI(function, std::string(#function))
 
+    void TransformImageReference(const View & src, ::SimdTransformType transform, View & dst)
+    {
+        size_t size = src.PixelSize(), w = src.width, h = src.height;
+        for (size_t y = 0; y < h; ++y)
+        {
+            for (size_t x = 0; x < w; ++x)
+            {
+                size_t dx = 0, dy = 0;
+                switch (transform)
+                {
+                case ::SimdTransformRotate0: dx = x, dy = y; break;
+                case ::SimdTransformRotate90: dx = y, dy = w - 1 - x; break;
+                case ::SimdTransformRotate180: dx = w - 1 - x, dy = h - 1 - y; break;
+                case ::SimdTransformRotate270: dx = h - 1 - y, dy = x; break;
+                case ::SimdTransformTransposeRotate0: dx = y, dy = x; break;
+                case ::SimdTransformTransposeRotate90: dx = w - 1 - x, dy = y; break;
+                case ::SimdTransformTransposeRotate180: dx = h - 1 - y, dy = w - 1 - x; break;
+                case ::SimdTransformTransposeRotate270: dx = x, dy = h - 1 - y; break;
+                default: assert(0);
+                }
+                memcpy(dst.data + dy * dst.stride + dx * size, src.data + y * src.stride + x * size, size);
+            }
+        }
+    }
+
     bool TransformImageAutoTest(::SimdTransformType transform, View::Format format, int width, int height, FuncTI f1, FuncTI f2)
     {
         bool result = true;
@@ -93,6 +120,13 @@ namespace Test
 
         result = result && Compare(d1, d2, 0, true, 32);
 
+        if (result)
+        {
+            View d3(ds.x, ds.y, format, NULL, TEST_ALIGN(width));
+            TransformImageReference(s, transform, d3);
+            result = result && Compare(d1, d3, 0, true, 32);
+        }
+
         return result;
     }
 
@@ -112,12 +146,61 @@ namespace Test
         return result;
     }
 
+    typedef Simd::Frame<Simd::Allocator> Frame;
+
+    bool TransformFrameAutoTest(::SimdTransformType transform, Frame::Format format, int width, int height)
+    {
+        bool result = true;
+
+        Frame src(width, height, format);
+        for (size_t i = 0; i < src.PlaneCount(); ++i)
+            FillRandom(src.planes[i]);
+
+        Frame dst(Simd::TransformSize(src.Size(), transform), format);
+        Simd::TransformImage(src, transform, dst);
+
+        for (size_t i = 0; i < src.PlaneCount(); ++i)
+        {
+            std::stringstream desc;
+            desc << "frame " << format << " transform " << transform << " plane " << i;
+            if (dst.planes[i].Size() != Simd::TransformSize(src.planes[i].Size(), transform))
+            {
+                TEST_LOG_SS(Error, desc.str() << " has wrong size!");
+                return false;
+            }
+            View control(dst.planes[i].width, dst.planes[i].height, dst.planes[i].format, NULL, TEST_ALIGN(width));
+            TransformImageReference(src.planes[i], transform, control);
+            result = result && Compare(dst.planes[i], control, 0, true, 32, 0, desc.str());
+        }
+
+        return result;
+    }
+
+    bool TransformFrameAutoTest()
+    {
+        bool result = true;
+
+        const Frame::Format formats[3] = { Frame::Yuv420p, Frame::Nv12, Frame::Bgr24 };
+        for (::SimdTransformType transform = ::SimdTransformRotate0; transform <= ::SimdTransformTransposeRotate270; transform = ::SimdTransformType(transform + 1))
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                result = result && TransformFrameAutoTest(transform, formats[i], W, H);
+                result = result && TransformFrameAutoTest(transform, formats[i], W + E, H - E);
+            }
+        }
+
+        return result;
+    }
+
     bool TransformImageAutoTest()
     {
         bool result = true;
 
         result = result && TransformImageAutoTest(FUNC_TI(Simd::Base::TransformImage), FUNC_TI(SimdTransformImage));
 
+        result = result && TransformFrameAutoTest();
+
 #ifdef SIMD_SSSE3_ENABLE
         if (Simd::Ssse3::Enable && W >= Simd::Ssse3::A)
             result = result && TransformImageAutoTest(FUNC_TI(Simd::Ssse3::TransformImage), FUNC_TI(SimdTransformImage));
@@ -0,0 +1,521 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestData.h"
+
+#include "Simd/SimdWarp.h"
+
+namespace Test
+{
+    SIMD_INLINE String ToString(SimdWarpTransformType transform)
+    {
+        switch (transform)
+        {
+        case SimdWarpTransformAffine: return "Af";
+        case SimdWarpTransformPerspective: return "Ps";
+        default: assert(0); return "";
+        }
+    }
+
+    SIMD_INLINE String ToString(SimdWarpInterpType interp)
+    {
+        switch (interp)
+        {
+        case SimdWarpInterpNearest: return "Nr";
+        case SimdWarpInterpBilinear: return "Bl";
+        default: assert(0); return "";
+        }
+    }
+
+    SIMD_INLINE String ToString(SimdWarpBorderType border)
+    {
+        switch (border)
+        {
+        case SimdWarpBorderConstant: return "C";
+        case SimdWarpBorderReplicate: return "R";
+        case SimdWarpBorderTransparent: return "T";
+        default: assert(0); return "";
+        }
+    }
+
+    namespace
+    {
+        struct FuncW
+        {
+            typedef void*(*FuncPtr)(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, SimdResizeChannelType type,
+                const float * mat, SimdWarpTransformType transform, SimdWarpInterpType interp, SimdWarpBorderType border, const uint8_t * value);
+
+            FuncPtr func;
+            String description;
+
+            FuncW(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(SimdWarpTransformType transform, SimdWarpInterpType interp, SimdWarpBorderType border, SimdResizeChannelType type, size_t channels)
+            {
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << ToString(transform) << "-" << ToString(interp) << "-" << ToString(border) << "-" << (type == SimdResizeChannelFloat ? "32f" : "8u") << "-" << channels << "]";
+                description = ss.str();
+            }
+
+            void Call(const View & src, View & dst, size_t channels, SimdResizeChannelType type, const float * mat, 
+                SimdWarpTransformType transform, SimdWarpInterpType interp, SimdWarpBorderType border, const uint8_t * value) const
+            {
+                size_t k = type == SimdResizeChannelFloat ? channels : 1;
+                void * warp = func(src.width / k, src.height, dst.width / k, dst.height, channels, type, mat, transform, interp, border, value);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdWarpRun(warp, src.data, src.stride, dst.data, dst.stride);
+                }
+                SimdRelease(warp);
+            }
+        };
+    }
+
+#define FUNC_W(function) \
+    FuncW(function, std::string(#function))
+
+    bool WarpAutoTest(SimdWarpTransformType transform, SimdWarpInterpType interp, SimdWarpBorderType border, SimdResizeChannelType type, 
+        size_t channels, size_t srcW, size_t srcH, size_t dstW, size_t dstH, FuncW f1, FuncW f2)
+    {
+        bool result = true;
+
+        f1.Update(transform, interp, border, type, channels);
+        f2.Update(transform, interp, border, type, channels);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << srcW << ", " << srcH << "] -> [" << dstW << ", " << dstH << "].");
+
+        View::Format format;
+        if (type == SimdResizeChannelFloat)
+        {
+            format = View::Float;
+            srcW *= channels;
+            dstW *= channels;
+        }
+        else
+        {
+            switch (channels)
+            {
+            case 1: format = View::Gray8; break;
+            case 2: format = View::Uv16; break;
+            case 3: format = View::Bgr24; break;
+            case 4: format = View::Bgra32; break;
+            default:
+                assert(0);
+            }
+        }
+
+        View src(srcW, srcH, format, NULL, TEST_ALIGN(srcW));
+        View dst1(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+        View dst2(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+        if (format == View::Float)
+        {
+            FillRandom32f(src);
+            FillRandom32f(dst1);
+        }
+        else
+        {
+            FillRandom(src);
+            FillRandom(dst1);
+        }
+        Simd::Copy(dst1, dst2);
+
+        const double angle = 0.3, scale = 1.15;
+        float mat[9] = {
+            float(scale * ::cos(angle)), float(-scale * ::sin(angle)), float(srcH / 4),
+            float(scale * ::sin(angle)), float(scale * ::cos(angle)), -float(srcH / 8),
+            0.0002f, -0.0003f, 1.0f };
+        uint8_t value[4 * sizeof(float)];
+        if (format == View::Float)
+        {
+            for (size_t i = 0; i < 4; ++i)
+                ((float*)value)[i] = float(i) * 0.25f - 0.375f;
+        }
+        else
+        {
+            for (size_t i = 0; i < sizeof(value); ++i)
+                value[i] = uint8_t(i * 17 + 3);
+        }
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1, channels, type, mat, transform, interp, border, value));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2, channels, type, mat, transform, interp, border, value));
+
+        if (format == View::Float)
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+        else
+            result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool WarpAutoTest(SimdWarpTransformType transform, SimdWarpInterpType interp, SimdWarpBorderType border, SimdResizeChannelType type, size_t channels, const FuncW & f1, const FuncW & f2)
+    {
+        bool result = true;
+
+        result = result && WarpAutoTest(transform, interp, border, type, channels, W, H, W, H, f1, f2);
+        result = result && WarpAutoTest(transform, interp, border, type, channels, W + O, H - O, W - O, H + O, f1, f2);
+
+        return result;
+    }
+
+    bool WarpAutoTest(const FuncW & f1, const FuncW & f2)
+    {
+        bool result = true;
+
+        for (int transform = SimdWarpTransformAffine; transform <= SimdWarpTransformPerspective; ++transform)
+        {
+            for (int interp = SimdWarpInterpNearest; interp <= SimdWarpInterpBilinear; ++interp)
+            {
+                SimdWarpTransformType t = (SimdWarpTransformType)transform;
+                SimdWarpInterpType i = (SimdWarpInterpType)interp;
+                result = result && WarpAutoTest(t, i, SimdWarpBorderConstant, SimdResizeChannelByte, 1, f1, f2);
+                result = result && WarpAutoTest(t, i, SimdWarpBorderReplicate, SimdResizeChannelByte, 2, f1, f2);
+                result = result && WarpAutoTest(t, i, SimdWarpBorderTransparent, SimdResizeChannelByte, 3, f1, f2);
+                result = result && WarpAutoTest(t, i, SimdWarpBorderConstant, SimdResizeChannelByte, 4, f1, f2);
+                result = result && WarpAutoTest(t, i, SimdWarpBorderReplicate, SimdResizeChannelFloat, 1, f1, f2);
+                result = result && WarpAutoTest(t, i, SimdWarpBorderConstant, SimdResizeChannelFloat, 3, f1, f2);
+            }
+        }
+
+        return result;
+    }
+
+    bool WarpAutoTest()
+    {
+        bool result = true;
+
+        result = result && WarpAutoTest(FUNC_W(Simd::Base::WarpInit), FUNC_W(SimdWarpInit));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && WarpAutoTest(FUNC_W(Simd::Sse2::WarpInit), FUNC_W(SimdWarpInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && WarpAutoTest(FUNC_W(Simd::Avx2::WarpInit), FUNC_W(SimdWarpInit));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    static void FillFisheyeMap(size_t srcW, size_t srcH, View & mapX, View & mapY)
+    {
+        double cx = srcW * 0.5, cy = srcH * 0.5, k = 0.3 / (cx * cx + cy * cy);
+        double dx = mapX.width * 0.5, dy = mapX.height * 0.5, sx = srcW / (double)mapX.width, sy = srcH / (double)mapX.height;
+        for (size_t y = 0; y < mapX.height; ++y)
+        {
+            for (size_t x = 0; x < mapX.width; ++x)
+            {
+                double px = (x - dx) * sx, py = (y - dy) * sy, r = 1.0 + k * (px * px + py * py);
+                mapX.At<float>(x, y) = float(cx + px * r);
+                mapY.At<float>(x, y) = float(cy + py * r);
+            }
+        }
+    }
+
+    namespace
+    {
+        struct FuncCM
+        {
+            typedef void(*FuncPtr)(const float * mapX, size_t mapXStride, const float * mapY, size_t mapYStride, size_t width, size_t height,
+                size_t srcWidth, size_t srcHeight, int16_t * map, size_t mapStride);
+
+            FuncPtr func;
+            String description;
+
+            FuncCM(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & mapX, const View & mapY, size_t srcWidth, size_t srcHeight, View & map) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func((float*)mapX.data, mapX.stride, (float*)mapY.data, mapY.stride, mapX.width, mapX.height, srcWidth, srcHeight, (int16_t*)map.data, map.stride);
+            }
+        };
+    }
+
+#define FUNC_CM(function) FuncCM(function, #function)
+
+    bool RemapMapCheck(const View & mapX, const View & mapY, size_t srcWidth, size_t srcHeight, const View & map)
+    {
+        size_t width = mapX.width;
+        for (size_t y = 0; y < mapX.height; ++y)
+        {
+            const int16_t * row = &map.At<int16_t>(0, y);
+            for (size_t x = 0; x < width; ++x)
+            {
+                uint16_t f = (uint16_t)row[2 * width + x];
+                float dx = float(row[x]) + float(f & 0xFF) / 256.0f;
+                float dy = float(row[width + x]) + float(f >> 8) / 256.0f;
+                float ex = Simd::RestrictRange(mapX.At<float>(x, y), -2.0f, float(srcWidth + 1));
+                float ey = Simd::RestrictRange(mapY.At<float>(x, y), -2.0f, float(srcHeight + 1));
+                if (std::abs(dx - ex) > 1.0f / 256.0f || std::abs(dy - ey) > 1.0f / 256.0f)
+                {
+                    TEST_LOG_SS(Error, "Wrong map value at [" << x << ", " << y << "]: (" << dx << ", " << dy << ") != (" << ex << ", " << ey << ").");
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    bool RemapConvertMapAutoTest(size_t width, size_t height, const FuncCM & f1, const FuncCM & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View mapX(width, height, View::Float, NULL, TEST_ALIGN(width));
+        View mapY(width, height, View::Float, NULL, TEST_ALIGN(width));
+        FillFisheyeMap(width, height, mapX, mapY);
+
+        View map1(3 * width, height, View::Int16, NULL, TEST_ALIGN(width));
+        View map2(3 * width, height, View::Int16, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(mapX, mapY, width, height, map1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(mapX, mapY, width, height, map2));
+
+        result = result && Compare(map1, map2, 0, true, 64);
+
+        result = result && RemapMapCheck(mapX, mapY, width, height, map1);
+
+        return result;
+    }
+
+    bool RemapConvertMapAutoTest(const FuncCM & f1, const FuncCM & f2)
+    {
+        bool result = true;
+
+        result = result && RemapConvertMapAutoTest(W, H, f1, f2);
+        result = result && RemapConvertMapAutoTest(W + O, H - O, f1, f2);
+
+        return result;
+    }
+
+    bool RemapConvertMapAutoTest()
+    {
+        bool result = true;
+
+        result = result && RemapConvertMapAutoTest(FUNC_CM(Simd::Base::RemapConvertMap), FUNC_CM(SimdRemapConvertMap));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && RemapConvertMapAutoTest(FUNC_CM(Simd::Sse2::RemapConvertMap), FUNC_CM(SimdRemapConvertMap));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && RemapConvertMapAutoTest(FUNC_CM(Simd::Avx2::RemapConvertMap), FUNC_CM(SimdRemapConvertMap));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncRB
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t srcStride, size_t srcWidth, size_t srcHeight, size_t channelCount, const int16_t * map, size_t mapStride,
+                size_t width, size_t height, SimdWarpBorderType border, const uint8_t * value, uint8_t * dst, size_t dstStride);
+
+            FuncPtr func;
+            String description;
+
+            FuncRB(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(SimdWarpBorderType border, size_t channels)
+            {
+                description = description + "[" + ToString(border) + "-" + ToString(channels) + "]";
+            }
+
+            void Call(const View & src, const View & map, SimdWarpBorderType border, const uint8_t * value, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.stride, src.width, src.height, src.ChannelCount(), (int16_t*)map.data, map.stride,
+                    dst.width, dst.height, border, value, dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_RB(function) FuncRB(function, #function)
+
+    bool RemapBilinearAutoTest(size_t width, size_t height, View::Format format, SimdWarpBorderType border, FuncRB f1, FuncRB f2)
+    {
+        bool result = true;
+
+        f1.Update(border, View::PixelSize(format));
+        f2.Update(border, View::PixelSize(format));
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View src(width, height, format, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View mapX(width, height, View::Float, NULL, TEST_ALIGN(width));
+        View mapY(width, height, View::Float, NULL, TEST_ALIGN(width));
+        FillFisheyeMap(width, height, mapX, mapY);
+        View map(3 * width, height, View::Int16, NULL, TEST_ALIGN(width));
+        Simd::RemapConvertMap(mapX, mapY, width, height, map);
+
+        View dst1(width, height, format, NULL, TEST_ALIGN(width));
+        View dst2(width, height, format, NULL, TEST_ALIGN(width));
+        FillRandom(dst1);
+        Simd::Copy(dst1, dst2);
+
+        const uint8_t value[4] = { 11, 22, 33, 44 };
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, map, border, value, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, map, border, value, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool RemapBilinearAutoTest(const FuncRB & f1, const FuncRB & f2)
+    {
+        bool result = true;
+
+        View::Format formats[4] = { View::Gray8, View::Uv16, View::Bgr24, View::Bgra32 };
+        for (int i = 0; i < 4; ++i)
+        {
+            SimdWarpBorderType border = (SimdWarpBorderType)(i % 3);
+            result = result && RemapBilinearAutoTest(W, H, formats[i], border, f1, f2);
+            result = result && RemapBilinearAutoTest(W + O, H - O, formats[i], border, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool RemapBilinearAutoTest()
+    {
+        bool result = true;
+
+        result = result && RemapBilinearAutoTest(FUNC_RB(Simd::Base::RemapBilinear), FUNC_RB(SimdRemapBilinear));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && RemapBilinearAutoTest(FUNC_RB(Simd::Avx2::RemapBilinear), FUNC_RB(SimdRemapBilinear));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncRY
+        {
+            typedef void(*FuncPtr)(const uint8_t * srcY, size_t srcYStride, const uint8_t * srcU, size_t srcUStride, const uint8_t * srcV, size_t srcVStride,
+                size_t srcWidth, size_t srcHeight, const int16_t * map, size_t mapStride, size_t width, size_t height, SimdWarpBorderType border, const uint8_t * value,
+                uint8_t * dstY, size_t dstYStride, uint8_t * dstU, size_t dstUStride, uint8_t * dstV, size_t dstVStride);
+
+            FuncPtr func;
+            String description;
+
+            FuncRY(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & srcY, const View & srcU, const View & srcV, const View & map, const uint8_t * value, View & dstY, View & dstU, View & dstV) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(srcY.data, srcY.stride, srcU.data, srcU.stride, srcV.data, srcV.stride, srcY.width, srcY.height, (int16_t*)map.data, map.stride,
+                    dstY.width, dstY.height, SimdWarpBorderConstant, value, dstY.data, dstY.stride, dstU.data, dstU.stride, dstV.data, dstV.stride);
+            }
+        };
+    }
+
+#define FUNC_RY(function) FuncRY(function, #function)
+
+    bool RemapBilinearYuv420pAutoTest(size_t width, size_t height, const FuncRY & f1, const FuncRY & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View srcY(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View srcU(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+        View srcV(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(srcY);
+        FillRandom(srcU);
+        FillRandom(srcV);
+
+        View mapX(width, height, View::Float, NULL, TEST_ALIGN(width));
+        View mapY(width, height, View::Float, NULL, TEST_ALIGN(width));
+        FillFisheyeMap(width, height, mapX, mapY);
+        View map(3 * width, height, View::Int16, NULL, TEST_ALIGN(width));
+        Simd::RemapConvertMap(mapX, mapY, width, height, map);
+
+        View dstY1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View dstU1(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+        View dstV1(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+        View dstY2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View dstU2(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+        View dstV2(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+
+        const uint8_t value[3] = { 16, 128, 128 };
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(srcY, srcU, srcV, map, value, dstY1, dstU1, dstV1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(srcY, srcU, srcV, map, value, dstY2, dstU2, dstV2));
+
+        result = result && Compare(dstY1, dstY2, 0, true, 64, 0, "y");
+        result = result && Compare(dstU1, dstU2, 0, true, 64, 0, "u");
+        result = result && Compare(dstV1, dstV2, 0, true, 64, 0, "v");
+
+        return result;
+    }
+
+    bool RemapBilinearYuv420pAutoTest(const FuncRY & f1, const FuncRY & f2)
+    {
+        bool result = true;
+
+        result = result && RemapBilinearYuv420pAutoTest(W, H, f1, f2);
+        result = result && RemapBilinearYuv420pAutoTest(W + E, H - E, f1, f2);
+
+        return result;
+    }
+
+    bool RemapBilinearYuv420pAutoTest()
+    {
+        bool result = true;
+
+        result = result && RemapBilinearYuv420pAutoTest(FUNC_RY(Simd::Base::RemapBilinearYuv420p), FUNC_RY(SimdRemapBilinearYuv420p));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && RemapBilinearYuv420pAutoTest(FUNC_RY(Simd::Avx2::RemapBilinearYuv420p), FUNC_RY(SimdRemapBilinearYuv420p));
+#endif 
+
+        return result;
+    }
+}